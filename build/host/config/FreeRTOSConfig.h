@@ -0,0 +1,167 @@
+/**
+ * @file FreeRTOSConfig.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief FreeRTOS configuration for the Linux host build.
+ *
+ * @details Mirrors libs/FreeRTOSAL/config/FreeRTOSConfig.h as closely as the
+ * POSIX simulator port allows, so timing related code (tick rate, priorities,
+ * timer task) behaves the same on host as on target. Everything Cortex-M
+ * specific (RTC tick source, NVIC priorities, tickless idle) is dropped.
+ *
+ * This directory has to come before libs/FreeRTOSAL/config in the include
+ * path, which build/host/Makefile takes care of.
+ *
+ * @version 1.0
+ * @date 2020-09-01
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * See http://www.freertos.org/a00110.html.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION                    1
+/** POSIX port has no CLZ based task selection */
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#ifdef SIMULATION
+/** RTOS::Simulation, idle jumps to the next due tick instead of sleeping */
+#define configUSE_SIMULATION                    1
+#define configUSE_TICKLESS_IDLE                 1
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP   2
+#else
+#define configUSE_SIMULATION                    0
+/** POSIX port ticks from a host timer signal, it can not sleep tickless */
+#define configUSE_TICKLESS_IDLE                 0
+#endif
+#define configCPU_CLOCK_HZ                      (1000000UL)
+/**
+ * @brief keep in sync with target config.
+ * RTOS::Utility::millisToTicks() depends on it.
+ *
+ */
+#define configTICK_RATE_HZ       500
+#define configMAX_PRIORITIES     (10)
+/** pthreads need way more stack than the MCU, see PTHREAD_STACK_MIN */
+#define configMINIMAL_STACK_SIZE (2048)
+#define configTOTAL_HEAP_SIZE    (64 * 1024)
+#define configMAX_TASK_NAME_LEN  (20)
+/**
+ * @brief set to 0 so Tick type is 32bit
+ *
+ */
+#define configUSE_16_BIT_TICKS              0
+#define configIDLE_SHOULD_YIELD             1
+#define configUSE_MUTEXES                   1
+#define configUSE_RECURSIVE_MUTEXES         0
+#define configUSE_COUNTING_SEMAPHORES       1
+#define configUSE_ALTERNATIVE_API           0 /* Deprecated! */
+#define configQUEUE_REGISTRY_SIZE           5
+#define configUSE_QUEUE_SETS                0
+#define configUSE_TIME_SLICING              0
+#define configUSE_NEWLIB_REENTRANT          0
+#define configENABLE_BACKWARD_COMPATIBILITY 0
+#define configSUPPORT_DYNAMIC_ALLOCATION    1
+#define configSUPPORT_STATIC_ALLOCATION     1
+
+/* Hook function related definitions. */
+#define configUSE_IDLE_HOOK            0
+#define configUSE_TICK_HOOK            0
+/** stack of a pthread is not the one handed to xTaskCreateStatic */
+#define configCHECK_FOR_STACK_OVERFLOW 0
+#define configUSE_MALLOC_FAILED_HOOK   1
+
+/* Run time and task stats gathering related definitions.
+Run time counter is the monotonic host clock in us, see RunTimeCounter.cpp */
+#define configGENERATE_RUN_TIME_STATS        1
+#define configUSE_TRACE_FACILITY             1
+#define configUSE_STATS_FORMATTING_FUNCTIONS 0
+/** tasks RTOS::Profiler keeps track of, counted in order of creation */
+#define configPROFILER_MAX_TASKS             20
+/** frequency of portGET_RUN_TIME_COUNTER_VALUE() */
+#define configRUN_TIME_COUNTER_HZ            1000000
+/** RTOS::Trace records task switches, queue operations and errors */
+#define configUSE_TRACE_RECORDER             1
+/** records of 8 bytes in the trace ring, power of two */
+#define configTRACE_RECORDS                  256
+/** frequency of rtosTraceTimestampGet(), microseconds, see TracePort.cpp */
+#define configTRACE_TIMESTAMP_HZ             1000000
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES           0
+#define configMAX_CO_ROUTINE_PRIORITIES (2)
+
+/* Software timer definitions. */
+#define configUSE_TIMERS             1
+#define configTIMER_TASK_PRIORITY    (2)
+#define configTIMER_QUEUE_LENGTH     32
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE)
+
+/* Define to trap errors during development.
+<assert.h> must not be used, it clashes with Test::Base::assert() */
+#define configASSERT(x)      \
+    if ((x) == 0) {          \
+        __builtin_trap();    \
+    }
+
+/* Optional functions - most linkers will remove unused functions anyway. */
+#define INCLUDE_vTaskPrioritySet               1
+#define INCLUDE_uxTaskPriorityGet              1
+#define INCLUDE_vTaskDelete                    1
+#define INCLUDE_vTaskSuspend                   1
+#define INCLUDE_xResumeFromISR                 1
+#define INCLUDE_vTaskDelayUntil                1
+#define INCLUDE_vTaskDelay                     1
+#define INCLUDE_xTaskGetSchedulerState         1
+#define INCLUDE_xTaskGetCurrentTaskHandle      1
+#define INCLUDE_uxTaskGetStackHighWaterMark    1
+#define INCLUDE_xTaskGetIdleTaskHandle         1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle 1
+#define INCLUDE_pcTaskGetTaskName              1
+#define INCLUDE_eTaskGetState                  1
+#define INCLUDE_xEventGroupSetBitFromISR       1
+#define INCLUDE_xTimerPendFunctionCall         1
+#define INCLUDE_xTaskAbortDelay                1
+#define INCLUDE_pxTaskGetStackStart            1
+
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** context switches in total and per task number, see RTOS::Profiler */
+extern volatile uint32_t rtosContextSwitchCount;
+extern volatile uint32_t rtosTaskSwitchCounts[configPROFILER_MAX_TASKS];
+/** run time counter for run time stats, implemented by the platform */
+void     rtosRunTimeCounterInit(void);
+uint32_t rtosRunTimeCounterGet(void);
+/** records a task switch if RTOS::Trace is enabled */
+void     rtosTraceTaskSwitchedIn(uint32_t taskNumber);
+/** replaces sleeping in the idle task, see RTOS::Simulation */
+void     rtosSimulationSkipTicks(uint32_t expectedIdleTicks);
+#ifdef __cplusplus
+}
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() rtosRunTimeCounterInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()         rtosRunTimeCounterGet()
+#if configUSE_SIMULATION
+#define portSUPPRESS_TICKS_AND_SLEEP(idleTicks) \
+    rtosSimulationSkipTicks((uint32_t)(idleTicks))
+#endif
+#define traceTASK_SWITCHED_IN()                                         \
+    do {                                                                \
+        rtosContextSwitchCount++;                                       \
+        if (pxCurrentTCB->uxTCBNumber < configPROFILER_MAX_TASKS) {     \
+            rtosTaskSwitchCounts[pxCurrentTCB->uxTCBNumber]++;          \
+        }                                                               \
+        if (configUSE_TRACE_RECORDER) {                                 \
+            rtosTraceTaskSwitchedIn(pxCurrentTCB->uxTCBNumber);         \
+        }                                                               \
+    } while (0)
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,88 @@
+/**
+ * @file PatternsPort.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief implements the functions required by Patterns module on Linux host
+ * @version 1.0
+ * @date 2020-09-01
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "PatternsPort.h"
+
+#include <AL_CrashLog.h>
+#include <AL_Trace.h>
+#include <Error.h>
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//-------------------------------- FUNCTIONS ----------------------------------
+
+void Port::restart()
+{
+    // there is nothing to restart into on host, fail the process instead
+    std::fflush(stdout);
+    std::exit(EXIT_FAILURE);
+}
+
+void Port::logInfo(const char* const str)
+{
+    std::fputs(str, stdout);
+    std::fflush(stdout);
+}
+
+void Port::logError(uint32_t site, const char* const errorDescription)
+{
+    std::fprintf(stderr,
+                 "error site 0x%08X (line %u):\t%s\n",
+                 static_cast<unsigned int>(site),
+                 static_cast<unsigned int>(Error::getSiteLine(site)),
+                 errorDescription);
+    std::fflush(stderr);
+}
+
+void Port::traceError(uint32_t code, uint32_t site)
+{
+    TRACE_EVENT(RTOS::Trace::ErrorCheck,
+                (code << 16) | (Error::getSiteLine(site) & 0xFFFF));
+}
+
+void Port::saveCrash(uint32_t code, uint32_t site)
+{
+    Diagnostics::CrashLog::save(static_cast<Error::Code>(code), site);
+}
+
+void Port::disableInterrupts()
+{
+    // no interrupts on host, ticks are signals handled by the POSIX port
+}
+
+uint32_t Port::getCycleCount()
+{
+    // cycles of the host CPU have no fixed frequency, count ns instead
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+uint32_t Port::getCycleCountHz()
+{
+    return 1000000000;
+}
+
+void Port::faultBreakpoint()
+{
+    // stops in an attached debugger, otherwise terminates the process
+    std::raise(SIGTRAP);
+}
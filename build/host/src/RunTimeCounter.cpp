@@ -0,0 +1,64 @@
+/**
+ * @file RunTimeCounter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief run time counter for FreeRTOS run time stats on Linux host
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Simulation.h>
+#include <FreeRTOS.h>
+#include <chrono>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(configRUN_TIME_COUNTER_HZ == 1000000,
+              "host counter runs in microseconds");
+
+//---------------------------- STATIC VARIABLES -------------------------------
+
+/** time of scheduler start */
+static std::chrono::steady_clock::time_point start;
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Remembers scheduler start.
+ *
+ */
+extern "C" void rtosRunTimeCounterInit(void)
+{
+    start = std::chrono::steady_clock::now();
+}
+
+/**
+ * @brief Get microseconds since scheduler start.
+ *
+ * @details Includes the time RTOS::Simulation jumped over, so the counter
+ * follows the virtual clock in a simulation.
+ *
+ * @return uint32_t wraps after roughly 71 minutes.
+ */
+extern "C" uint32_t rtosRunTimeCounterGet(void)
+{
+    auto skipped = RTOS::Simulation::getSkippedTicks() *
+                   (configRUN_TIME_COUNTER_HZ / configTICK_RATE_HZ);
+    return static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start)
+            .count() +
+        skipped);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,54 @@
+/**
+ * @file TracePort.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief timestamps of RTOS::Trace on Linux host
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Trace.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(configTRACE_TIMESTAMP_HZ == configRUN_TIME_COUNTER_HZ,
+              "host trace shares the run time counter");
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Nothing to do, the run time counter starts with the scheduler.
+ *
+ */
+extern "C" void rtosTraceTimestampInit(void) {}
+
+/**
+ * @brief Get microseconds since scheduler start.
+ *
+ */
+extern "C" uint32_t rtosTraceTimestampGet(void)
+{
+    return rtosRunTimeCounterGet();
+}
+
+/**
+ * @brief There are no ISRs on host.
+ *
+ * @return uint32_t always 0
+ */
+extern "C" uint32_t rtosTraceIsrNumber(void)
+{
+    return 0;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,144 @@
+/**
+ * @file main.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief entry point of the Linux host test executable
+ *
+ * @details Runs all tests linked into the executable inside a FreeRTOS task
+ * on top of the POSIX simulator port. Process exit code reflects the overall
+ * test result, so the executable can be used from CI directly.
+ *
+ * Benchmarks run after the tests. BENCH_BASELINE may name the output of an
+ * earlier run, cases that got slower than that fail the run as well.
+ *
+ * @version 1.0
+ * @date 2020-09-01
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_RTOS.h"
+#include "AL_Simulation.h"
+#include "AL_Task.h"
+#include "BenchCase.h"
+#include "TestBase.h"
+
+#include <Error.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+namespace Test
+{
+/**
+ * @brief executes all tests and terminates the process with the result.
+ *
+ * @details Implemented as eager loading singleton.
+ */
+class HostExecuter {
+    static constexpr size_t kStackSize =
+        4096; /**< Stack size of the task executing the tests */
+
+    friend RTOS::Task<kStackSize, HostExecuter>;
+
+public:
+    // delete default constructors
+    HostExecuter(const HostExecuter& other) = delete;
+    HostExecuter& operator=(const HostExecuter& other) = delete;
+
+private:
+    HostExecuter() : task(*this, "HostExecuter", kTaskPriority) {}
+
+    // task interface
+    void onStart() {}
+    void onRun()
+    {
+        bool success = Test::Base::runAllTests();
+
+        size_t baselineSize = loadBaseline(std::getenv("BENCH_BASELINE"));
+        success &= Bench::Case::runAll(baseline, baselineSize);
+        std::fflush(stdout);
+        // static destructors would delete RTOS objects under the running
+        // scheduler, so leave without them
+        std::_Exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    /**
+     * @brief reads the JSON lines of an earlier run into baseline.
+     *
+     * @param path file written from stdout of an earlier run, nullptr for none
+     * @return number of references found
+     */
+    size_t loadBaseline(const char* path)
+    {
+        if (path == nullptr) {
+            return 0;
+        }
+        std::FILE* file = std::fopen(path, "r");
+        if (file == nullptr) {
+            std::printf("could not open BENCH_BASELINE %s\n", path);
+            return 0;
+        }
+
+        size_t count = 0;
+        char   line[256];
+        while (count < kMaxBaseline && std::fgets(line, sizeof(line), file)) {
+            unsigned int median = 0;
+            const char*  field  = std::strstr(line, "\"median\":");
+            bool         named =
+                std::sscanf(line, "{\"bench\":\"%63[^\"]\"", names[count]) == 1;
+            if (!named || field == nullptr ||
+                std::sscanf(field, "\"median\":%u", &median) != 1) {
+                continue;
+            }
+            baseline[count] = {names[count], median};
+            count++;
+        }
+        std::fclose(file);
+        return count;
+    }
+
+    RTOS::Task<kStackSize, HostExecuter>
+        task; /**< Task that executes tests in context of this class */
+
+    static constexpr size_t kMaxBaseline = 64; /**< benchmarks in a baseline */
+    char names[kMaxBaseline][64]; /**< names referenced by baseline */
+    Bench::Case::Reference baseline[kMaxBaseline]; /**< earlier medians */
+
+    /** singleton instance */
+    static HostExecuter instance;
+
+    static constexpr uint8_t kTaskPriority =
+        1; /**< same as TestExecuter on target */
+};
+}  // namespace Test
+
+Test::HostExecuter Test::HostExecuter::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Function for application main entry
+ *
+ */
+int main()
+{
+    if (RTOS::Simulation::isActive()) {
+        const char* seed = std::getenv("SIMULATION_SEED");
+        RTOS::Simulation::seed(seed ? std::strtoul(seed, nullptr, 0) : 1);
+        std::printf("Simulation in virtual time, SIMULATION_SEED=%u\n",
+                    static_cast<unsigned int>(RTOS::Simulation::getSeed()));
+    }
+
+    RTOS::init();
+
+    // should never get here
+    CHECK_ERROR(Error::Unknown);
+    return EXIT_FAILURE;
+}
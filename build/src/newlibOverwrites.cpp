@@ -1,7 +1,10 @@
 /**
- * @file stackProtector.cpp
+ * @file newlibOverwrites.cpp
  * @author Joshua Lauterbach (joshua@aconno.de)
  * @brief overwrites newlib functions to execute as wanted in embedded env.
+ *
+ * @details malloc, free and new / delete are served by a Memory::Tlsf heap
+ * with constant time operations and statistics, see Memory.h.
  * @version 0.1
  * @date 2020-05-07
  *
@@ -13,10 +16,94 @@
 
 #include <Error.h>
 #include <FreeRTOS.h>
+#include <Memory.h>
+#include <Tlsf.h>
+#include <cstring>
+#include <new>
+#include <reent.h>
 #include <task.h>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
+/**
+ * @brief Free RAM between heap section and main stack, see nrf_common.ld.
+ * newlib's _sbrk used to grow into the same region.
+ *
+ */
+extern "C" uint8_t __HeapBase[];
+extern "C" uint8_t __StackLimit[];
+
+/**
+ * @brief Heap behind malloc and new.
+ *
+ * @details Function local static, static constructors allocate before
+ * the static objects of this file would be initialized.
+ *
+ * @return Memory::Tlsf& The heap
+ */
+static Memory::Tlsf& getHeap()
+{
+    static Memory::Tlsf heap {__HeapBase,
+                              static_cast<size_t>(__StackLimit - __HeapBase)};
+    return heap;
+}
+
+/**
+ * @brief Allocates from the heap under the scheduler lock.
+ *
+ * @param size Bytes needed.
+ * @param callSite Caller, counted if call site tracking is on.
+ * @return void* Memory or nullptr.
+ */
+static void* lockedAllocate(size_t size, const void* callSite)
+{
+    vTaskSuspendAll();
+    auto pointer = getHeap().allocate(size, callSite);
+    (void)xTaskResumeAll();
+    return pointer;
+}
+
+/**
+ * @brief Frees to the heap under the scheduler lock.
+ *
+ * @param pointer Memory from lockedAllocate(), may be nullptr.
+ */
+static void lockedFree(void* pointer)
+{
+    vTaskSuspendAll();
+    auto result = getHeap().free(pointer);
+    (void)xTaskResumeAll();
+    CHECK_ERROR(result);
+}
+
+/**
+ * @brief Reallocates on the heap under the scheduler lock.
+ *
+ */
+static void* lockedReallocate(void* pointer, size_t size, const void* callSite)
+{
+    vTaskSuspendAll();
+    auto newPointer = getHeap().reallocate(pointer, size, callSite);
+    (void)xTaskResumeAll();
+    return newPointer;
+}
+
+/**
+ * @brief Zeroed allocation of count elements.
+ *
+ */
+static void* lockedCallocate(size_t count, size_t size, const void* callSite)
+{
+    if ((size != 0) && (count > SIZE_MAX / size)) {
+        return nullptr;
+    }
+    auto pointer = lockedAllocate(count * size, callSite);
+    if (pointer != nullptr) {
+        memset(pointer, 0, count * size);
+    }
+    return pointer;
+}
+
 /**
  * @brief Forward exit call to Error handling
  *
@@ -61,4 +148,138 @@ extern "C" void __malloc_unlock()
 
 //-------------------------------- CONSTANTS ----------------------------------
 
+/**
+ * @brief malloc and friends go to the Tlsf heap instead of newlib's
+ * allocator, the reentrant versions are used inside newlib.
+ *
+ */
+extern "C" void* malloc(size_t size)
+{
+    return lockedAllocate(size, __builtin_return_address(0));
+}
+
+extern "C" void free(void* pointer)
+{
+    lockedFree(pointer);
+}
+
+extern "C" void* realloc(void* pointer, size_t size)
+{
+    return lockedReallocate(pointer, size, __builtin_return_address(0));
+}
+
+extern "C" void* calloc(size_t count, size_t size)
+{
+    return lockedCallocate(count, size, __builtin_return_address(0));
+}
+
+extern "C" void* _malloc_r(struct _reent*, size_t size)
+{
+    return lockedAllocate(size, __builtin_return_address(0));
+}
+
+extern "C" void _free_r(struct _reent*, void* pointer)
+{
+    lockedFree(pointer);
+}
+
+extern "C" void* _realloc_r(struct _reent*, void* pointer, size_t size)
+{
+    return lockedReallocate(pointer, size, __builtin_return_address(0));
+}
+
+extern "C" void* _calloc_r(struct _reent*, size_t count, size_t size)
+{
+    return lockedCallocate(count, size, __builtin_return_address(0));
+}
+
+/**
+ * @brief new and delete take the Tlsf heap directly, so call sites point
+ * to the code using new instead of into libstdc++.
+ *
+ */
+void* operator new(size_t size)
+{
+    auto pointer = lockedAllocate(size, __builtin_return_address(0));
+    if (pointer == nullptr) {
+        // exceptions are disabled, nobody would catch std::bad_alloc
+        CHECK_ERROR(Error::OutOfResources);
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size)
+{
+    auto pointer = lockedAllocate(size, __builtin_return_address(0));
+    if (pointer == nullptr) {
+        CHECK_ERROR(Error::OutOfResources);
+    }
+    return pointer;
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return lockedAllocate(size, __builtin_return_address(0));
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return lockedAllocate(size, __builtin_return_address(0));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    lockedFree(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    lockedFree(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    lockedFree(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept
+{
+    lockedFree(pointer);
+}
+
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Current usage and fragmentation of the heap.
+ *
+ */
+Memory::Stats Memory::stats()
+{
+    vTaskSuspendAll();
+    auto result = getHeap().getStats();
+    (void)xTaskResumeAll();
+    return result;
+}
+
+/**
+ * @brief Switch counting allocations per call site on or off.
+ *
+ */
+void Memory::trackCallSites(bool active)
+{
+    vTaskSuspendAll();
+    getHeap().trackCallSites(active);
+    (void)xTaskResumeAll();
+}
+
+/**
+ * @brief Copy out the counted call sites.
+ *
+ */
+size_t Memory::getCallSites(CallSite* sites, size_t maxSites)
+{
+    vTaskSuspendAll();
+    auto count = getHeap().getCallSites(sites, maxSites);
+    (void)xTaskResumeAll();
+    return count;
+}
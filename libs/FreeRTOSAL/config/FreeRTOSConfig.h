@@ -61,6 +61,8 @@
 #define configUSE_TICKLESS_IDLE                 1
 #define configUSE_TICKLESS_IDLE_SIMPLE_DEBUG \
     1 /* See into vPortSuppressTicksAndSleep source code for explanation */
+/** virtual time, host only, see RTOS::Simulation */
+#define configUSE_SIMULATION                    0
 #define configCPU_CLOCK_HZ (SystemCoreClock)
 /**
  * @brief never set this larger than 1000Hz!
@@ -97,10 +99,21 @@
 #define configCHECK_FOR_STACK_OVERFLOW 1
 #define configUSE_MALLOC_FAILED_HOOK   1
 
-/* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS        0
-#define configUSE_TRACE_FACILITY             0
+/* Run time and task stats gathering related definitions.
+Run time counter is RTC2 at 32768Hz, see RunTimeCounter.cpp in NordicAL */
+#define configGENERATE_RUN_TIME_STATS        1
+#define configUSE_TRACE_FACILITY             1
 #define configUSE_STATS_FORMATTING_FUNCTIONS 0
+/** tasks RTOS::Profiler keeps track of, counted in order of creation */
+#define configPROFILER_MAX_TASKS             20
+/** frequency of portGET_RUN_TIME_COUNTER_VALUE() */
+#define configRUN_TIME_COUNTER_HZ            32768
+/** RTOS::Trace records task switches, queue operations and errors */
+#define configUSE_TRACE_RECORDER             1
+/** records of 8 bytes in the trace ring, power of two */
+#define configTRACE_RECORDS                  256
+/** frequency of rtosTraceTimestampGet(), TIMER4, see TracePort.cpp in NordicAL */
+#define configTRACE_TIMESTAMP_HZ             1000000
 
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
@@ -225,8 +238,38 @@ extern uint32_t SystemCoreClock;
  */
 #define configUSE_DISABLE_TICK_AUTO_CORRECTION_DEBUG 0
 
+#if !(defined(__ASSEMBLY__) || defined(__ASSEMBLER__))
+#ifdef __cplusplus
+extern "C" {
+#endif
+/** context switches in total and per task number, see RTOS::Profiler */
+extern volatile uint32_t rtosContextSwitchCount;
+extern volatile uint32_t rtosTaskSwitchCounts[configPROFILER_MAX_TASKS];
+/** run time counter for run time stats, implemented by the platform */
+void     rtosRunTimeCounterInit(void);
+uint32_t rtosRunTimeCounterGet(void);
+/** records a task switch if RTOS::Trace is enabled */
+void     rtosTraceTaskSwitchedIn(uint32_t taskNumber);
+#ifdef __cplusplus
+}
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() rtosRunTimeCounterInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()         rtosRunTimeCounterGet()
+#endif /* !assembler */
+
 #ifdef ENABLE_SYSVIEW_TRACE
 #include "SEGGER_SYSVIEW_FreeRTOS.h"
+#elif !(defined(__ASSEMBLY__) || defined(__ASSEMBLER__))
+#define traceTASK_SWITCHED_IN()                                         \
+    do {                                                                \
+        rtosContextSwitchCount++;                                       \
+        if (pxCurrentTCB->uxTCBNumber < configPROFILER_MAX_TASKS) {     \
+            rtosTaskSwitchCounts[pxCurrentTCB->uxTCBNumber]++;          \
+        }                                                               \
+        if (configUSE_TRACE_RECORDER) {                                 \
+            rtosTraceTaskSwitchedIn(pxCurrentTCB->uxTCBNumber);         \
+        }                                                               \
+    } while (0)
 #endif
 
 #endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,151 @@
+/**
+ * @file AL_AsyncObserver.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief observer that handles notifications in its own task
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_ASYNCOBSERVER_H__
+#define __AL_ASYNCOBSERVER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <stddef.h>
+
+namespace RTOS
+{
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+class AsyncObserver;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Mutex.h"
+#include "AL_Queue.h"
+#include "AL_Task.h"
+
+#include <Error.h>
+#include <Observable.h>
+#include <Observer.h>
+#include <atomic>
+#include <type_traits>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+/**
+ * @brief what an AsyncObserver does when its queue is full.
+ *
+ */
+enum class Overflow {
+    DropNewest, /**< the new message is dropped */
+    DropOldest, /**< the oldest queued message makes room for the new one */
+    Block /**< the triggering task waits, up to the block timeout */
+};
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Observer that decouples a slow subscriber from the Observable.
+ *
+ * @details handle() runs in the task that triggers the Observable. It only
+ * constructs a MessageT from the arguments and queues it, onMessage() is
+ * called later from the observer's own task. A flash write in onMessage()
+ * thus does not stall e.g. the scanner task.
+ *
+ * The queue is bounded, the Overflow policy decides what happens once the
+ * subscriber can not keep up. Dropped messages are counted per observer.
+ * With Overflow::DropOldest the triggering task removes the oldest message
+ * itself. All receives then go through receiveMutex, the observer task only
+ * waits for data with Queue::peek() outside of it.
+ *
+ * Arguments of the Observable are often references that are only valid
+ * during trigger(), MessageT has to copy everything it needs.
+ *
+ * @code
+ * struct Sighting {
+ *     IO::BLE::Address address;
+ *     IO::BLE::RxPower rssi;
+ *     Sighting(const Device& device, const bool&, const ParsedAdvData&);
+ * };
+ * class Logger : public RTOS::AsyncObserver<Sighting, 16, 256,
+ *                                           const Device&, const bool&,
+ *                                           const ParsedAdvData&> {
+ *     void onMessage(const Sighting& sighting) final;
+ * };
+ * @endcode
+ *
+ * @tparam MessageT trivially copyable, constructible from the arguments of
+ * the Observable.
+ * @tparam queueLength messages that can wait for the observer task.
+ * @tparam stackSize stack of the observer task in sizeof(StackType_t).
+ * @tparam ObservableParamTypes parameters of the observed Observable.
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+class AsyncObserver : public Patterns::Observer<ObservableParamTypes...> {
+    static_assert(std::is_trivially_copyable<MessageT>::value,
+                  "messages are copied byte wise by the queue");
+
+    using TaskType = Task<stackSize, AsyncObserver>;
+    friend TaskType;
+
+public:
+    // delete default constructors
+    AsyncObserver()                           = delete;
+    AsyncObserver(const AsyncObserver& other) = delete;
+    AsyncObserver& operator=(const AsyncObserver& other) = delete;
+
+    uint32_t getDropped() const;
+    uint32_t getDelivered() const;
+
+protected:
+    AsyncObserver(Patterns::Observable<ObservableParamTypes...>& observable,
+                  const char* const                              name,
+                  uint8_t                                        priority,
+                  Overflow                                       policy,
+                  milliseconds blockTimeout = Infinity);
+
+    /**
+     * @brief implement this to react to the Observable.
+     * Called from the observer task, one message at a time.
+     *
+     * @param message Constructed from the arguments of the trigger.
+     */
+    virtual void onMessage(const MessageT& message) = 0;
+
+private:
+    // Patterns::Observer
+    virtual void
+        handle(Patterns::Observable<ObservableParamTypes...>& observable,
+               ObservableParamTypes... params) final;
+
+    // RTOS::Task
+    void onStart();
+    void onRun();
+
+    const Overflow     policy; /**< reaction on a full queue */
+    const milliseconds blockTimeout; /**< longest wait for Overflow::Block */
+    std::atomic<uint32_t> dropped; /**< messages that never got delivered */
+    std::atomic<uint32_t> delivered; /**< messages passed to onMessage() */
+    Queue<MessageT, queueLength> queue; /**< messages waiting for the task */
+    /** serializes the receives of both sides for Overflow::DropOldest */
+    Mutex receiveMutex;
+    /** instantiate after all other RTOS objects */
+    TaskType task;
+};
+}  // namespace RTOS
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/AL_AsyncObserver.cpp"
+#endif  //__AL_ASYNCOBSERVER_H__
@@ -0,0 +1,75 @@
+/**
+ * @file AL_CoExecutor.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RTOS task running stackless CoTasks
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_COEXECUTOR_H__
+#define __AL_COEXECUTOR_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <stddef.h>
+
+namespace RTOS
+{
+template<size_t StackSize>
+class CoExecutor;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CoTask.h"
+#include "AL_Task.h"
+
+#include <stdint.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief RTOS task that runs CoTasks.
+ *
+ * @details Size the stack for the deepest onResume() of all CoTasks, it is
+ * shared by all of them. All CoTasks run at the priority of the executor.
+ *
+ * @example
+ * ```cpp
+ * static RTOS::CoExecutor<512> executor {"Executor", 1};
+ * ```
+ *
+ * @tparam StackSize Size of the task stack
+ */
+template<size_t StackSize>
+class CoExecutor : public CoExecutorBase {
+    friend Task<StackSize, CoExecutor>;
+
+public:
+    // delete default constructors
+    CoExecutor()                        = delete;
+    CoExecutor(const CoExecutor& other) = delete;
+    CoExecutor& operator=(const CoExecutor& other) = delete;
+
+    CoExecutor(const char* const name, uint8_t priority);
+
+private:
+    // task interface
+    void onStart();
+    void onRun();
+
+    /** instantiate after all other RTOS objects */
+    Task<StackSize, CoExecutor> task;
+};
+}  // namespace RTOS
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/AL_CoExecutor.cpp"
+#endif  //__AL_COEXECUTOR_H__
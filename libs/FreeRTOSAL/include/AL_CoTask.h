@@ -0,0 +1,248 @@
+/**
+ * @file AL_CoTask.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief stackless tasks sharing one RTOS task
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_COTASK_H__
+#define __AL_COTASK_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace RTOS
+{
+class Await;
+class CoTask;
+class CoExecutorBase;
+}  // namespace RTOS
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Event.h"
+#include "AL_EventGroup.h"
+#include "AL_Mutex.h"
+#include "AL_Queue.h"
+#include "AL_RTOS.h"
+#include "FreeRTOSUtility.h"
+
+#include <Error.h>
+#include <FreeRTOS.h>
+#include <event_groups.h>
+#include <stdint.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief What a CoTask waits for until it gets resumed next.
+ *
+ * @details Returned by CoTask::onResume(). The CoTask gets resumed with
+ * Error::None once the condition is met, or with Error::Timeout when the
+ * timeout passed first. Events (also the send event of a queue) have to be
+ * part of the event group of the executor, otherwise the CoTask gets resumed
+ * with Error::InvalidParameter right away.
+ */
+class Await {
+    friend class CoExecutorBase;
+    friend class CoTask;
+
+public:
+    static Await event(Event& event, milliseconds timeout = Infinity);
+    static Await obtain(Mutex& mutex, milliseconds timeout = Infinity);
+    static Await delay(milliseconds time);
+    static Await finished();
+
+    /**
+     * @brief wait until any of the events got triggered.
+     * Events are not reset, same as with Event::await().
+     *
+     * @param events Events to wait for.
+     * @param timeout Maximum time to wait.
+     * @return Await condition to return from CoTask::onResume()
+     */
+    template<size_t numberEvents>
+    static Await anyEvent(const EventList<numberEvents>& events,
+                          milliseconds                   timeout = Infinity)
+    {
+        Await await {Kind::Events, timeout};
+        await.group = events[0]->group;
+        for (const auto* event : events) {
+            if (event->group != await.group) {
+                // all events have to be in the same group
+                await.kind = Kind::Invalid;
+            }
+            await.bits |= event->bit;
+        }
+        return await;
+    }
+
+    /**
+     * @brief wait until an object could be received from the queue.
+     *
+     * @details The queue needs a send event (Queue::setSendEvent()) to
+     * wake up the executor.
+     *
+     * @param queue Queue to receive from.
+     * @param outObject Gets the object move assigned, has to stay valid
+     * until the CoTask got resumed.
+     * @param timeout Maximum time to wait.
+     * @return Await condition to return from CoTask::onResume()
+     */
+    template<class T, size_t queueLength>
+    static Await receive(Queue<T, queueLength>& queue,
+                         T&                     outObject,
+                         milliseconds           timeout = Infinity)
+    {
+        if (queue.sendEvent == nullptr) {
+            // executor could never wake up for it
+            return Await {Kind::Invalid, timeout};
+        }
+
+        Await await {Kind::Poll, timeout};
+        await.group  = queue.sendEvent->group;
+        await.bits   = queue.sendEvent->bit;
+        await.object = &queue;
+        await.out    = &outObject;
+        await.poll   = &pollReceive<T, queueLength>;
+        return await;
+    }
+
+private:
+    /**
+     * @brief kinds of conditions, the executor handles them differently
+     */
+    enum class Kind : uint8_t {
+        Events, /**< any of bits set in group */
+        Poll, /**< poll() returns true, bits only used for wakeup */
+        Delay, /**< only timeout */
+        Finished, /**< never resumed again */
+        Invalid, /**< resumed with InvalidParameter right away */
+    };
+
+    /** checks and consumes the condition, has to be non blocking */
+    using PollFunction = bool (*)(void* object, void* out);
+
+    Await(Kind kind, milliseconds timeout);
+
+    static bool pollObtain(void* mutex, void* out);
+
+    /** clears wake bit before trying, so no send gets lost in between */
+    template<class T, size_t queueLength>
+    static bool pollReceive(void* queuePtr, void* out)
+    {
+        auto& queue = *static_cast<Queue<T, queueLength>*>(queuePtr);
+        queue.sendEvent->reset();
+        return queue.receive(*static_cast<T*>(out), 0) == Error::None;
+    }
+
+    Kind         kind;
+    TickType_t   timeoutTicks; /**< portMAX_DELAY for no timeout */
+    EventGroup*  group; /**< group of bits, nullptr if none */
+    EventBits_t  bits; /**< bits that wake the executor up */
+    PollFunction poll; /**< condition check for Kind::Poll */
+    void*        object; /**< object poll() works on */
+    void*        out; /**< output of poll() */
+};
+
+/**
+ * @brief Stackless task, runs on the stack of a CoExecutor.
+ *
+ * @details Instead of blocking, onResume() returns what to wait for and
+ * returns. The executor resumes it once that happened. All state that has
+ * to survive a wait must be kept in members, the same way a state machine
+ * would. Many CoTasks share the stack and the TCB of one RTOS task, which
+ * saves the RAM of a task per context. onResume() gets called the first
+ * time with Error::None after the executor started.
+ *
+ * @example
+ * ```cpp
+ * class Printer : public RTOS::CoTask {
+ *     RTOS::Await onResume(Error::Code result) final
+ *     {
+ *         if (result == Error::None && started) {
+ *             LOG_I("received %u", item);
+ *         }
+ *         started = true;
+ *         return RTOS::Await::receive(queue, item);
+ *     }
+ * };
+ * ```
+ *
+ * @warning onResume() must never block, all other CoTasks of the executor
+ * would be blocked as well. Mutexes obtained with Await::obtain() are owned
+ * by the executor task and have to be released from onResume() again.
+ */
+class CoTask {
+    friend class CoExecutorBase;
+
+public:
+    // delete default constructors
+    CoTask()                    = delete;
+    CoTask(const CoTask& other) = delete;
+    CoTask& operator=(const CoTask& other) = delete;
+
+    CoTask(CoExecutorBase& executor);
+    virtual ~CoTask();
+
+    bool isFinished() const;
+
+protected:
+    /**
+     * @brief continues the CoTask until it has to wait.
+     *
+     * @param result None if the awaited condition was met,
+     * Timeout if it timed out, InvalidParameter for a misconfigured Await.
+     * @return Await what to wait for before the next call.
+     */
+    virtual Await onResume(Error::Code result) = 0;
+
+private:
+    CoExecutorBase& executor;
+    CoTask*         next; /**< next CoTask of the executor */
+    Await           await; /**< current wait condition */
+    TickType_t      startTick; /**< when the current wait started */
+};
+
+/**
+ * @brief Runs CoTasks, independent of the stack size of the RTOS task.
+ * Use CoExecutor for instantiation.
+ *
+ * @details The executor resumes every CoTask whose condition is met, then
+ * blocks on the event group until any awaited event gets triggered or the
+ * nearest timeout passed. Mutexes can not wake the executor, so while a
+ * CoTask awaits one, the executor checks it every tick.
+ */
+class CoExecutorBase {
+    friend class CoTask;
+
+public:
+    // delete default constructors
+    CoExecutorBase(const CoExecutorBase& other) = delete;
+    CoExecutorBase& operator=(const CoExecutorBase& other) = delete;
+
+    EventGroup& getEventGroup();
+    size_t      getCoTaskCount();
+
+protected:
+    CoExecutorBase();
+
+    void runOnce();
+
+private:
+    EventGroup group; /**< group awaited events have to be part of */
+    CoTask*    first; /**< list of all CoTasks */
+
+    void add(CoTask& task);
+    void remove(CoTask& task);
+    bool isReady(CoTask& task, TickType_t now, Error::Code& result);
+};
+}  // namespace RTOS
+#endif  //__AL_COTASK_H__
@@ -0,0 +1,122 @@
+/**
+ * @file AL_CrashLog.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief failed error checks kept across restarts
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_CRASHLOG_H__
+#define __AL_CRASHLOG_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Diagnostics
+{
+class CrashLog;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Error.h>
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Diagnostics
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Ring of the last failed CHECK_ERROR()s, persisted by the platform.
+ * Pure static class.
+ *
+ * @details Error handling runs with interrupts disabled right before the
+ * restart, flash can not be written then. save() only puts the record into
+ * a RAM slot that is not initialized at startup and thus survives the
+ * restart. After the restart commit() moves it into the ring of a Store,
+ * e.g. a flash record.
+ *
+ * Records hold the error site ID, tools/ErrorSites maps it back to
+ * file:line.
+ *
+ * @warning Not thread safe, commit from one task only.
+ */
+class CrashLog {
+public:
+    /** records kept in the ring */
+    static constexpr size_t kRecords = 8;
+    /** task number of records saved before the scheduler started */
+    static constexpr uint8_t kNoTask = 0xFF;
+
+    /**
+     * @brief a single failed error check
+     *
+     */
+    struct Record {
+        uint32_t site; /**< error site ID, see Error::makeSite() */
+        uint32_t uptimeMs; /**< RTOS ticks since boot in ms, wraps */
+        uint16_t sequence; /**< counts committed records, 0 for empty */
+        uint8_t  code; /**< Error::Code */
+        uint8_t  task; /**< FreeRTOS task number or kNoTask */
+    };
+    static_assert(sizeof(Record) == 12, "Record layout changed");
+
+    /** persisted records, newest first */
+    using Ring = std::array<Record, kRecords>;
+
+    /**
+     * @brief persistent storage of the ring, implemented by the platform.
+     *
+     */
+    class Store {
+    public:
+        /**
+         * @brief Read the ring.
+         *
+         * @return Error::Code NotFound if nothing was stored yet.
+         */
+        virtual Error::Code load(Ring& ring) = 0;
+
+        /**
+         * @brief Replace the stored ring.
+         *
+         */
+        virtual Error::Code store(const Ring& ring) = 0;
+    };
+
+    // delete default constructors
+    CrashLog()                      = delete;
+    CrashLog(const CrashLog& other) = delete;
+    CrashLog& operator=(const CrashLog& other) = delete;
+
+    static void        save(Error::Code code, uint32_t site);
+    static bool        hasPending();
+    static Error::Code commit(Store& store);
+    static Error::Code read(Store& store, size_t age, Record& record);
+
+private:
+    /**
+     * @brief record that waits for commit(), survives a soft restart
+     *
+     */
+    struct Pending {
+        uint32_t magic; /**< kMagic if record is valid */
+        Record   record; /**< saved record, sequence not set yet */
+        uint32_t check; /**< checksum over magic and record */
+    };
+
+    /** marks a valid pending record */
+    static constexpr uint32_t kMagic = 0xC4A5410Cu;
+
+    static uint32_t checksum(const Pending& pending);
+
+    static Pending pending;
+};
+}  // namespace Diagnostics
+#endif  //__AL_CRASHLOG_H__
@@ -24,7 +24,7 @@ class Event;
  *
  * @tparam N
  */
-template <size_t N>
+template <std::size_t N>
 using EventList = std::array<const Event*, N>;
 }  // namespace RTOS
 
@@ -49,6 +49,8 @@ namespace RTOS
 class Event {
     // befriend EventGroup to access bit
     friend class EventGroup;
+    // befriend Await to wait for bit from an executor
+    friend class Await;
     // structs and enums
 public:
     // constructors
@@ -47,6 +47,11 @@ class EventGroup
      *
      */
     friend class Event;
+    /**
+     * @brief befriend executor to wait for the events its CoTasks await
+     *
+     */
+    friend class CoExecutorBase;
 
     // structs and enums
 public:
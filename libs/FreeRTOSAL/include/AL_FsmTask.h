@@ -0,0 +1,98 @@
+/**
+ * @file AL_FsmTask.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief state machine driven by events from a queue
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_FSMTASK_H__
+#define __AL_FSMTASK_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <stddef.h>
+
+namespace RTOS
+{
+template<class Definition, size_t queueLength, size_t stackSize>
+class FsmTask;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Queue.h"
+#include "AL_Task.h"
+
+#include <Error.h>
+#include <Fsm.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Runs a Patterns::Fsm in its own task.
+ *
+ * @details Events are posted to a bounded queue from any task or ISR, the
+ * task sleeps until one arrives and dispatches it. Nothing polls the state,
+ * so the MCU only wakes up if something actually happened.
+ *
+ * All actions run in the task of the FsmTask, starting with the entry actions
+ * of the initial state. Actions may post further events, those are handled
+ * after the current one.
+ *
+ * @code
+ * static RTOS::FsmTask<SensorMachine, 8, 256> sensorTask {sensor, "sensor", 2};
+ *
+ * void onDataReadyInterrupt()
+ * {
+ *     CHECK_ERROR(sensorTask.postFromISR(SensorMachine::Event::DataReady));
+ * }
+ * @endcode
+ *
+ * @tparam Definition state machine, see Patterns::Fsm.
+ * @tparam queueLength events that can wait for the task.
+ * @tparam stackSize stack of the task in sizeof(StackType_t).
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+class FsmTask {
+    using TaskType = Task<stackSize, FsmTask>;
+    friend TaskType;
+
+public:
+    using Context = typename Definition::Context;
+    using State   = typename Definition::State;
+    using Event   = typename Definition::Event;
+
+    // delete default constructors
+    FsmTask()                     = delete;
+    FsmTask(const FsmTask& other) = delete;
+    FsmTask& operator=(const FsmTask& other) = delete;
+
+    FsmTask(Context& context, const char* const name, uint8_t priority);
+
+    Error::Code post(Event event, milliseconds timeout = 0);
+    Error::Code postFromISR(Event event, bool* contextSwitchNeeded = nullptr);
+    State       getState() const;
+
+private:
+    // RTOS::Task
+    void onStart();
+    void onRun();
+
+    Patterns::Fsm<Definition> fsm; /**< only touched by the task */
+    Queue<Event, queueLength> queue; /**< events waiting for dispatch */
+    /** instantiate after all other RTOS objects */
+    TaskType task;
+};
+}  // namespace RTOS
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/AL_FsmTask.cpp"
+#endif  //__AL_FSMTASK_H__
@@ -41,6 +41,21 @@ class ITask
 {
     // structs and enums
 public:
+    /**
+     * @brief what a task does after each onRun() of its context
+     *
+     */
+    enum class RunMode {
+        /** yield to tasks of same priority after every onRun() (default) */
+        Yield,
+        /**
+         * no forced yield. For consumers that drain everything available per
+         * onRun(), e.g. with Queue::receiveBatch(), so a burst of items costs
+         * one context switch instead of one per item.
+         */
+        Batch
+    };
+
     // constructors
 public:
     // exposed functions
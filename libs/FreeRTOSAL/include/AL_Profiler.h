@@ -0,0 +1,133 @@
+/**
+ * @file AL_Profiler.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief per task CPU usage, context switches and stack usage
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_PROFILER_H__
+#define __AL_PROFILER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace RTOS
+{
+class Profiler;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_RTOS.h"
+
+#include <Error.h>
+#include <FreeRTOS.h>
+#include <array>
+#include <stddef.h>
+#include <task.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Collects CPU usage, context switches and stack high water mark of
+ * every task, based on the FreeRTOS run time stats.
+ *
+ * @details Each sample() covers the time since the previous one, so CPU
+ * usage and switch counts are averages over the sample interval. The run
+ * time counter is implemented by the platform, see
+ * portGET_RUN_TIME_COUNTER_VALUE() in FreeRTOSConfig.h.
+ *
+ * Tasks are told apart by their FreeRTOS task number, which counts task
+ * creations. Only the first configPROFILER_MAX_TASKS - 1 created tasks are
+ * tracked, later ones report run time since scheduler start and no
+ * context switches.
+ *
+ * @warning Not thread safe, sample from one task only.
+ */
+class Profiler {
+public:
+    /** maximum number of tasks in a snapshot */
+    static constexpr size_t kMaxTasks = configPROFILER_MAX_TASKS;
+    /** task names get truncated to this length in a snapshot */
+    static constexpr size_t kNameLength = 8;
+    /** incremented whenever the snapshot layout changes */
+    static constexpr uint8_t kSnapshotVersion = 1;
+
+    /**
+     * @brief statistics of a single task over the last sample interval.
+     *
+     */
+    struct __attribute__((packed)) TaskSample {
+        /** task name, not 0 terminated if it fills the array */
+        char     name[kNameLength];
+        /** FreeRTOS task number, counts task creations */
+        uint8_t  taskNumber;
+        /** current priority */
+        uint8_t  priority;
+        /** share of CPU time in 1/1000 */
+        uint16_t cpuPermille;
+        /** number of times the task got switched in */
+        uint32_t switches;
+        /** minimum free stack ever, in sizeof(StackType_t) */
+        uint16_t stackHighWaterMark;
+    };
+
+    /**
+     * @brief all tasks over the last sample interval.
+     * Little endian, ready to be served as raw bytes e.g. over GATT.
+     *
+     */
+    struct __attribute__((packed)) Snapshot {
+        /** kSnapshotVersion */
+        uint8_t    version;
+        /** valid entries in tasks */
+        uint8_t    taskCount;
+        /** share of CPU time spent outside of the idle task in 1/1000 */
+        uint16_t   cpuLoadPermille;
+        /** length of the sample interval in ms */
+        uint32_t   intervalMs;
+        /** context switches of all tasks within the interval */
+        uint32_t   switches;
+        /** ordered by task number */
+        TaskSample tasks[kMaxTasks];
+    };
+
+    /** snapshot as raw bytes */
+    using PackedSnapshot = std::array<uint8_t, sizeof(Snapshot)>;
+
+    // delete default constructors
+    Profiler()                      = delete;
+    Profiler(const Profiler& other) = delete;
+    Profiler& operator=(const Profiler& other) = delete;
+
+    static Error::Code     sample();
+    static const Snapshot& getSnapshot();
+    static void            getPackedSnapshot(PackedSnapshot& outPacked);
+    static const char*     getTaskName(size_t index);
+
+private:
+    static uint32_t getTaskSwitches(UBaseType_t taskNumber);
+    static uint16_t permille(uint32_t part, uint32_t total);
+
+    /** buffer for uxTaskGetSystemState() */
+    static std::array<TaskStatus_t, kMaxTasks> taskStates;
+    /** run time of every task number at the last sample */
+    static std::array<uint32_t, kMaxTasks> lastRunTimes;
+    /** context switches of every task number at the last sample */
+    static std::array<uint32_t, kMaxTasks> lastSwitches;
+    /** total run time at the last sample */
+    static uint32_t lastTotalRunTime;
+    /** total context switches at the last sample */
+    static uint32_t lastTotalSwitches;
+    /** result of the last sample */
+    static Snapshot snapshot;
+};
+}  // namespace RTOS
+#endif  //__AL_PROFILER_H__
@@ -20,16 +20,21 @@ namespace RTOS
 {
 template<class T, size_t queueLength>
 class Queue;
+class Event;
 }
 
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "AL_RTOS.h"
+#include "AL_Trace.h"
 #include "FreeRTOSUtility.h"
 
 #include <Error.h>
 #include <FreeRTOS.h>
+#include <array>
 #include <queue.h>
+#include <task.h>
+#include <type_traits>
 
 namespace RTOS
 {
@@ -40,6 +45,25 @@ namespace RTOS
 /**
  * @brief Queue for inter process communication
  *
+ * @details FreeRTOS copies objects byte wise into and out of the queue
+ * storage. Objects therefore are relocated with memcpy and T must at least
+ * tolerate that (no self references, no registration by address).
+ * Objects that own resources (e.g. raw pointers to heap) may be used with
+ * send()/emplace()/receive(), as ownership is handed over through the
+ * queue. receiveInto() overwrites the target without destructing it and
+ * therefore requires T to be trivially copyable.
+ *
+ * Zero copy API for hot paths:
+ * - emplace() constructs the object right before handing it to FreeRTOS,
+ *   no temporary of the caller is needed.
+ * - receiveInto() lets FreeRTOS copy directly into the callers object.
+ * - peekRef() gives read access to the oldest element inside the queue
+ *   storage, drop() removes it afterwards. Only for queues with a single
+ *   consumer task, see peekRef().
+ *
+ * Consumers that get items in bursts should use receiveBatch() together with
+ * RTOS::ITask::RunMode::Batch, which drains the queue with one wakeup.
+ *
  * @tparam T type of data segement in queue
  * @tparam queueLength number of T object that can be stored in queue
  */
@@ -56,9 +80,21 @@ public:
     Error::Code       send(const T&& object, milliseconds timeoutMs = Infinity);
     Error::Code       sendFromISR(const T&& object,
                                   bool*     contextSwitchNeeded = nullptr);
+    template<class... Args>
+    Error::Code       emplace(milliseconds timeoutMs, Args&&... args);
     Error::Code       receive(T& outObject, milliseconds timeoutMs = Infinity);
     Error::Code       receiveFromISR(T&    outObject,
                                      bool* contextSwitchNeeded = nullptr);
+    Error::Code       receiveInto(T&           outObject,
+                                  milliseconds timeoutMs = Infinity);
+    template<size_t batchSize>
+    Error::Code       receiveBatch(std::array<T, batchSize>& outObjects,
+                                   size_t&                   count,
+                                   milliseconds timeoutMs = Infinity);
+    Error::Code       peek(T& outObject, milliseconds timeoutMs = Infinity);
+    Error::Code       peekRef(const T*& outRef);
+    Error::Code       drop();
+    void              setSendEvent(Event* event);
     const char* const getName();
     // private variables
 private:
@@ -76,7 +112,49 @@ private:
      * @brief buffer used by FreeRTOS to copy stored objects to.
      *
      */
-    uint8_t buffer[sizeof(T) * queueLength];
+    alignas(T) uint8_t buffer[sizeof(T) * queueLength];
+    /**
+     * @brief index of the oldest element in buffer.
+     * Only maintained by the consumer side for peekRef().
+     * Follows the FreeRTOS read position as long as elements only leave in
+     * FIFO order through one consumer. This is why this class offers neither
+     * sending to the front nor resetting the queue.
+     *
+     */
+    size_t readIndex;
+    /**
+     * @brief task that received first, nullptr before.
+     *
+     */
+    TaskHandle_t consumer;
+    /**
+     * @brief cleared for good once a second task or an ISR received,
+     * readIndex can not be trusted from then on.
+     *
+     */
+    bool isSingleConsumer;
+    /**
+     * @brief triggered after every successful send, might be nullptr.
+     * Lets RTOS::CoExecutor wake up for RTOS::Await::receive().
+     *
+     */
+    Event* sendEvent;
+    /**
+     * @brief number of this queue in RTOS::Trace events, 0 if untracked.
+     *
+     */
+    uint8_t traceNumber;
+
+    friend class Await;
+
+    /** traces and triggers sendEvent after an element got in */
+    void onSent();
+    /** advances readIndex and traces after an element left the queue */
+    void onReceived(TaskHandle_t receiver);
+    /** whether the calling task may use peekRef() and drop() */
+    bool isPeekAllowed();
+    /** queue number and fill level for RTOS::Trace */
+    uint32_t getTraceArg();
 };
 }  // namespace RTOS
 
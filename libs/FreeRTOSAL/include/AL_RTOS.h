@@ -55,6 +55,7 @@ constexpr milliseconds Infinity = std::numeric_limits<int64_t>::max();
 void         init();
 void         yieldToSchedulerFromISR();
 milliseconds getTime();
+uint32_t     getContextSwitchCount();
 
 }  // namespace RTOS
 #endif  //__AL_RTOS_H__
\ No newline at end of file
@@ -0,0 +1,102 @@
+/**
+ * @file AL_Simulation.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief virtual time for host simulations
+ * @version 1.0
+ * @date 2020-11-06
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_SIMULATION_H__
+#define __AL_SIMULATION_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace RTOS
+{
+class Simulation;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_RTOS.h"
+
+#include <FreeRTOS.h>
+#include <cstdint>
+#include <task.h>
+
+/** idle hook of the simulation, see portSUPPRESS_TICKS_AND_SLEEP() */
+extern "C" void rtosSimulationSkipTicks(uint32_t expectedIdleTicks);
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Lets the RTOS time run faster than real time, so hours of timers,
+ * periodic tasks and timeouts pass in milliseconds.
+ *
+ * @details Active if the platform sets configUSE_SIMULATION, which the host
+ * build does with `make host run SIMULATION=1`. The idle task then does not
+ * wait for the next tick: whenever all tasks are blocked, the tick count
+ * jumps straight to the next point in time a task or timer is due (tickless
+ * idle that sleeps for zero time). RTOS::getTime(), delays, timeouts,
+ * RTOS::Timer and RTOS::PeriodicTask all follow this virtual clock, so does
+ * the run time counter of the host.
+ *
+ * The tick keeps running in real time in between, so code that busy waits
+ * or relies on time slicing behaves as before. Nothing is skipped while any
+ * task is ready.
+ *
+ * random() is a deterministic generator for simulated inputs (RSSI, packet
+ * loss, ...). The host build seeds it from the environment variable
+ * SIMULATION_SEED, so a failing run can be repeated.
+ */
+class Simulation {
+public:
+    // delete default constructors
+    Simulation()                        = delete;
+    Simulation(const Simulation& other) = delete;
+    Simulation& operator=(const Simulation& other) = delete;
+
+    static constexpr bool isActive();
+    static uint64_t       getSkippedTicks();
+    static milliseconds   getSkippedTime();
+    static uint32_t       getSkips();
+
+    static void     seed(uint32_t value);
+    static uint32_t getSeed();
+    static uint32_t random();
+    static uint32_t random(uint32_t min, uint32_t max);
+
+private:
+    friend void ::rtosSimulationSkipTicks(uint32_t expectedIdleTicks);
+
+    static void skip(uint32_t expectedIdleTicks);
+
+    /** ticks jumped over in total, only written by the idle task */
+    static volatile uint64_t skippedTicks;
+    /** number of jumps */
+    static volatile uint32_t skips;
+    /** last value passed to seed() */
+    static uint32_t seedValue;
+    /** state of the xorshift generator, never 0 */
+    static uint32_t randomState;
+};
+
+//---------------------------- INLINE FUNCTIONS -------------------------------
+
+/**
+ * @brief Check whether the RTOS runs in virtual time.
+ *
+ */
+constexpr bool Simulation::isActive()
+{
+    return configUSE_SIMULATION != 0;
+}
+}  // namespace RTOS
+#endif  //__AL_SIMULATION_H__
@@ -0,0 +1,122 @@
+/**
+ * @file AL_SpscRing.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief lock-free single producer single consumer ring buffer
+ * @version 1.0
+ * @date 2020-10-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_SPSCRING_H__
+#define __AL_SPSCRING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <stddef.h>
+
+namespace RTOS
+{
+template<class T, size_t capacity>
+class SpscRing;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_RTOS.h"
+#include "FreeRTOSUtility.h"
+
+#include <Error.h>
+#include <FreeRTOS.h>
+#include <atomic>
+#include <task.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Lock-free ring buffer for handing objects from exactly one producer
+ * to exactly one consumer task.
+ *
+ * @details Other than RTOS::Queue, pushing neither enters a critical section
+ * nor touches the scheduler, unless the consumer is actually blocked waiting
+ * for data. The consumer is woken by a direct to task notification, so the
+ * notification value of the consumer task must not be used for anything else.
+ *
+ * Producer side: tryPush() / tryPushFromISR(), never block.
+ * Consumer side: pop() / peekRef() block until data arrives, drop() releases
+ * the element obtained with peekRef().
+ *
+ * @warning Only one producer (one task or one ISR) and one consumer task.
+ *
+ * @tparam T type of the stored objects
+ * @tparam capacity number of objects that fit, must be a power of 2
+ */
+template<class T, size_t capacity>
+class SpscRing {
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0,
+                  "capacity of SpscRing must be a power of 2");
+
+public:
+    // delete default constructors
+    SpscRing(const SpscRing& other) = delete;
+    SpscRing& operator=(const SpscRing& other) = delete;
+
+    SpscRing();
+    ~SpscRing();
+
+    Error::Code tryPush(const T& object);
+    Error::Code tryPushFromISR(const T& object,
+                               bool*    contextSwitchNeeded = nullptr);
+    Error::Code pop(T& outObject, milliseconds timeout = Infinity);
+    Error::Code peekRef(const T*& outRef, milliseconds timeout = Infinity);
+    Error::Code drop();
+    size_t      size() const;
+    bool        isEmpty() const;
+
+private:
+    /**
+     * @brief index mask, counters run freely and are masked on access
+     *
+     */
+    static constexpr size_t kMask = capacity - 1;
+
+    T*          slot(size_t counter);
+    Error::Code put(const T& object);
+    bool        waitForData(milliseconds timeout);
+
+    /**
+     * @brief storage for the objects, constructed on push, destructed on pop
+     *
+     */
+    alignas(T) uint8_t storage[sizeof(T) * capacity];
+    /**
+     * @brief number of pushed objects, only written by producer
+     *
+     */
+    std::atomic<size_t> head;
+    /**
+     * @brief number of popped objects, only written by consumer
+     *
+     */
+    std::atomic<size_t> tail;
+    /**
+     * @brief set by the consumer while it blocks for data
+     *
+     */
+    std::atomic<bool> consumerWaiting;
+    /**
+     * @brief task to notify when data arrives
+     *
+     */
+    TaskHandle_t consumer;
+};
+}  // namespace RTOS
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/AL_SpscRing.cpp"
+#endif  //__AL_SPSCRING_H__
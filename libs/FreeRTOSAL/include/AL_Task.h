@@ -66,6 +66,12 @@ namespace RTOS
  * 
  * static Mycontext context1{};
  * ```
+ *
+ * By default the task yields after every onRun(). Consumers that process
+ * everything available per onRun() can pass RunMode::Batch to skip that.
+ *
+ * @warning In RunMode::Batch onRun() has to block eventually, otherwise tasks
+ * of same priority never get to run (time slicing is disabled).
  */
 template<size_t StackSize, class ContextT>
 class Task : public RTOS::ITask {
@@ -78,7 +84,10 @@ public:
     Task(const Task& other) = delete;
     Task& operator=(const Task& other) = delete;
 
-    Task(ContextT& context, const char* const name, uint8_t priority);
+    Task(ContextT&         context,
+         const char* const name,
+         uint8_t           priority,
+         RunMode           mode = RunMode::Yield);
     ~Task();
 
     const char* const getName();
@@ -90,11 +99,13 @@ public:
     virtual void delay(milliseconds time) final;
 
 private:
+    ContextT&     context; /**< Context that implements the task */
+    const RunMode mode; /**< Whether to yield after every onRun() */
     TaskHandle_t handle; /**< Handle of the task used by FreeRTOS */
     StaticTask_t data; /**< Data needed by FreeRTOS to manage this task */
     StackType_t  stack[StackSize]; /**< Static memory for task stack */
 
-    static void runRedirect(void* contextPtr);
+    static void runRedirect(void* taskPtr);
 };
 }  // namespace RTOS
 
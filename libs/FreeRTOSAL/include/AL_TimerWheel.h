@@ -0,0 +1,130 @@
+/**
+ * @file AL_TimerWheel.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief many software timers driven by a single RTOS timer
+ * @version 1.0
+ * @date 2020-10-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_TIMERWHEEL_H__
+#define __AL_TIMERWHEEL_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <stddef.h>
+
+namespace RTOS
+{
+template<size_t slotCount>
+class TimerWheel;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_RTOS.h"
+#include "AL_Timer.h"
+
+#include <Error.h>
+#include <FreeRTOS.h>
+#include <array>
+#include <stdint.h>
+#include <task.h>
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Hashed timing wheel for large numbers of timeouts with the same
+ * coarse resolution, e.g. one activity timeout per BLE device.
+ *
+ * @details Entries are linked intrusively into the slot of their expiry
+ * tick, (re)starting and stopping is O(1) and does not involve the kernel.
+ * Only a single RTOS::Timer ticks the wheel, it is started with the first
+ * active entry and stops once no entry is active anymore.
+ * Timeouts longer than slotCount * resolution are supported, such entries
+ * get skipped until their round comes.
+ *
+ * Entries expire between timeout and timeout + resolution after their last
+ * start(). onExpired() runs in the timer task, like RTOS::Timer::onTimer().
+ * Entries must only be used from task context.
+ *
+ * @warning An entry that gets restarted from another task while its
+ * expiration is being handled might still see onExpired(). Same as with
+ * RTOS::Timer.
+ *
+ * @tparam slotCount number of slots, timeouts up to slotCount * resolution
+ * are handled without rounds.
+ */
+template<size_t slotCount>
+class TimerWheel : private Timer {
+public:
+    /**
+     * @brief A single timeout inside the wheel.
+     * Implement onExpired() to react to it.
+     *
+     */
+    class Entry {
+        friend TimerWheel;
+
+    public:
+        // delete default constructors
+        Entry()                   = delete;
+        Entry(const Entry& other) = delete;
+        Entry& operator=(const Entry& other) = delete;
+
+        Entry(TimerWheel& wheel, milliseconds timeout);
+        virtual ~Entry();
+
+        void start();
+        void stop();
+        bool isActive() const;
+
+    protected:
+        /** gets called from the timer task once the timeout expired */
+        virtual void onExpired() = 0;
+
+    private:
+        TimerWheel&    wheel; /**< wheel this entry is part of */
+        const uint32_t timeoutTicks; /**< timeout in wheel ticks */
+        uint32_t       expiry; /**< wheel tick this entry expires at */
+        Entry*         next; /**< next entry in the same list */
+        Entry**        prevNext; /**< next pointer pointing here, nullptr if not linked */
+    };
+
+    // delete default constructors
+    TimerWheel()                        = delete;
+    TimerWheel(const TimerWheel& other) = delete;
+    TimerWheel& operator=(const TimerWheel& other) = delete;
+
+    TimerWheel(const char* const name, milliseconds resolution);
+
+    size_t       getActiveCount() const;
+    milliseconds getResolution() const;
+
+private:
+    const milliseconds resolution; /**< duration of a wheel tick */
+    std::array<Entry*, slotCount>
+                 slots; /**< list of entries expiring at slot index + n * slotCount */
+    uint32_t     now; /**< wheel ticks since creation */
+    size_t       activeCount; /**< number of linked entries */
+    bool         running; /**< whether the RTOS timer got started */
+
+    void link(Entry& entry);
+    void unlink(Entry& entry);
+    void startTimer();
+    void stopTimerIfEmpty();
+
+    // RTOS::Timer
+    virtual void onTimer() final;
+};
+}  // namespace RTOS
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/AL_TimerWheel.cpp"
+#endif  //__AL_TIMERWHEEL_H__
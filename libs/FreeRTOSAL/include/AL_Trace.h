@@ -0,0 +1,260 @@
+/**
+ * @file AL_Trace.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compact binary trace recorder in a RAM ring
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_TRACE_H__
+#define __AL_TRACE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace RTOS
+{
+class Trace;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Error.h>
+#include <FreeRTOS.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <task.h>
+
+/** trace timestamp and ISR number, implemented by the platform */
+extern "C" void     rtosTraceTimestampInit(void);
+extern "C" uint32_t rtosTraceTimestampGet(void);
+extern "C" uint32_t rtosTraceIsrNumber(void);
+
+//--------------------------------- MACROS ------------------------------------
+
+#if configUSE_TRACE_RECORDER
+/**
+ * @brief Records an event, arg is only evaluated if tracing is enabled.
+ *
+ */
+#define TRACE_EVENT(id, arg)                                            \
+    do {                                                                \
+        if (RTOS::Trace::isEnabled()) {                                 \
+            RTOS::Trace::event((id), (arg));                            \
+        }                                                               \
+    } while (0)
+/** first and last statement of a traced ISR */
+#define TRACE_ISR_ENTER() \
+    TRACE_EVENT(RTOS::Trace::IsrEnter, rtosTraceIsrNumber())
+#define TRACE_ISR_EXIT() TRACE_EVENT(RTOS::Trace::IsrExit, rtosTraceIsrNumber())
+#else
+#define TRACE_EVENT(id, arg) \
+    do {                     \
+    } while (0)
+#define TRACE_ISR_ENTER() TRACE_EVENT(0, 0)
+#define TRACE_ISR_EXIT()  TRACE_EVENT(0, 0)
+#endif
+
+namespace RTOS
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Flight recorder for timestamped events, written to a RAM ring of
+ * configTRACE_RECORDS records of 8 bytes.
+ *
+ * @details Recording an event reserves a slot with a single atomic add and
+ * writes timestamp, id and argument into it. No lock, no critical section,
+ * usable from any task and ISR. When the ring is full the oldest records
+ * get overwritten. A slot reads as id 0 until its event is complete, dumps
+ * leave such slots out.
+ *
+ * Recorded by the library itself once enabled:
+ * - every task switch (FreeRTOSConfig.h, traceTASK_SWITCHED_IN())
+ * - send and receive of every RTOS::Queue, with its fill level
+ * - every failed CHECK_ERROR(), through Port::traceError()
+ * - ISRs that use TRACE_ISR_ENTER() and TRACE_ISR_EXIT()
+ *
+ * Application events use ids from User on, e.g.
+ * TRACE_EVENT(RTOS::Trace::User + 1, value).
+ *
+ * dump() writes the records together with the names of tasks and queues to
+ * a Sink. tools/TraceConverter turns a dump into Chrome trace JSON, which
+ * chrome://tracing and Perfetto display.
+ *
+ * Timestamps come from rtosTraceTimestampGet() of the platform and count at
+ * configTRACE_TIMESTAMP_HZ. They are 32 bit, the converter unwraps them.
+ */
+class Trace {
+public:
+    /**
+     * @brief event ids, 8 bit.
+     *
+     */
+    enum Id : uint8_t {
+        TaskSwitchIn = 1, /**< arg: FreeRTOS task number */
+        IsrEnter, /**< arg: exception number */
+        IsrExit, /**< arg: exception number */
+        QueueSend, /**< arg: queue number | messages waiting << 8 */
+        QueueReceive, /**< arg: queue number | messages waiting << 8 */
+        ErrorCheck, /**< arg: line & 0xFFFF | Error::Code << 16 */
+        User = 0x40 /**< first id free for the application */
+    };
+
+    /**
+     * @brief single entry of the ring.
+     *
+     */
+    struct Record {
+        /** configTRACE_TIMESTAMP_HZ ticks */
+        uint32_t timestamp;
+        /** id in the upper 8 bit, argument in the lower 24 bit, 0 while the
+         * record is written */
+        uint32_t idAndArg;
+    };
+
+    /**
+     * @brief start of a dump, little endian.
+     *
+     */
+    struct __attribute__((packed)) DumpHeader {
+        /** kDumpMagic */
+        uint32_t magic;
+        /** kDumpVersion */
+        uint8_t  version;
+        uint8_t  reserved;
+        /** DumpName entries following the header */
+        uint16_t nameCount;
+        /** Record entries following the names, oldest first */
+        uint32_t recordCount;
+        /** records overwritten before the dump */
+        uint32_t lostRecords;
+        /** frequency of Record::timestamp */
+        uint32_t timestampHz;
+    };
+
+    /**
+     * @brief name of a task or queue in a dump.
+     *
+     */
+    struct __attribute__((packed)) DumpName {
+        /** NameKind */
+        uint8_t  kind;
+        uint8_t  reserved;
+        /** task number or queue number as used in the event args */
+        uint16_t number;
+        /** not 0 terminated if it fills the array */
+        char     name[12];
+    };
+
+    /** kind of a DumpName */
+    enum NameKind : uint8_t { TaskName = 0, QueueName = 1 };
+
+    /**
+     * @brief receives the bytes of a dump.
+     *
+     */
+    class Sink {
+    public:
+        virtual Error::Code write(const uint8_t* data, size_t length) = 0;
+    };
+
+    /** number of records in the ring */
+    static constexpr size_t kRecords = configTRACE_RECORDS;
+    /** largest argument, larger ones get truncated */
+    static constexpr uint32_t kMaxArg = 0xFFFFFF;
+    /** queues that get a number and keep their name for a dump */
+    static constexpr size_t kMaxQueues = 24;
+    /** "ATRC" */
+    static constexpr uint32_t kDumpMagic = 0x43525441;
+    /** incremented whenever the dump layout changes */
+    static constexpr uint8_t kDumpVersion = 1;
+
+    static_assert((kRecords & (kRecords - 1)) == 0,
+                  "configTRACE_RECORDS has to be a power of two");
+    static_assert(sizeof(Record) == 8, "records are 8 bytes");
+
+    // delete default constructors
+    Trace()                   = delete;
+    Trace(const Trace& other) = delete;
+    Trace& operator=(const Trace& other) = delete;
+
+    static void        enable();
+    static void        disable();
+    static inline bool isEnabled();
+    static inline void event(uint8_t id, uint32_t arg);
+    static void        clear();
+    static Error::Code dump(Sink& sink);
+
+    static uint8_t registerQueue(const char* name);
+    static void    unregisterQueue(uint8_t number);
+
+private:
+    static constexpr unsigned kIdShift = 24;
+    /** records copied to the stack per write to the Sink */
+    static constexpr size_t kDumpBatch = 16;
+
+    static Error::Code dumpAll(Sink& sink);
+    static Error::Code dumpNames(Sink& sink, size_t taskCount);
+    static Error::Code dumpRecords(Sink&    sink,
+                                   uint32_t first,
+                                   uint32_t span,
+                                   uint32_t count);
+    static bool        readRecord(uint32_t index, Record& record);
+
+    /** the ring */
+    static Record records[kRecords];
+    /** next slot to write, counts all events ever recorded */
+    static std::atomic<uint32_t> writeIndex;
+    /** events are dropped while false */
+    static std::atomic<bool> enabled;
+    /** queue number - 1 is the index of a slot */
+    static std::atomic<bool> queueSlotUsed[kMaxQueues];
+    /** names of the registered queues */
+    static char queueNames[kMaxQueues][sizeof(DumpName::name)];
+    /** buffer for uxTaskGetSystemState() in dump() */
+    static TaskStatus_t taskStates[configPROFILER_MAX_TASKS];
+};
+
+//---------------------------- INLINE FUNCTIONS -------------------------------
+
+/**
+ * @brief Check whether events get recorded.
+ * Inline, called for every event.
+ *
+ */
+inline bool Trace::isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Record an event, use TRACE_EVENT() instead.
+ * Inline, a few dozen cycles.
+ *
+ * @details The slot is marked unfinished first and id and argument are
+ * stored last with release order, so a dump that interrupts the event never
+ * reads a timestamp that does not belong to the id. Record stays a plain
+ * struct for the dump, hence the GCC builtins instead of std::atomic.
+ *
+ * @param id Id of the event, not 0.
+ * @param arg Argument, only the lower 24 bit are kept.
+ */
+inline void Trace::event(uint8_t id, uint32_t arg)
+{
+    uint32_t index  = writeIndex.fetch_add(1, std::memory_order_relaxed);
+    Record&  record = records[index & (kRecords - 1)];
+    __atomic_store_n(&record.idAndArg, 0, __ATOMIC_RELAXED);
+    std::atomic_thread_fence(std::memory_order_release);
+    record.timestamp = rtosTraceTimestampGet();
+    __atomic_store_n(&record.idAndArg,
+                     (static_cast<uint32_t>(id) << kIdShift) | (arg & kMaxArg),
+                     __ATOMIC_RELEASE);
+}
+}  // namespace RTOS
+#endif  //__AL_TRACE_H__
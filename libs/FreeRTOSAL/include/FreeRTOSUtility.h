@@ -41,6 +41,8 @@ namespace RTOS
  * 
  */
 class Utility {
+    friend class Await;
+    friend class CoExecutorBase;
     friend class CountingSemaphore;
     friend class Mutex;
     friend class EventGroup;
@@ -48,6 +50,8 @@ class Utility {
     friend class PeriodicTask;
     template<class T, size_t queueLength>
     friend class Queue;
+    template<class T, size_t capacity>
+    friend class SpscRing;
     friend class ITask;
     template<size_t StackSize, class ContextT>
     friend class Task;
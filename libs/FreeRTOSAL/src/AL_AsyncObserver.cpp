@@ -0,0 +1,167 @@
+/**
+ * @file AL_AsyncObserver.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief observer that handles notifications in its own task
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_AsyncObserver.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Subscribe to observable and create the observer task.
+ *
+ * @param observable Observable to subscribe to.
+ * @param name Name of the task and the queue.
+ * @param priority Priority of the observer task.
+ * @param policy What happens if the queue is full.
+ * @param blockTimeout Longest wait of the triggering task with
+ * Overflow::Block, the message is dropped afterwards.
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+RTOS::AsyncObserver<MessageT, queueLength, stackSize, ObservableParamTypes...>::
+    AsyncObserver(Patterns::Observable<ObservableParamTypes...>& observable,
+                  const char* const                              name,
+                  uint8_t                                        priority,
+                  Overflow                                       policy,
+                  milliseconds blockTimeout)
+        : Patterns::Observer<ObservableParamTypes...>(observable),
+          policy(policy), blockTimeout(blockTimeout), dropped(0), delivered(0),
+          queue(name), receiveMutex(), task(*this, name, priority)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Number of messages dropped because the queue was full.
+ *
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+uint32_t RTOS::AsyncObserver<MessageT,
+                             queueLength,
+                             stackSize,
+                             ObservableParamTypes...>::getDropped() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Number of messages handled by onMessage().
+ *
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+uint32_t RTOS::AsyncObserver<MessageT,
+                             queueLength,
+                             stackSize,
+                             ObservableParamTypes...>::getDelivered() const
+{
+    return delivered.load(std::memory_order_relaxed);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Queues a message, runs in the task that triggers the Observable.
+ *
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+void RTOS::
+    AsyncObserver<MessageT, queueLength, stackSize, ObservableParamTypes...>::
+        handle(Patterns::Observable<ObservableParamTypes...>&,
+               ObservableParamTypes... params)
+{
+    milliseconds timeout = (policy == Overflow::Block) ? blockTimeout : 0;
+    if (queue.emplace(timeout, params...) == Error::None) {
+        return;
+    }
+
+    if (policy == Overflow::DropOldest) {
+        MessageT oldest;
+        CHECK_ERROR(receiveMutex.tryObtain());
+        // observer task might have emptied a slot meanwhile, nothing lost then
+        if (queue.receiveInto(oldest, 0) == Error::None) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+        CHECK_ERROR(receiveMutex.tryRelease());
+        if (queue.emplace(0, params...) == Error::None) {
+            return;
+        }
+    }
+    dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Nothing to prepare, the queue exists already.
+ *
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+void RTOS::AsyncObserver<MessageT,
+                         queueLength,
+                         stackSize,
+                         ObservableParamTypes...>::onStart()
+{}
+
+/**
+ * @brief Waits for the next message and hands it to onMessage().
+ *
+ */
+template<class MessageT,
+         size_t queueLength,
+         size_t stackSize,
+         class... ObservableParamTypes>
+void RTOS::AsyncObserver<MessageT,
+                         queueLength,
+                         stackSize,
+                         ObservableParamTypes...>::onRun()
+{
+    MessageT message;
+    if (policy != Overflow::DropOldest) {
+        // the only consumer, wait right in the receive
+        if (queue.receiveInto(message) != Error::None) {
+            return;
+        }
+    } else {
+        // triggering tasks receive too, do not block while holding the lock
+        if (queue.peek(message) != Error::None) {
+            return;
+        }
+        CHECK_ERROR(receiveMutex.tryObtain());
+        auto result = queue.receiveInto(message, 0);
+        CHECK_ERROR(receiveMutex.tryRelease());
+        if (result != Error::None) {
+            return;
+        }
+    }
+    onMessage(message);
+    delivered.fetch_add(1, std::memory_order_relaxed);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,61 @@
+/**
+ * @file AL_CoExecutor.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RTOS task running stackless CoTasks
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CoExecutor.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct the executor, its task starts with the scheduler.
+ *
+ * @param name Name of the RTOS task.
+ * @param priority Priority all CoTasks run at.
+ */
+template<size_t StackSize>
+RTOS::CoExecutor<StackSize>::CoExecutor(const char* const name,
+                                        uint8_t           priority)
+        : CoExecutorBase(), task(*this, name, priority, ITask::RunMode::Batch)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Implementation of task context
+ *
+ */
+template<size_t StackSize>
+void RTOS::CoExecutor<StackSize>::onStart()
+{
+    // CoTasks get their first resume from onRun()
+}
+
+/**
+ * @brief Implementation of task context.
+ *
+ * @details Runs in batch mode, runOnce() blocks whenever no CoTask is ready.
+ */
+template<size_t StackSize>
+void RTOS::CoExecutor<StackSize>::onRun()
+{
+    runOnce();
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,313 @@
+/**
+ * @file AL_CoTask.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief stackless tasks sharing one RTOS task
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CoTask.h"
+
+#include <algorithm>
+#include <task.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an Await without any condition
+ *
+ * @param kind How the executor handles it.
+ * @param timeout Maximum time to wait.
+ */
+RTOS::Await::Await(Kind kind, milliseconds timeout)
+        : kind(kind), timeoutTicks(Utility::millisToTicks(timeout)),
+          group(nullptr), bits(0), poll(nullptr), object(nullptr),
+          out(nullptr)
+{}
+
+/**
+ * @brief Construct a CoTask and add it to the executor.
+ *
+ * @details onResume() gets called for the first time from the executor.
+ *
+ * @warning Construct before the scheduler starts, or at least before the
+ * executor blocks for good, it does not get woken up by this.
+ *
+ * @param executor Executor the CoTask runs on, must outlive the CoTask.
+ */
+RTOS::CoTask::CoTask(CoExecutorBase& executor)
+        : executor(executor), next(nullptr), await(Await::delay(0)),
+          startTick(0)
+{
+    executor.add(*this);
+}
+
+/**
+ * @brief Removes the CoTask from the executor
+ *
+ * @warning Do not destruct from within onResume() of any CoTask of the
+ * same executor.
+ */
+RTOS::CoTask::~CoTask()
+{
+    executor.remove(*this);
+}
+
+/**
+ * @brief Construct an executor without CoTasks
+ *
+ */
+RTOS::CoExecutorBase::CoExecutorBase() : group(), first(nullptr) {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief wait until event got triggered.
+ * The event is not reset, same as with Event::await().
+ *
+ * @param event Event to wait for.
+ * @param timeout Maximum time to wait.
+ * @return RTOS::Await condition to return from CoTask::onResume()
+ */
+RTOS::Await RTOS::Await::event(Event& event, milliseconds timeout)
+{
+    Await await {Kind::Events, timeout};
+    await.group = event.group;
+    await.bits  = event.bit;
+    return await;
+}
+
+/**
+ * @brief wait until the mutex could be obtained.
+ *
+ * @details The mutex is owned by the executor task afterwards, release it
+ * from onResume() of the same CoTask.
+ *
+ * @param mutex Mutex to obtain.
+ * @param timeout Maximum time to wait.
+ * @return RTOS::Await condition to return from CoTask::onResume()
+ */
+RTOS::Await RTOS::Await::obtain(Mutex& mutex, milliseconds timeout)
+{
+    Await await {Kind::Poll, timeout};
+    await.object = &mutex;
+    await.poll   = &pollObtain;
+    return await;
+}
+
+/**
+ * @brief wait for the given time, replaces ITask::delay().
+ * Resumes with Error::None.
+ *
+ * @param time Time to wait.
+ * @return RTOS::Await condition to return from CoTask::onResume()
+ */
+RTOS::Await RTOS::Await::delay(milliseconds time)
+{
+    return Await {Kind::Delay, time};
+}
+
+/**
+ * @brief CoTask is done and never gets resumed again.
+ *
+ * @return RTOS::Await condition to return from CoTask::onResume()
+ */
+RTOS::Await RTOS::Await::finished()
+{
+    return Await {Kind::Finished, Infinity};
+}
+
+/**
+ * @brief Check if CoTask returned Await::finished()
+ *
+ * @return true CoTask does not get resumed anymore
+ */
+bool RTOS::CoTask::isFinished() const
+{
+    return await.kind == Await::Kind::Finished;
+}
+
+/**
+ * @brief Get the group all awaited events have to be part of
+ *
+ * @return RTOS::EventGroup& Group of this executor.
+ */
+RTOS::EventGroup& RTOS::CoExecutorBase::getEventGroup()
+{
+    return group;
+}
+
+/**
+ * @brief Number of CoTasks running on this executor
+ *
+ * @return size_t Finished ones included.
+ */
+size_t RTOS::CoExecutorBase::getCoTaskCount()
+{
+    size_t count = 0;
+    vTaskSuspendAll();
+    for (CoTask* task = first; task != nullptr; task = task->next) {
+        count++;
+    }
+    xTaskResumeAll();
+    return count;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Tries to obtain mutex without blocking.
+ *
+ * @param mutex RTOS::Mutex
+ * @param out unused
+ * @return true mutex got obtained
+ */
+bool RTOS::Await::pollObtain(void* mutex, void* out)
+{
+    return static_cast<Mutex*>(mutex)->tryObtain(0) == Error::None;
+}
+
+/**
+ * @brief Resumes all CoTasks that are ready, blocks if none is.
+ *
+ * @details Called in a loop from the executor task. Blocking for the awaited
+ * bits leaves them set, Await::event() behaves like Event::await() and the
+ * poll of Await::receive() resets the bit itself before checking the queue.
+ */
+void RTOS::CoExecutorBase::runOnce()
+{
+    TickType_t  now       = xTaskGetTickCount();
+    TickType_t  waitTicks = portMAX_DELAY;
+    EventBits_t waitBits  = 0;
+    bool        resumed   = false;
+
+    for (CoTask* task = first; task != nullptr; task = task->next) {
+        Error::Code result = Error::None;
+        if (isReady(*task, now, result)) {
+            task->await     = task->onResume(result);
+            task->startTick = xTaskGetTickCount();
+            resumed         = true;
+            continue;
+        }
+
+        const Await& await = task->await;
+        waitBits |= await.bits;
+        if (await.kind == Await::Kind::Poll && await.bits == 0) {
+            // nothing wakes the executor up for it
+            waitTicks = 1;
+        }
+        if (await.timeoutTicks != portMAX_DELAY) {
+            TickType_t passed = now - task->startTick;
+            waitTicks         = std::min<TickType_t>(
+                waitTicks, await.timeoutTicks - passed);
+        }
+    }
+
+    if (resumed) {
+        // conditions changed, check again before blocking
+        return;
+    }
+
+    if (waitBits != 0) {
+        xEventGroupWaitBits(group.handle, waitBits, pdFALSE, pdFALSE, waitTicks);
+    } else {
+        vTaskDelay(waitTicks);
+    }
+}
+
+/**
+ * @brief Adds CoTask to the list of this executor
+ *
+ * @param task CoTask to run.
+ */
+void RTOS::CoExecutorBase::add(CoTask& task)
+{
+    vTaskSuspendAll();
+    CoTask** last = &first;
+    while (*last != nullptr) {
+        last = &(*last)->next;
+    }
+    *last = &task;
+    xTaskResumeAll();
+}
+
+/**
+ * @brief Removes CoTask from the list of this executor
+ *
+ * @param task CoTask to remove.
+ */
+void RTOS::CoExecutorBase::remove(CoTask& task)
+{
+    vTaskSuspendAll();
+    for (CoTask** current = &first; *current != nullptr;
+         current          = &(*current)->next) {
+        if (*current == &task) {
+            *current = task.next;
+            break;
+        }
+    }
+    xTaskResumeAll();
+}
+
+/**
+ * @brief Checks whether the awaited condition of a CoTask is met.
+ *
+ * @param task CoTask to check.
+ * @param now Current tick count.
+ * @param result Gets the result to resume the CoTask with.
+ * @return true CoTask has to be resumed
+ */
+bool RTOS::CoExecutorBase::isReady(CoTask& task, TickType_t now,
+                                   Error::Code& result)
+{
+    Await& await = task.await;
+
+    switch (await.kind) {
+        case Await::Kind::Finished:
+            return false;
+        case Await::Kind::Invalid:
+            result = Error::InvalidParameter;
+            return true;
+        case Await::Kind::Events:
+        case Await::Kind::Poll:
+            if (await.group != nullptr && await.group != &group) {
+                // executor can not wait for foreign groups
+                result = Error::InvalidParameter;
+                return true;
+            }
+            break;
+        case Await::Kind::Delay:
+            break;
+    }
+
+    if (await.kind == Await::Kind::Events &&
+        (xEventGroupGetBits(group.handle) & await.bits) != 0) {
+        result = Error::None;
+        return true;
+    }
+    if (await.kind == Await::Kind::Poll && await.poll(await.object, await.out)) {
+        result = Error::None;
+        return true;
+    }
+
+    if (await.timeoutTicks != portMAX_DELAY &&
+        now - task.startTick >= await.timeoutTicks) {
+        result = await.kind == Await::Kind::Delay ? Error::None
+                                                  : Error::Timeout;
+        return true;
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
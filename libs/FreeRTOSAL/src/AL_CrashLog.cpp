@@ -0,0 +1,155 @@
+/**
+ * @file AL_CrashLog.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief failed error checks kept across restarts
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CrashLog.h"
+
+#include <FreeRTOS.h>
+#include <algorithm>
+#include <task.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+#ifdef HOST
+/** nothing survives the end of the process on host */
+#define CRASHLOG_RETAINED
+#else
+/** skipped by the startup code, see .noinit in the linker scripts */
+#define CRASHLOG_RETAINED __attribute__((section(".noinit")))
+#endif
+
+CRASHLOG_RETAINED Diagnostics::CrashLog::Pending
+                  Diagnostics::CrashLog::pending;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//------------------------ EXPOSED STATIC FUNCTIONS ---------------------------
+
+/**
+ * @brief Keeps a failed error check for commit() after the restart.
+ * Overwrites a record that did not get committed yet.
+ *
+ * @details Called from Port::saveCrash() with interrupts disabled, from
+ * tasks as well as from ISRs. Does not block.
+ *
+ * @param code Error::Code that failed the check.
+ * @param site Error site ID, see Error::makeSite().
+ */
+void Diagnostics::CrashLog::save(Error::Code code, uint32_t site)
+{
+    uint8_t task = kNoTask;
+    if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        // copies the TCB fields only, neither locks nor walks the stack
+        TaskStatus_t status {};
+        vTaskGetInfo(nullptr, &status, pdFALSE, eRunning);
+        task = static_cast<uint8_t>(
+            std::min<UBaseType_t>(status.xTaskNumber, kNoTask - 1));
+    }
+
+    pending.magic           = 0;
+    pending.record.site     = site;
+    pending.record.uptimeMs = static_cast<uint32_t>(
+        uint64_t(xTaskGetTickCountFromISR()) * 1000 / configTICK_RATE_HZ);
+    pending.record.sequence = 0;
+    pending.record.code     = static_cast<uint8_t>(code);
+    pending.record.task     = task;
+    pending.magic           = kMagic;
+    pending.check           = checksum(pending);
+}
+
+/**
+ * @brief Whether a record from before the restart waits for commit().
+ *
+ */
+bool Diagnostics::CrashLog::hasPending()
+{
+    return pending.magic == kMagic && pending.check == checksum(pending);
+}
+
+/**
+ * @brief Moves the pending record into the ring of the store, the oldest
+ * record gets dropped. Call once after every start.
+ *
+ * @param store Persistent storage of the ring.
+ * @return Error::Code NotFound if there is no pending record. The record
+ * stays pending if the store failed.
+ */
+Error::Code Diagnostics::CrashLog::commit(Store& store)
+{
+    if (!hasPending()) {
+        return Error::NotFound;
+    }
+
+    Ring ring {};
+    auto result = store.load(ring);
+    if (result == Error::NotFound) {
+        ring = Ring {};
+    } else if (result != Error::None) {
+        return result;
+    }
+
+    // newest first, so read() does not need to sort
+    Record record   = pending.record;
+    record.sequence = static_cast<uint16_t>(ring[0].sequence + 1);
+    if (record.sequence == 0) {
+        // 0 marks empty slots
+        record.sequence = 1;
+    }
+    std::rotate(ring.begin(), ring.end() - 1, ring.end());
+    ring[0] = record;
+
+    RETURN_ON_ERROR(store.store(ring));
+    pending.magic = 0;
+    return Error::None;
+}
+
+/**
+ * @brief Read a committed record.
+ *
+ * @param store Persistent storage of the ring.
+ * @param age 0 for the newest record.
+ * @param record Read record.
+ * @return Error::Code NotFound if there are not that many records.
+ */
+Error::Code Diagnostics::CrashLog::read(Store& store, size_t age, Record& record)
+{
+    if (age >= kRecords) {
+        return Error::NotFound;
+    }
+
+    Ring ring {};
+    RETURN_ON_ERROR(store.load(ring));
+    if (ring[age].sequence == 0) {
+        return Error::NotFound;
+    }
+    record = ring[age];
+    return Error::None;
+}
+
+//------------------------ PRIVATE STATIC FUNCTIONS ---------------------------
+
+/**
+ * @brief Checksum of a pending record, RAM content after power up is
+ * random.
+ *
+ */
+uint32_t Diagnostics::CrashLog::checksum(const Pending& pending)
+{
+    const auto& record = pending.record;
+    uint32_t    check  = pending.magic ^ record.site;
+    check              = (check << 7 | check >> 25) ^ record.uptimeMs;
+    check              = (check << 7 | check >> 25) ^ record.code;
+    check              = (check << 7 | check >> 25) ^ record.task;
+    return ~check;
+}
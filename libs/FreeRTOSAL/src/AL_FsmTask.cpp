@@ -0,0 +1,113 @@
+/**
+ * @file AL_FsmTask.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief state machine driven by events from a queue
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FsmTask.h"
+
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Create queue and task, the state machine starts with the task.
+ *
+ * @param context Passed to all actions of the state machine.
+ * @param name Name of the task and the queue.
+ * @param priority Priority of the task.
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+RTOS::FsmTask<Definition, queueLength, stackSize>::FsmTask(
+    Context&          context,
+    const char* const name,
+    uint8_t           priority)
+        : fsm(context), queue(name), task(*this, name, priority)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Queue an event for the state machine.
+ *
+ * @param event Event to dispatch.
+ * @param timeout Longest wait for space in the queue.
+ * @return Error::Code Timeout if the queue stayed full.
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+Error::Code RTOS::FsmTask<Definition, queueLength, stackSize>::post(
+    Event        event,
+    milliseconds timeout)
+{
+    return queue.send(std::move(event), timeout);
+}
+
+/**
+ * @brief Queue an event for the state machine from an ISR.
+ *
+ * @param event Event to dispatch.
+ * @param contextSwitchNeeded Set to true if the task has to run before the
+ * interrupted one, might be nullptr to yield automatically.
+ * @return Error::Code Full if the queue is full.
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+Error::Code RTOS::FsmTask<Definition, queueLength, stackSize>::postFromISR(
+    Event event,
+    bool* contextSwitchNeeded)
+{
+    return queue.sendFromISR(std::move(event), contextSwitchNeeded);
+}
+
+/**
+ * @brief Innermost active state.
+ *
+ * @warning Changes any time in the task, only use it as a hint.
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+typename RTOS::FsmTask<Definition, queueLength, stackSize>::State
+    RTOS::FsmTask<Definition, queueLength, stackSize>::getState() const
+{
+    return fsm.getState();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Enters the initial state.
+ *
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+void RTOS::FsmTask<Definition, queueLength, stackSize>::onStart()
+{
+    CHECK_ERROR(fsm.start());
+}
+
+/**
+ * @brief Waits for the next event and dispatches it.
+ * Events no state handles are dropped.
+ *
+ */
+template<class Definition, size_t queueLength, size_t stackSize>
+void RTOS::FsmTask<Definition, queueLength, stackSize>::onRun()
+{
+    Event event;
+    if (queue.receiveInto(event) != Error::None) {
+        return;
+    }
+    fsm.dispatch(event);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,176 @@
+/**
+ * @file AL_Profiler.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief per task CPU usage, context switches and stack usage
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Profiler.h"
+
+#include <algorithm>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+std::array<TaskStatus_t, RTOS::Profiler::kMaxTasks>
+    RTOS::Profiler::taskStates {};
+std::array<uint32_t, RTOS::Profiler::kMaxTasks> RTOS::Profiler::lastRunTimes {};
+std::array<uint32_t, RTOS::Profiler::kMaxTasks> RTOS::Profiler::lastSwitches {};
+uint32_t                 RTOS::Profiler::lastTotalRunTime  = 0;
+uint32_t                 RTOS::Profiler::lastTotalSwitches = 0;
+RTOS::Profiler::Snapshot RTOS::Profiler::snapshot {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(configGENERATE_RUN_TIME_STATS == 1 &&
+                  configUSE_TRACE_FACILITY == 1,
+              "RTOS::Profiler needs run time stats and trace facility");
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Takes a new snapshot covering the time since the last call.
+ *
+ * @details The first call covers the time since scheduler start.
+ *
+ * @return Error::Code OutOfResources if there are more than kMaxTasks tasks.
+ */
+Error::Code RTOS::Profiler::sample()
+{
+    uint32_t totalRunTime = 0;
+    auto     taskCount    = uxTaskGetSystemState(taskStates.data(),
+                                          taskStates.size(),
+                                          &totalRunTime);
+    if (taskCount == 0) {
+        // buffer too small, FreeRTOS does not fill in anything
+        return Error::OutOfResources;
+    }
+    uint32_t totalSwitches = getContextSwitchCount();
+
+    std::sort(taskStates.begin(),
+              taskStates.begin() + taskCount,
+              [](const TaskStatus_t& a, const TaskStatus_t& b) {
+                  return a.xTaskNumber < b.xTaskNumber;
+              });
+
+    uint32_t elapsed       = totalRunTime - lastTotalRunTime;
+    uint32_t idleRunTime   = 0;
+    snapshot.version       = kSnapshotVersion;
+    snapshot.taskCount     = static_cast<uint8_t>(taskCount);
+    snapshot.intervalMs    = static_cast<uint32_t>(
+        static_cast<uint64_t>(elapsed) * 1000 / configRUN_TIME_COUNTER_HZ);
+    snapshot.switches      = totalSwitches - lastTotalSwitches;
+    lastTotalRunTime       = totalRunTime;
+    lastTotalSwitches      = totalSwitches;
+
+    for (size_t i = 0; i < taskCount; ++i) {
+        const auto& state  = taskStates[i];
+        auto&       task   = snapshot.tasks[i];
+        auto        number = state.xTaskNumber;
+
+        uint32_t runTime  = state.ulRunTimeCounter;
+        uint32_t switches = getTaskSwitches(number);
+        if (number < kMaxTasks) {
+            // only the difference to the last sample is of interest
+            auto lastRunTime     = lastRunTimes[number];
+            auto lastSwitchCount = lastSwitches[number];
+            lastRunTimes[number] = runTime;
+            lastSwitches[number] = switches;
+            runTime -= lastRunTime;
+            switches -= lastSwitchCount;
+        }
+        if (state.xHandle == xTaskGetIdleTaskHandle()) {
+            idleRunTime = runTime;
+        }
+
+        std::memset(task.name, 0, sizeof(task.name));
+        std::strncpy(task.name, state.pcTaskName, sizeof(task.name));
+        task.taskNumber         = static_cast<uint8_t>(number);
+        task.priority           = static_cast<uint8_t>(state.uxCurrentPriority);
+        task.cpuPermille        = permille(runTime, elapsed);
+        task.switches           = switches;
+        task.stackHighWaterMark = state.usStackHighWaterMark;
+    }
+    snapshot.cpuLoadPermille = 1000 - permille(idleRunTime, elapsed);
+
+    return Error::None;
+}
+
+/**
+ * @brief Get the result of the last sample().
+ *
+ * @return const Snapshot& Zeroed until sample() was called.
+ */
+const RTOS::Profiler::Snapshot& RTOS::Profiler::getSnapshot()
+{
+    return snapshot;
+}
+
+/**
+ * @brief Get the result of the last sample() as raw bytes.
+ *
+ * @param outPacked Gets the snapshot copied in.
+ */
+void RTOS::Profiler::getPackedSnapshot(PackedSnapshot& outPacked)
+{
+    std::memcpy(outPacked.data(), &snapshot, sizeof(snapshot));
+}
+
+/**
+ * @brief Get the full name of a task in the last snapshot.
+ *
+ * @details Other than the snapshot entry the name is 0 terminated and stays
+ * valid as long as the task exists, so it can be used for deferred logging.
+ *
+ * @param index Index into Snapshot::tasks.
+ * @return const char* nullptr if index is not valid.
+ */
+const char* RTOS::Profiler::getTaskName(size_t index)
+{
+    if (index >= snapshot.taskCount) {
+        return nullptr;
+    }
+    return taskStates[index].pcTaskName;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Get context switches of a task since scheduler start.
+ *
+ * @param taskNumber FreeRTOS task number.
+ * @return uint32_t 0 for tasks that are not counted.
+ */
+uint32_t RTOS::Profiler::getTaskSwitches(UBaseType_t taskNumber)
+{
+    if (taskNumber >= kMaxTasks) {
+        return 0;
+    }
+    return rtosTaskSwitchCounts[taskNumber];
+}
+
+/**
+ * @brief Calculates part of total in 1/1000.
+ *
+ * @param part
+ * @param total
+ * @return uint16_t 0 if total is 0
+ */
+uint16_t RTOS::Profiler::permille(uint32_t part, uint32_t total)
+{
+    if (total == 0) {
+        return 0;
+    }
+    return static_cast<uint16_t>(std::min<uint64_t>(
+        static_cast<uint64_t>(part) * 1000 / total, 1000));
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
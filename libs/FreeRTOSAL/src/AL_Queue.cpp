@@ -12,7 +12,11 @@
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "AL_Queue.h"
+#include "AL_Event.h"
+
 #include <memory>
+#include <new>
+#include <utility>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -27,7 +31,10 @@
  */
 template<class T, size_t queueLength>
 RTOS::Queue<T, queueLength>::Queue(const char* const name)
-        : handle(xQueueCreateStatic(queueLength, sizeof(T), buffer, &data))
+        : handle(xQueueCreateStatic(queueLength, sizeof(T), buffer, &data)),
+          readIndex(0), consumer(nullptr), isSingleConsumer(true),
+          sendEvent(nullptr),
+          traceNumber(Trace::registerQueue(name))
 {
     vQueueAddToRegistry(handle, name);
 }
@@ -39,6 +46,7 @@ RTOS::Queue<T, queueLength>::Queue(const char* const name)
 template<class T, size_t queueLength>
 RTOS::Queue<T, queueLength>::~Queue()
 {
+    Trace::unregisterQueue(traceNumber);
     vQueueDelete(handle);
 }
 
@@ -60,8 +68,7 @@ Error::Code RTOS::Queue<T, queueLength>::send(const T&&    object,
     if (xQueueSend(handle,
                    static_cast<const void*>(&object),
                    Utility::millisToTicks(timeout)) == pdTRUE) {
-        // Avoid calling the destructor
-        std::move(object);
+        onSent();
         return Error::None;
     } else {
         // queue full
@@ -84,14 +91,21 @@ Error::Code RTOS::Queue<T, queueLength>::sendFromISR(const T&& object,
     auto       success                   = xQueueSendFromISR(handle,
                                      static_cast<const void*>(&object),
                                      &pxHigherPriorityTaskWoken) == pdTRUE;
+    bool eventSwitchNeeded = false;
+
+    if (success) {
+        TRACE_EVENT(Trace::QueueSend, getTraceArg());
+    }
+    if (success && sendEvent != nullptr) {
+        sendEvent->triggerFromISR(&eventSwitchNeeded);
+    }
 
     if (contextSwitchNeeded) {
-        *contextSwitchNeeded = pxHigherPriorityTaskWoken == pdTRUE;
+        *contextSwitchNeeded =
+            pxHigherPriorityTaskWoken == pdTRUE || eventSwitchNeeded;
     }
 
     if (success) {
-        // Avoid calling the destructor
-        std::move(object);
         return Error::None;
     } else {
         // queue full
@@ -99,6 +113,40 @@ Error::Code RTOS::Queue<T, queueLength>::sendFromISR(const T&& object,
     }
 }
 
+/**
+ * @brief Constructs an object from args and adds it to the queue.
+ *
+ * @details Saves the temporary a caller of send() has to create. The object
+ * is constructed in place of a local buffer and handed to FreeRTOS without
+ * ever being destructed here, ownership travels through the queue. If the
+ * queue is full, the object is destructed again.
+ *
+ * @warning Only use from task context.
+ *
+ * @param timeoutMs Maximum time to wait for space in the queue.
+ * @param args Arguments forwarded to the constructor of T.
+ * @return Error::Code Might fail with OutOfResources if queue is full.
+ */
+template<class T, size_t queueLength>
+template<class... Args>
+Error::Code RTOS::Queue<T, queueLength>::emplace(milliseconds timeout,
+                                                 Args&&... args)
+{
+    alignas(T) uint8_t storage[sizeof(T)];
+    T* object = new (storage) T {std::forward<Args>(args)...};
+
+    if (xQueueSend(handle,
+                   static_cast<const void*>(storage),
+                   Utility::millisToTicks(timeout)) == pdTRUE) {
+        onSent();
+        return Error::None;
+    } else {
+        // queue full, object never made it in
+        object->~T();
+        return Error::OutOfResources;
+    }
+}
+
 /**
  * @brief Receive next element from queue.
  * 
@@ -116,6 +164,7 @@ Error::Code RTOS::Queue<T, queueLength>::receive(T&           outObject,
     if (xQueueReceive(handle,
                       static_cast<void*>(&buffer),
                       Utility::millisToTicks(timeout)) == pdTRUE) {
+        onReceived(xTaskGetCurrentTaskHandle());
         outObject = std::move(buffer);
         return Error::None;
     } else {
@@ -147,6 +196,8 @@ Error::Code
     }
 
     if (success) {
+        // an ISR is never the single consumer
+        onReceived(nullptr);
         outObject = std::move(buffer);
         return Error::None;
     } else {
@@ -155,6 +206,178 @@ Error::Code
     }
 }
 
+/**
+ * @brief Receive next element from queue directly into outObject.
+ *
+ * @details Other than receive() no temporary is created and nothing is
+ * move assigned, FreeRTOS copies the element straight into outObject.
+ *
+ * @warning Only use from task context.
+ *
+ * @param outObject Gets overwritten without being destructed first.
+ * @param timeoutMs Maximum time to wait for function to finish.
+ * @return Error::Code Might return Empty if no element is in queue.
+ */
+template<class T, size_t queueLength>
+Error::Code RTOS::Queue<T, queueLength>::receiveInto(T&           outObject,
+                                                     milliseconds timeout)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "receiveInto overwrites outObject byte wise, "
+                  "use receive() for this type");
+
+    if (xQueueReceive(handle,
+                      static_cast<void*>(&outObject),
+                      Utility::millisToTicks(timeout)) == pdTRUE) {
+        onReceived(xTaskGetCurrentTaskHandle());
+        return Error::None;
+    } else {
+        // queue empty
+        return Error::Empty;
+    }
+}
+
+/**
+ * @brief Receive all elements that are available, up to batchSize.
+ *
+ * @details Blocks for the first element only, everything that is queued
+ * by then is taken without blocking again. Elements are received the same
+ * way as with receive().
+ *
+ * @warning Only use from task context.
+ *
+ * @tparam batchSize Maximum number of elements taken at once.
+ * @param outObjects The first count elements get the received objects.
+ * @param count Number of elements received, 0 on error.
+ * @param timeoutMs Maximum time to wait for the first element.
+ * @return Error::Code Might return Empty if no element arrived in time.
+ */
+template<class T, size_t queueLength>
+template<size_t batchSize>
+Error::Code RTOS::Queue<T, queueLength>::receiveBatch(
+    std::array<T, batchSize>& outObjects,
+    size_t&                   count,
+    milliseconds              timeout)
+{
+    static_assert(batchSize > 0, "batch must at least hold one element");
+
+    count = 0;
+    RETURN_ON_ERROR(receive(outObjects[0], timeout));
+
+    for (count = 1; count < batchSize; ++count) {
+        if (receive(outObjects[count], 0) != Error::None) {
+            break;
+        }
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Copy the oldest element without removing it.
+ *
+ * @details Blocks until an element is available, so a task can wait for
+ * data and receive it later under a lock of its own. Does not count as a
+ * receive, usable with peekRef() from any task.
+ *
+ * @warning Only use from task context. outObject is overwritten byte wise.
+ *
+ * @param outObject Gets a copy of the oldest element.
+ * @param timeoutMs Maximum time to wait for an element.
+ * @return Error::Code Might return Empty if no element is in queue.
+ */
+template<class T, size_t queueLength>
+Error::Code RTOS::Queue<T, queueLength>::peek(T&           outObject,
+                                              milliseconds timeout)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "peek overwrites outObject byte wise");
+
+    if (xQueuePeek(handle,
+                   static_cast<void*>(&outObject),
+                   Utility::millisToTicks(timeout)) == pdTRUE) {
+        return Error::None;
+    } else {
+        // queue empty
+        return Error::Empty;
+    }
+}
+
+/**
+ * @brief Get read access to the oldest element without copying it out.
+ *
+ * @details outRef points into the queue storage and stays valid until the
+ * element is received or dropped. Use drop() when done with it, if the
+ * content is not needed outside of the queue.
+ *
+ * @warning Only valid if this queue has a single consumer, all receiving
+ * functions must be called from the same task. Once a second task or an ISR
+ * received, peekRef() and drop() fail with InvalidUse.
+ *
+ * @param outRef Set to the oldest element in the queue.
+ * @return Error::Code Empty if there is no element in the queue, InvalidUse
+ * if the queue has another consumer.
+ */
+template<class T, size_t queueLength>
+Error::Code RTOS::Queue<T, queueLength>::peekRef(const T*& outRef)
+{
+    if (!isPeekAllowed()) {
+        return Error::InvalidUse;
+    }
+    if (uxQueueMessagesWaiting(handle) == 0) {
+        return Error::Empty;
+    }
+
+    outRef = reinterpret_cast<const T*>(&buffer[readIndex * sizeof(T)]);
+    return Error::None;
+}
+
+/**
+ * @brief Removes the oldest element from the queue without handing it out.
+ *
+ * @details Intended to be used after peekRef(). The element is not
+ * destructed, so the consumer takes over whatever it owned.
+ * FreeRTOS has no API to pop without copying, so the element is copied into
+ * a scratch buffer that is thrown away.
+ *
+ * @warning Only use from task context, single consumer only (see peekRef()).
+ *
+ * @return Error::Code Empty if there is no element in the queue, InvalidUse
+ * if the queue has another consumer.
+ */
+template<class T, size_t queueLength>
+Error::Code RTOS::Queue<T, queueLength>::drop()
+{
+    if (!isPeekAllowed()) {
+        return Error::InvalidUse;
+    }
+
+    alignas(T) uint8_t scratch[sizeof(T)];
+    if (xQueueReceive(handle, static_cast<void*>(scratch), 0) == pdTRUE) {
+        onReceived(xTaskGetCurrentTaskHandle());
+        return Error::None;
+    } else {
+        // queue empty
+        return Error::Empty;
+    }
+}
+
+/**
+ * @brief Set an event that gets triggered after every send.
+ *
+ * @details Needed for RTOS::Await::receive(), the event has to be part of
+ * the event group of the executor. Triggering costs an additional kernel
+ * call per send, so leave it unset for plain task consumers.
+ *
+ * @warning Set before any producer starts sending.
+ *
+ * @param event Event to trigger, nullptr to disable.
+ */
+template<class T, size_t queueLength>
+void RTOS::Queue<T, queueLength>::setSendEvent(Event* event)
+{
+    sendEvent = event;
+}
+
 /**
  * @brief Get string identifier of this queue.
  *
@@ -170,4 +393,59 @@ const char* const RTOS::Queue<T, queueLength>::getName()
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief Traces the send and triggers sendEvent, if any, after an element
+ * got in.
+ *
+ */
+template<class T, size_t queueLength>
+void RTOS::Queue<T, queueLength>::onSent()
+{
+    TRACE_EVENT(Trace::QueueSend, getTraceArg());
+    if (sendEvent != nullptr) {
+        sendEvent->trigger();
+    }
+}
+
+/**
+ * @brief FreeRTOS reads the storage in ring order starting at buffer.
+ * Keeps track of the oldest element so peekRef() can find it, as long as
+ * only one task receives.
+ *
+ * @param receiver Task that received, nullptr for an ISR.
+ */
+template<class T, size_t queueLength>
+void RTOS::Queue<T, queueLength>::onReceived(TaskHandle_t receiver)
+{
+    if (receiver == nullptr || (consumer != nullptr && consumer != receiver)) {
+        isSingleConsumer = false;
+    } else {
+        consumer = receiver;
+    }
+    readIndex = (readIndex + 1) % queueLength;
+    TRACE_EVENT(Trace::QueueReceive, getTraceArg());
+}
+
+/**
+ * @brief Whether readIndex is valid for the calling task.
+ *
+ */
+template<class T, size_t queueLength>
+bool RTOS::Queue<T, queueLength>::isPeekAllowed()
+{
+    return isSingleConsumer &&
+           (consumer == nullptr || consumer == xTaskGetCurrentTaskHandle());
+}
+
+/**
+ * @brief Argument of queue trace events, number and fill level.
+ * Reads the fill level without critical section, usable from ISR.
+ *
+ */
+template<class T, size_t queueLength>
+uint32_t RTOS::Queue<T, queueLength>::getTraceArg()
+{
+    return traceNumber | (uxQueueMessagesWaitingFromISR(handle) << 8);
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
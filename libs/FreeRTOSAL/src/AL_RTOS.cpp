@@ -19,6 +19,11 @@
 
 //-------------------------------- CONSTANTS ----------------------------------
 
+/** incremented by traceTASK_SWITCHED_IN(), see FreeRTOSConfig.h */
+volatile uint32_t rtosContextSwitchCount = 0;
+/** same per task number, read by RTOS::Profiler */
+volatile uint32_t rtosTaskSwitchCounts[configPROFILER_MAX_TASKS] = {};
+
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
 
 /**
@@ -54,7 +59,23 @@ RTOS::milliseconds RTOS::getTime()
 {
     TimeOut_t time;
     vTaskSetTimeOutState(&time);
-    return time.xOverflowCount * portMAX_DELAY + time.xTimeOnEntering;
+    // wraps to 0 with 64 bit ticks, those do not overflow anyway
+    uint64_t ticksPerOverflow = static_cast<uint64_t>(portMAX_DELAY) + 1;
+    uint64_t ticks = time.xOverflowCount * ticksPerOverflow + time.xTimeOnEntering;
+    return static_cast<milliseconds>(ticks * 1000 / configTICK_RATE_HZ);
+}
+
+/**
+ * @brief Get the number of context switches since scheduler start.
+ *
+ * @details Counted in traceTASK_SWITCHED_IN(). Stays 0 when SEGGER SystemView
+ * takes over the trace hooks. Wraps around, use differences only.
+ *
+ * @return uint32_t Number of times a task got switched in.
+ */
+uint32_t RTOS::getContextSwitchCount()
+{
+    return rtosContextSwitchCount;
 }
 
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
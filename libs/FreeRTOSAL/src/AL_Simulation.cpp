@@ -0,0 +1,156 @@
+/**
+ * @file AL_Simulation.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief virtual time for host simulations
+ * @version 1.0
+ * @date 2020-11-06
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Simulation.h"
+
+#include <limits>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+volatile uint64_t RTOS::Simulation::skippedTicks = 0;
+volatile uint32_t RTOS::Simulation::skips        = 0;
+uint32_t          RTOS::Simulation::seedValue    = 1;
+uint32_t          RTOS::Simulation::randomState  = 1;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(configUSE_SIMULATION == 0 || configUSE_TICKLESS_IDLE != 0,
+              "simulation skips ticks through tickless idle");
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the number of ticks that were jumped over.
+ *
+ * @return uint64_t 0 if the simulation is not active.
+ */
+uint64_t RTOS::Simulation::getSkippedTicks()
+{
+    return skippedTicks;
+}
+
+/**
+ * @brief Get the time that was jumped over.
+ *
+ * @return milliseconds Virtual time minus real time since scheduler start.
+ */
+RTOS::milliseconds RTOS::Simulation::getSkippedTime()
+{
+    return static_cast<milliseconds>(skippedTicks * 1000 / configTICK_RATE_HZ);
+}
+
+/**
+ * @brief Get the number of jumps, each one replaced an idle period.
+ *
+ */
+uint32_t RTOS::Simulation::getSkips()
+{
+    return skips;
+}
+
+/**
+ * @brief Restart random() with a new seed.
+ *
+ * @param value Same value gives the same sequence, 0 is replaced by 1.
+ */
+void RTOS::Simulation::seed(uint32_t value)
+{
+    seedValue   = value;
+    randomState = (value != 0) ? value : 1;
+}
+
+/**
+ * @brief Get the value random() got seeded with last.
+ *
+ */
+uint32_t RTOS::Simulation::getSeed()
+{
+    return seedValue;
+}
+
+/**
+ * @brief Next number of a deterministic xorshift sequence.
+ *
+ * @warning Not thread safe, the sequence is only reproducible if tasks use
+ * it in a deterministic order.
+ *
+ * @return uint32_t never 0
+ */
+uint32_t RTOS::Simulation::random()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+/**
+ * @brief Next number of the sequence, mapped into a range.
+ *
+ * @param min Smallest possible result.
+ * @param max Largest possible result, at least min.
+ * @return uint32_t
+ */
+uint32_t RTOS::Simulation::random(uint32_t min, uint32_t max)
+{
+    uint64_t range = static_cast<uint64_t>(max) - min + 1;
+    return min + static_cast<uint32_t>(random() % range);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Called by the idle task instead of sleeping, with the scheduler
+ * suspended.
+ *
+ * @param expectedIdleTicks Ticks until the next task or timer is due.
+ */
+extern "C" void rtosSimulationSkipTicks(uint32_t expectedIdleTicks)
+{
+    RTOS::Simulation::skip(expectedIdleTicks);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Jumps to the tick the next task is due at.
+ *
+ * @details vTaskStepTick() moves the tick count right in front of it. The
+ * last tick is counted like one from the tick interrupt, with the scheduler
+ * suspended it gets pended and xTaskResumeAll() processes it. So the task
+ * is unblocked and switched in as soon as the idle task resumes the
+ * scheduler, without waiting for the next real tick.
+ *
+ * @param expectedIdleTicks Ticks until the next task or timer is due.
+ */
+void RTOS::Simulation::skip(uint32_t expectedIdleTicks)
+{
+#if configUSE_SIMULATION
+    if (expectedIdleTicks >= std::numeric_limits<uint32_t>::max() / 2) {
+        // nothing is due, only an ISR can go on from here
+        return;
+    }
+
+    vTaskStepTick(expectedIdleTicks - 1);
+    taskENTER_CRITICAL();
+    xTaskIncrementTick();
+    taskEXIT_CRITICAL();
+
+    skippedTicks = skippedTicks + expectedIdleTicks;
+    skips        = skips + 1;
+#else
+    (void)expectedIdleTicks;
+#endif
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
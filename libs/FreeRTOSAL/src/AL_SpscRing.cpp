@@ -0,0 +1,257 @@
+/**
+ * @file AL_SpscRing.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief lock-free single producer single consumer ring buffer
+ * @version 1.0
+ * @date 2020-10-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_SpscRing.h"
+#include <new>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an empty ring
+ *
+ */
+template<class T, size_t capacity>
+RTOS::SpscRing<T, capacity>::SpscRing()
+        : head(0), tail(0), consumerWaiting(false), consumer(nullptr)
+{}
+
+/**
+ * @brief Destructs all objects that were not popped
+ *
+ */
+template<class T, size_t capacity>
+RTOS::SpscRing<T, capacity>::~SpscRing()
+{
+    while (drop() == Error::None) {
+        // drop everything left over
+    }
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Copies object into the ring, never blocks.
+ *
+ * @warning Only use from task context and only from the producer.
+ *
+ * @param object Object to copy in.
+ * @return Error::Code Full if there is no free slot.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::tryPush(const T& object)
+{
+    RETURN_ON_ERROR(put(object));
+
+    if (consumerWaiting.exchange(false)) {
+        xTaskNotifyGive(consumer);
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Copies object into the ring from ISR, never blocks.
+ *
+ * @warning Only use from the producer.
+ *
+ * @param object Object to copy in.
+ * @param contextSwitchNeeded Whether the scheduler has to be invoked.
+ * @return Error::Code Full if there is no free slot.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::tryPushFromISR(const T& object,
+                                                        bool* contextSwitchNeeded)
+{
+    BaseType_t pxHigherPriorityTaskWoken = pdFALSE;
+    auto       result                    = put(object);
+
+    if (result == Error::None && consumerWaiting.exchange(false)) {
+        vTaskNotifyGiveFromISR(consumer, &pxHigherPriorityTaskWoken);
+    }
+
+    if (contextSwitchNeeded) {
+        *contextSwitchNeeded = pxHigherPriorityTaskWoken == pdTRUE;
+    }
+    return result;
+}
+
+/**
+ * @brief Moves oldest object out of the ring.
+ *
+ * @warning Only use from the consumer task.
+ *
+ * @param outObject Gets the object move assigned.
+ * @param timeout Maximum time to wait for data.
+ * @return Error::Code Empty if nothing arrived in time.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::pop(T&           outObject,
+                                             milliseconds timeout)
+{
+    if (!waitForData(timeout)) {
+        return Error::Empty;
+    }
+
+    outObject = std::move(*slot(tail.load(std::memory_order_relaxed)));
+    return drop();
+}
+
+/**
+ * @brief Get read access to the oldest object without copying it out.
+ *
+ * @details outRef stays valid until drop() is called.
+ *
+ * @warning Only use from the consumer task.
+ *
+ * @param outRef Set to the oldest object in the ring.
+ * @param timeout Maximum time to wait for data.
+ * @return Error::Code Empty if nothing arrived in time.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::peekRef(const T*&    outRef,
+                                                 milliseconds timeout)
+{
+    if (!waitForData(timeout)) {
+        return Error::Empty;
+    }
+
+    outRef = slot(tail.load(std::memory_order_relaxed));
+    return Error::None;
+}
+
+/**
+ * @brief Destructs the oldest object and frees its slot for the producer.
+ *
+ * @warning Only use from the consumer task.
+ *
+ * @return Error::Code Empty if there is nothing to drop.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::drop()
+{
+    auto currentTail = tail.load(std::memory_order_relaxed);
+    if (currentTail == head.load(std::memory_order_acquire)) {
+        return Error::Empty;
+    }
+
+    slot(currentTail)->~T();
+    tail.store(currentTail + 1, std::memory_order_release);
+    return Error::None;
+}
+
+/**
+ * @brief Number of objects currently in the ring.
+ *
+ * @return size_t Might already be outdated when used from the other side.
+ */
+template<class T, size_t capacity>
+size_t RTOS::SpscRing<T, capacity>::size() const
+{
+    return head.load(std::memory_order_acquire) -
+           tail.load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Check if there is no object in the ring.
+ *
+ * @return true no object in the ring
+ */
+template<class T, size_t capacity>
+bool RTOS::SpscRing<T, capacity>::isEmpty() const
+{
+    return size() == 0;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the storage slot of a counter value
+ *
+ * @param counter Free running head or tail value.
+ * @return T* Pointer into storage.
+ */
+template<class T, size_t capacity>
+T* RTOS::SpscRing<T, capacity>::slot(size_t counter)
+{
+    return reinterpret_cast<T*>(&storage[(counter & kMask) * sizeof(T)]);
+}
+
+/**
+ * @brief Copy constructs object in the next free slot and publishes it.
+ *
+ * @param object Object to copy in.
+ * @return Error::Code Full if there is no free slot.
+ */
+template<class T, size_t capacity>
+Error::Code RTOS::SpscRing<T, capacity>::put(const T& object)
+{
+    auto currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead - tail.load(std::memory_order_acquire) >= capacity) {
+        return Error::Full;
+    }
+
+    new (slot(currentHead)) T(object);
+    // sequentially consistent, consumer checks head after setting its flag
+    head.store(currentHead + 1);
+    return Error::None;
+}
+
+/**
+ * @brief Blocks consumer until data is available.
+ *
+ * @details The consumer announces itself via consumerWaiting before checking
+ * the ring a last time, so a push in between always sends a notification.
+ * Spare notifications only cause another round in the loop.
+ *
+ * @param timeout Maximum time to wait.
+ * @return true data is available
+ * @return false timed out
+ */
+template<class T, size_t capacity>
+bool RTOS::SpscRing<T, capacity>::waitForData(milliseconds timeout)
+{
+    if (!isEmpty()) {
+        return true;
+    }
+
+    consumer         = xTaskGetCurrentTaskHandle();
+    TickType_t ticks = Utility::millisToTicks(timeout);
+    TimeOut_t  timeOut;
+    vTaskSetTimeOutState(&timeOut);
+
+    while (true) {
+        consumerWaiting.store(true);
+        if (head.load() != tail.load(std::memory_order_relaxed)) {
+            consumerWaiting.store(false);
+            return true;
+        }
+
+        ulTaskNotifyTake(pdTRUE, ticks);
+        consumerWaiting.store(false);
+
+        if (!isEmpty()) {
+            return true;
+        }
+        if (xTaskCheckForTimeOut(&timeOut, &ticks) == pdTRUE) {
+            return false;
+        }
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
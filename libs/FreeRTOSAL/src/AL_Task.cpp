@@ -35,15 +35,18 @@
  * @param context Heap or statically allocated context
  * @param name Task namme
  * @param priority Priority of the task
+ * @param mode Whether to yield after every onRun(), see RunMode
  */
 template<std::size_t StackSize, class ContextT>
 RTOS::Task<StackSize, ContextT>::Task(ContextT&         context,
                                       const char* const name,
-                                      uint8_t           priority)
-        : handle {xTaskCreateStatic(&Task::runRedirect,
+                                      uint8_t           priority,
+                                      RunMode           mode)
+        : context {context}, mode {mode},
+          handle {xTaskCreateStatic(&Task::runRedirect,
                                     name,
                                     StackSize,
-                                    &context,
+                                    this,
                                     priority,
                                     stack,
                                     &data)}
@@ -107,28 +110,31 @@ void RTOS::Task<StackSize, ContextT>::delay(milliseconds time)
 /**
  * @brief Redirects the task call to its context.
  * 
- * @details Takes the contextPtr and casts it to ContextT*.
- * Then invokes onStart() and onRun() on that instance.
+ * @details Takes the taskPtr and casts it to Task*.
+ * Then invokes onStart() and onRun() on its context.
+ * context and mode are initialized before the FreeRTOS task gets created.
  * 
  * @tparam StackSize Size of the task stack
  * @tparam ContextT Type of the context
- * @param contextPtr Context pointer passed to FreeRTOS task create.
+ * @param taskPtr Task pointer passed to FreeRTOS task create.
  */
 template<std::size_t StackSize, class ContextT>
-void RTOS::Task<StackSize, ContextT>::runRedirect(void* contextPtr)
+void RTOS::Task<StackSize, ContextT>::runRedirect(void* taskPtr)
 {
-    auto castContextPtr = static_cast<ContextT*>(contextPtr);
-    if (castContextPtr == nullptr) {
+    auto castTaskPtr = static_cast<Task*>(taskPtr);
+    if (castTaskPtr == nullptr) {
         // must not happen
         CHECK_ERROR(Error::Internal);
     }
 
-    castContextPtr->onStart();
+    castTaskPtr->context.onStart();
 
     while (1) {
-        castContextPtr->onRun();
-        // allow scheduler to check for other tasks
-        taskYIELD();
+        castTaskPtr->context.onRun();
+        if (castTaskPtr->mode == RunMode::Yield) {
+            // allow scheduler to check for other tasks
+            taskYIELD();
+        }
     }
 }
 
@@ -0,0 +1,268 @@
+/**
+ * @file AL_TimerWheel.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief many software timers driven by a single RTOS timer
+ * @version 1.0
+ * @date 2020-10-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_TimerWheel.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an idle wheel
+ *
+ * @param name Name of the driving RTOS timer.
+ * @param resolution Duration of a wheel tick.
+ */
+template<size_t slotCount>
+RTOS::TimerWheel<slotCount>::TimerWheel(const char* const name,
+                                        milliseconds      resolution)
+        : Timer(name, resolution, true),
+          resolution(resolution),
+          slots{},
+          now(0),
+          activeCount(0),
+          running(false)
+{}
+
+/**
+ * @brief Construct an inactive entry
+ *
+ * @param wheel Wheel the entry is handled by, must outlive the entry.
+ * @param timeout Time from start() to onExpired().
+ */
+template<size_t slotCount>
+RTOS::TimerWheel<slotCount>::Entry::Entry(TimerWheel&  wheel,
+                                          milliseconds timeout)
+        : wheel(wheel),
+          timeoutTicks(static_cast<uint32_t>(
+              (timeout + wheel.resolution - 1) / wheel.resolution + 1)),
+          expiry(0),
+          next(nullptr),
+          prevNext(nullptr)
+{}
+
+/**
+ * @brief Removes entry from the wheel
+ *
+ */
+template<size_t slotCount>
+RTOS::TimerWheel<slotCount>::Entry::~Entry()
+{
+    stop();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Starts the entry, restarts it when already active.
+ *
+ * @details O(1), only relinks the entry inside a critical section. The RTOS
+ * timer is only touched if it this is the first active entry of the wheel.
+ *
+ * @warning Only use from task context.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::Entry::start()
+{
+    taskENTER_CRITICAL();
+    if (prevNext != nullptr) {
+        wheel.unlink(*this);
+    }
+    expiry = wheel.now + timeoutTicks;
+    wheel.link(*this);
+    bool startTimer = !wheel.running;
+    wheel.running   = true;
+    taskEXIT_CRITICAL();
+
+    if (startTimer) {
+        wheel.startTimer();
+    }
+}
+
+/**
+ * @brief Stops the entry, onExpired() will not be called anymore.
+ *
+ * @warning Only use from task context.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::Entry::stop()
+{
+    taskENTER_CRITICAL();
+    if (prevNext != nullptr) {
+        wheel.unlink(*this);
+    }
+    taskEXIT_CRITICAL();
+}
+
+/**
+ * @brief Check if the entry is going to expire
+ *
+ * @return true started and neither expired nor stopped yet
+ */
+template<size_t slotCount>
+bool RTOS::TimerWheel<slotCount>::Entry::isActive() const
+{
+    return prevNext != nullptr;
+}
+
+/**
+ * @brief Number of entries that are going to expire
+ *
+ * @return size_t Might already be outdated when used.
+ */
+template<size_t slotCount>
+size_t RTOS::TimerWheel<slotCount>::getActiveCount() const
+{
+    return activeCount;
+}
+
+/**
+ * @brief Get the duration of a wheel tick
+ *
+ * @return milliseconds resolution given at construction
+ */
+template<size_t slotCount>
+RTOS::milliseconds RTOS::TimerWheel<slotCount>::getResolution() const
+{
+    return resolution;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Advances the wheel by one tick and expires all entries of the
+ * current slot whose round has come.
+ *
+ * @details Expired entries are moved to a local list first, so onExpired()
+ * runs outside of the critical section and may start, stop or even destruct
+ * any entry.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::onTimer()
+{
+    Entry* expired = nullptr;
+
+    taskENTER_CRITICAL();
+    now++;
+    Entry* entry = slots[now % slotCount];
+    while (entry != nullptr) {
+        Entry* next = entry->next;
+        if (static_cast<int32_t>(now - entry->expiry) >= 0) {
+            unlink(*entry);
+            entry->next = expired;
+            if (expired != nullptr) {
+                expired->prevNext = &entry->next;
+            }
+            entry->prevNext = &expired;
+            expired         = entry;
+            activeCount++;
+        }
+        entry = next;
+    }
+    taskEXIT_CRITICAL();
+
+    while (true) {
+        taskENTER_CRITICAL();
+        entry = expired;
+        if (entry != nullptr) {
+            unlink(*entry);
+        }
+        taskEXIT_CRITICAL();
+
+        if (entry == nullptr) {
+            break;
+        }
+        entry->onExpired();
+    }
+
+    stopTimerIfEmpty();
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Links entry into the slot of its expiry tick.
+ *
+ * @warning Call from inside critical section only.
+ *
+ * @param entry Unlinked entry with expiry set.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::link(Entry& entry)
+{
+    Entry*& head = slots[entry.expiry % slotCount];
+    entry.next   = head;
+    if (head != nullptr) {
+        head->prevNext = &entry.next;
+    }
+    entry.prevNext = &head;
+    head           = &entry;
+    activeCount++;
+}
+
+/**
+ * @brief Removes entry from whatever list it is linked into.
+ *
+ * @warning Call from inside critical section only.
+ *
+ * @param entry Linked entry.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::unlink(Entry& entry)
+{
+    *entry.prevNext = entry.next;
+    if (entry.next != nullptr) {
+        entry.next->prevNext = entry.prevNext;
+    }
+    entry.next     = nullptr;
+    entry.prevNext = nullptr;
+    activeCount--;
+}
+
+/**
+ * @brief Starts the RTOS timer after the first entry got linked.
+ *
+ * @details If the timer queue is full, the wheel is marked idle again, so
+ * the next Entry::start() retries.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::startTimer()
+{
+    if (Timer::start() != Error::None) {
+        taskENTER_CRITICAL();
+        running = false;
+        taskEXIT_CRITICAL();
+    }
+}
+
+/**
+ * @brief Stops the RTOS timer if no entry is active anymore.
+ *
+ * @details The scheduler is suspended so no task can link an entry between
+ * the check and the stop command. A later Entry::start() then queues its
+ * start command behind the stop. If the timer queue is full, the wheel
+ * keeps ticking and tries again next tick.
+ */
+template<size_t slotCount>
+void RTOS::TimerWheel<slotCount>::stopTimerIfEmpty()
+{
+    vTaskSuspendAll();
+    if (activeCount == 0 && Timer::stop(0) == Error::None) {
+        running = false;
+    }
+    xTaskResumeAll();
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
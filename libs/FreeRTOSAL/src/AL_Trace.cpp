@@ -0,0 +1,274 @@
+/**
+ * @file AL_Trace.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compact binary trace recorder in a RAM ring
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Trace.h"
+
+#include <algorithm>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+RTOS::Trace::Record   RTOS::Trace::records[kRecords] {};
+std::atomic<uint32_t> RTOS::Trace::writeIndex {0};
+std::atomic<bool>     RTOS::Trace::enabled {false};
+std::atomic<bool>     RTOS::Trace::queueSlotUsed[kMaxQueues] {};
+char         RTOS::Trace::queueNames[kMaxQueues][sizeof(DumpName::name)] {};
+TaskStatus_t RTOS::Trace::taskStates[configPROFILER_MAX_TASKS] {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(configUSE_TRACE_FACILITY == 1,
+              "RTOS::Trace needs task numbers of the trace facility");
+static_assert(sizeof(RTOS::Trace::DumpHeader) == 20 &&
+                  sizeof(RTOS::Trace::DumpName) == 16,
+              "dump layout is read by tools/TraceConverter");
+
+//------------------------------- PROTOTYPES ----------------------------------
+
+static void copyName(char (&destination)[sizeof(RTOS::Trace::DumpName::name)],
+                     const char* source);
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Starts recording, records of earlier runs are kept.
+ *
+ */
+void RTOS::Trace::enable()
+{
+    rtosTraceTimestampInit();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Stops recording, the ring keeps its content for a dump.
+ *
+ */
+void RTOS::Trace::disable()
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Drops all records.
+ *
+ */
+void RTOS::Trace::clear()
+{
+    writeIndex.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Writes header, task and queue names and all records in the ring to
+ * sink, see DumpHeader for the layout.
+ *
+ * @details Recording is paused during the dump, so the ring does not change
+ * while it is read. Events that happen in the meantime are lost.
+ *
+ * @warning Not thread safe, dump from one task only.
+ *
+ * @param sink Receives the dump in several write() calls.
+ * @return Error::Code first error of sink, OutOfResources if there are more
+ * than configPROFILER_MAX_TASKS tasks.
+ */
+Error::Code RTOS::Trace::dump(Sink& sink)
+{
+    bool wasEnabled = enabled.exchange(false, std::memory_order_relaxed);
+    auto result     = dumpAll(sink);
+    enabled.store(wasEnabled, std::memory_order_relaxed);
+    return result;
+}
+
+/**
+ * @brief Assigns a number to a queue, used as its id in queue events.
+ * Called by RTOS::Queue on construction.
+ *
+ * @param name Name of the queue, gets copied.
+ * @return uint8_t 1 to kMaxQueues, 0 if all numbers are taken.
+ */
+uint8_t RTOS::Trace::registerQueue(const char* name)
+{
+    for (size_t i = 0; i < kMaxQueues; ++i) {
+        if (!queueSlotUsed[i].exchange(true, std::memory_order_acquire)) {
+            copyName(queueNames[i], name ? name : "");
+            return static_cast<uint8_t>(i + 1);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Releases the number of a queue that gets destructed.
+ *
+ * @param number Result of registerQueue().
+ */
+void RTOS::Trace::unregisterQueue(uint8_t number)
+{
+    if ((number > 0) && (number <= kMaxQueues)) {
+        queueSlotUsed[number - 1].store(false, std::memory_order_release);
+    }
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Called by FreeRTOS whenever a task gets switched in, see
+ * traceTASK_SWITCHED_IN() in FreeRTOSConfig.h.
+ *
+ * @param taskNumber FreeRTOS task number of the new task.
+ */
+extern "C" void rtosTraceTaskSwitchedIn(uint32_t taskNumber)
+{
+    TRACE_EVENT(RTOS::Trace::TaskSwitchIn, taskNumber);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Writes the dump while recording is paused.
+ *
+ */
+Error::Code RTOS::Trace::dumpAll(Sink& sink)
+{
+    auto taskCount = uxTaskGetSystemState(taskStates,
+                                          configPROFILER_MAX_TASKS,
+                                          nullptr);
+    if (taskCount == 0) {
+        // buffer too small, FreeRTOS does not fill in anything
+        return Error::OutOfResources;
+    }
+    size_t queueCount = 0;
+    for (const auto& used : queueSlotUsed) {
+        queueCount += used.load(std::memory_order_relaxed) ? 1 : 0;
+    }
+
+    uint32_t written = writeIndex.load(std::memory_order_relaxed);
+    uint32_t span    = std::min<uint32_t>(written, kRecords);
+    uint32_t count   = 0;
+    Record   record {};
+    for (uint32_t i = written - span; i != written; ++i) {
+        count += readRecord(i, record) ? 1 : 0;
+    }
+
+    DumpHeader header {};
+    header.magic       = kDumpMagic;
+    header.version     = kDumpVersion;
+    header.nameCount   = static_cast<uint16_t>(taskCount + queueCount);
+    header.recordCount = count;
+    header.lostRecords = written - span;
+    header.timestampHz = configTRACE_TIMESTAMP_HZ;
+    RETURN_ON_ERROR(
+        sink.write(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+
+    RETURN_ON_ERROR(dumpNames(sink, taskCount));
+    return dumpRecords(sink, written - span, span, count);
+}
+
+/**
+ * @brief Writes a DumpName for every task in taskStates and every registered
+ * queue.
+ *
+ */
+Error::Code RTOS::Trace::dumpNames(Sink& sink, size_t taskCount)
+{
+    DumpName entry {};
+    entry.kind = TaskName;
+    for (size_t i = 0; i < taskCount; ++i) {
+        entry.number = static_cast<uint16_t>(taskStates[i].xTaskNumber);
+        copyName(entry.name, taskStates[i].pcTaskName);
+        RETURN_ON_ERROR(
+            sink.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)));
+    }
+
+    entry.kind = QueueName;
+    for (size_t i = 0; i < kMaxQueues; ++i) {
+        if (!queueSlotUsed[i].load(std::memory_order_relaxed)) {
+            continue;
+        }
+        entry.number = static_cast<uint16_t>(i + 1);
+        std::memcpy(entry.name, queueNames[i], sizeof(entry.name));
+        RETURN_ON_ERROR(
+            sink.write(reinterpret_cast<const uint8_t*>(&entry), sizeof(entry)));
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Writes the first count finished records of the span slots starting
+ * with index first, skipping unfinished ones.
+ *
+ * @details count was taken before the names were written. An event that
+ * was interrupted by the dump might finish while the sink blocks, it is left
+ * out once count records are written. An event that started before the
+ * dump paused recording might reserve an old slot in the meantime, the last
+ * record gets repeated then so the dump keeps the size of its header.
+ */
+Error::Code RTOS::Trace::dumpRecords(Sink&    sink,
+                                     uint32_t first,
+                                     uint32_t span,
+                                     uint32_t count)
+{
+    Record batch[kDumpBatch];
+    Record record {};
+    size_t used = 0;
+    for (uint32_t i = 0; count > 0; ++i) {
+        if (i < span && !readRecord(first + i, record)) {
+            continue;
+        }
+        batch[used++] = record;
+        count--;
+        if (used == kDumpBatch || count == 0) {
+            RETURN_ON_ERROR(
+                sink.write(reinterpret_cast<const uint8_t*>(batch),
+                           used * sizeof(Record)));
+            used = 0;
+        }
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Copies a record if its event is complete.
+ *
+ * @param index Counts all events, like writeIndex.
+ * @param record Set to the record, unchanged if false.
+ * @return true record is finished, false its event is still written.
+ */
+bool RTOS::Trace::readRecord(uint32_t index, Record& record)
+{
+    const Record& slot = records[index & (kRecords - 1)];
+    uint32_t idAndArg  = __atomic_load_n(&slot.idAndArg, __ATOMIC_ACQUIRE);
+    uint32_t timestamp = slot.timestamp;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (idAndArg == 0 ||
+        __atomic_load_n(&slot.idAndArg, __ATOMIC_RELAXED) != idAndArg) {
+        return false;
+    }
+    record.timestamp = timestamp;
+    record.idAndArg  = idAndArg;
+    return true;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Copies a name, truncated without 0 termination if it is too long.
+ *
+ */
+static void copyName(char (&destination)[sizeof(RTOS::Trace::DumpName::name)],
+                     const char* source)
+{
+    size_t length = strnlen(source, sizeof(destination));
+    std::memset(destination, 0, sizeof(destination));
+    std::memcpy(destination, source, length);
+}
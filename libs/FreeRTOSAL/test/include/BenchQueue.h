@@ -0,0 +1,77 @@
+/**
+ * @file BenchQueue.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmarks of the RTOS::Queue APIs
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHQUEUE_H__
+#define __BENCHQUEUE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Bench
+{
+class QueueTransfer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Queue.h"
+#include "BenchCase.h"
+
+#include <cstdint>
+
+namespace Bench
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief one message in and out of a queue, without blocking.
+ *
+ * @details Same message as Test::Queue, each API pair is its own case.
+ */
+class QueueTransfer : public Case
+{
+    /**
+     * @brief which API moves the message
+     */
+    enum class Api {
+        SendReceive, /**< send() + receive(), four copies */
+        EmplaceReceiveInto, /**< emplace() + receiveInto(), two copies */
+        EmplacePeekRef /**< emplace() + peekRef() + drop(), one copy */
+    };
+
+    struct Message
+    {
+        uint32_t id;
+        uint8_t payload[28];
+    };
+
+public:
+    // delete default constructors
+    QueueTransfer() = delete;
+    QueueTransfer(const QueueTransfer &other) = delete;
+    QueueTransfer &operator=(const QueueTransfer &other) = delete;
+
+private:
+    QueueTransfer(const char *const caseName, Api api);
+    virtual void runBatch(uint16_t batch) final;
+    virtual uint32_t getBytesCopied() final;
+
+    static RTOS::Queue<Message, 8> &getQueue();
+
+    const Api api;
+
+    static QueueTransfer sendReceive;
+    static QueueTransfer emplaceReceiveInto;
+    static QueueTransfer emplacePeekRef;
+};
+}  // namespace Bench
+#endif  //__BENCHQUEUE_H__
@@ -0,0 +1,119 @@
+/**
+ * @file TestAsyncObserver.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing observers with their own queue and task
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTASYNCOBSERVER_H__
+#define __TESTASYNCOBSERVER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class AsyncObserver;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_AsyncObserver.h"
+#include "TestBase.h"
+
+#include <array>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing observers with their own queue and task.
+ *
+ * @details The observer tasks run below the test task, so nothing gets
+ * delivered while the test task triggers a burst.
+ */
+class AsyncObserver : public Test::Base
+{
+    /** messages an observer queues */
+    static constexpr size_t kQueueLength = 4;
+    /** messages triggered per burst */
+    static constexpr uint32_t kBurst = 10;
+    /** Stack size of the observer tasks */
+    static constexpr size_t kStackSize = 128;
+    /** below the test task */
+    static constexpr uint8_t kObserverPriority = 0;
+
+    /**
+     * @brief makes trigger() accessible
+     */
+    struct Subject : public Patterns::Observable<uint32_t>
+    {
+        using Patterns::Observable<uint32_t>::trigger;
+    };
+
+    /**
+     * @brief message built from the trigger argument
+     */
+    struct Message
+    {
+        uint32_t value;
+    };
+
+    /**
+     * @brief records all values it receives
+     */
+    class Recorder :
+        public RTOS::AsyncObserver<Message, kQueueLength, kStackSize, uint32_t>
+    {
+    public:
+        Recorder(Subject &subject, const char *const name, RTOS::Overflow policy);
+
+        /** received values in order */
+        std::array<uint32_t, kBurst> values;
+        /** number of received values */
+        volatile uint32_t count;
+
+    private:
+        virtual void onMessage(const Message &message) final;
+    };
+
+    // constructors
+public:
+    // delete default constructors
+    AsyncObserver(const AsyncObserver &other) = delete;
+    AsyncObserver &operator=(const AsyncObserver &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static AsyncObserver &getInstance();
+
+private:
+    AsyncObserver();
+
+    // Test::Base
+    virtual void runInternal() final;
+
+    void testDropping();
+    void testBlocking();
+    void waitForDelivery(Recorder &recorder, uint32_t count);
+
+    /** subject of the dropping observers */
+    Subject droppingSubject;
+    /** subject of the blocking observer */
+    Subject blockingSubject;
+    Recorder dropNewest;
+    Recorder dropOldest;
+    Recorder blocking;
+
+    /** singleton instance */
+    static AsyncObserver instance;
+};
+}  // namespace Test
+#endif  //__TESTASYNCOBSERVER_H__
@@ -0,0 +1,171 @@
+/**
+ * @file TestCoTask.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing stackless tasks on an executor
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTCOTASK_H__
+#define __TESTCOTASK_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class CoTask;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CoExecutor.h"
+#include "AL_CoTask.h"
+#include "AL_Event.h"
+#include "AL_Mutex.h"
+#include "AL_Queue.h"
+#include "AL_Task.h"
+#include "TestBase.h"
+
+#include <array>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing RTOS::CoTask and RTOS::CoExecutor.
+ *
+ * @details The benchmark feeds the same items to consumers implemented as
+ * one RTOS task each and to consumers implemented as CoTasks sharing one
+ * executor.
+ */
+class CoTask : public Test::Base
+{
+    /** Stack size of executor and consumer tasks */
+    static constexpr size_t kStackSize = 128;
+    /** same priority as the test task */
+    static constexpr uint8_t kPriority = 1;
+    /** consumers per benchmark */
+    static constexpr size_t kConsumers = 4;
+    /** queue length of each consumer */
+    static constexpr size_t kQueueLength = 4;
+
+    using Executor = RTOS::CoExecutor<kStackSize>;
+
+    /**
+     * @brief walks through every kind of Await, one per resume
+     */
+    class Sequence : public RTOS::CoTask
+    {
+    public:
+        Sequence(Executor &executor, RTOS::Mutex &mutex);
+
+        /** triggered by the test */
+        RTOS::Event event;
+        /** results of all resumes after the first */
+        std::array<Error::Code, 5> results;
+        /** number of resumes */
+        volatile size_t step;
+
+    private:
+        virtual RTOS::Await onResume(Error::Code result) final;
+
+        RTOS::Mutex &mutex;
+        /** queue without send event, can not be awaited */
+        RTOS::Queue<uint32_t, 1> queue;
+        uint32_t                 item;
+    };
+
+    /**
+     * @brief consumer implemented as CoTask
+     */
+    class CoConsumer : public RTOS::CoTask
+    {
+    public:
+        CoConsumer(Executor &executor);
+
+        RTOS::Queue<uint32_t, kQueueLength> queue;
+        /** number of items consumed, only written by the consumer */
+        volatile uint32_t consumed;
+        /** set if an item came out of order */
+        volatile bool outOfOrder;
+
+    private:
+        virtual RTOS::Await onResume(Error::Code result) final;
+
+        RTOS::Event sendEvent;
+        uint32_t    item;
+        bool        started;
+    };
+
+    /**
+     * @brief consumer implemented as RTOS task
+     */
+    class TaskConsumer
+    {
+        friend RTOS::Task<kStackSize, TaskConsumer>;
+
+    public:
+        // delete default constructors
+        TaskConsumer(const TaskConsumer &other) = delete;
+        TaskConsumer &operator=(const TaskConsumer &other) = delete;
+
+        TaskConsumer();
+
+        RTOS::Queue<uint32_t, kQueueLength> queue;
+        /** number of items consumed, only written by the consumer */
+        volatile uint32_t consumed;
+        /** set if an item came out of order */
+        volatile bool outOfOrder;
+
+    private:
+        /** instantiate after all other RTOS objects */
+        RTOS::Task<kStackSize, TaskConsumer> task;
+
+        void onStart();
+        void onRun();
+    };
+
+    // constructors
+public:
+    // delete default constructors
+    CoTask(const CoTask &other) = delete;
+    CoTask &operator=(const CoTask &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static CoTask &getInstance();
+
+private:
+    CoTask();
+
+    // Test::Base
+    virtual void                          runInternal() final;
+    virtual const std::list<Test::Base *> getPrerequisits() final;
+
+    /**
+     * @brief sends items round robin, yields until all are consumed.
+     * @return uint32_t context switches in total
+     */
+    template<class ConsumerT>
+    uint32_t benchmark(std::array<ConsumerT, kConsumers> &consumers);
+
+    /** executor for all CoTasks */
+    Executor executor;
+    /** locked by the test, awaited by sequence */
+    RTOS::Mutex mutex;
+    Sequence    sequence;
+    std::array<CoConsumer, kConsumers> coConsumers;
+    std::array<TaskConsumer, kConsumers> taskConsumers;
+
+    /** singleton instance */
+    static CoTask instance;
+};
+}  // namespace Test
+#endif  //__TESTCOTASK_H__
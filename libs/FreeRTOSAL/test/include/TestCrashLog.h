@@ -0,0 +1,84 @@
+/**
+ * @file TestCrashLog.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing error site IDs and the crash log ring
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTCRASHLOG_H__
+#define __TESTCRASHLOG_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class CrashLog;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_CrashLog.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing error site IDs and the crash log ring.
+ */
+class CrashLog : public Test::Base
+{
+    /**
+     * @brief keeps the ring in RAM instead of flash
+     */
+    class RamStore : public Diagnostics::CrashLog::Store
+    {
+    public:
+        RamStore();
+
+        virtual Error::Code load(Diagnostics::CrashLog::Ring &ring) final;
+        virtual Error::Code
+            store(const Diagnostics::CrashLog::Ring &ring) final;
+
+        Diagnostics::CrashLog::Ring ring;
+        /** nothing stored yet */
+        bool empty;
+        /** store() fails while set */
+        bool broken;
+    };
+
+    // constructors
+public:
+    // delete default constructors
+    CrashLog(const CrashLog &other) = delete;
+    CrashLog &operator=(const CrashLog &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static CrashLog &getInstance();
+
+private:
+    CrashLog();
+
+    // Test::Base
+    virtual void runInternal() final;
+
+    void testSites();
+    void testCommit();
+    void testRing();
+
+    RamStore store;
+
+    /** singleton instance */
+    static CrashLog instance;
+};
+}  // namespace Test
+#endif  //__TESTCRASHLOG_H__
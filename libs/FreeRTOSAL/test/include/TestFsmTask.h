@@ -0,0 +1,115 @@
+/**
+ * @file TestFsmTask.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing state machines driven by their own task
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTFSMTASK_H__
+#define __TESTFSMTASK_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class FsmTask;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FsmTask.h"
+#include "TestBase.h"
+
+#include <cstdint>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing state machines driven by their own task.
+ *
+ * @details The state machine task runs below the test task, so nothing gets
+ * dispatched while the test task posts a burst.
+ */
+class FsmTask : public Test::Base
+{
+    /** events the state machine queues */
+    static constexpr size_t kQueueLength = 4;
+    /** Stack size of the state machine task */
+    static constexpr size_t kStackSize = 128;
+    /** below the test task */
+    static constexpr uint8_t kFsmPriority = 0;
+
+    /**
+     * @brief counts the actions of the state machine
+     */
+    struct Lamp
+    {
+        volatile uint32_t switchedOn  = 0;
+        volatile uint32_t switchedOff = 0;
+        volatile uint32_t brightened  = 0;
+
+        void onEntry() { switchedOn = switchedOn + 1; }
+        void offEntry() { switchedOff = switchedOff + 1; }
+        void brighten() { brightened = brightened + 1; }
+    };
+
+    /**
+     * @brief lamp that is off or on, dimmed or bright
+     */
+    struct Machine
+    {
+        using Context = Lamp;
+        enum class State : uint8_t { Off, On, Dim, Bright, Count };
+        enum class Event : uint8_t { Toggle, Brighten, Count };
+
+        static constexpr State kInitial = State::Off;
+        static constexpr Patterns::FsmState<Lamp, State> states[] = {
+            {State::Off, State::Count, State::Count, &Lamp::offEntry, nullptr},
+            {State::On, State::Count, State::Dim, &Lamp::onEntry, nullptr},
+            {State::Dim, State::On, State::Count, nullptr, nullptr},
+            {State::Bright, State::On, State::Count, nullptr, nullptr}};
+        static constexpr Patterns::FsmTransition<Lamp, State, Event>
+            transitions[] = {
+                {State::Off, Event::Toggle, State::On, nullptr},
+                {State::On, Event::Toggle, State::Off, nullptr},
+                {State::Dim, Event::Brighten, State::Bright, &Lamp::brighten}};
+    };
+
+    using State = Machine::State;
+    using Event = Machine::Event;
+
+    // constructors
+public:
+    // delete default constructors
+    FsmTask(const FsmTask &other) = delete;
+    FsmTask &operator=(const FsmTask &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static FsmTask &getInstance();
+
+private:
+    FsmTask();
+
+    // Test::Base
+    virtual void runInternal() final;
+
+    void waitForActions(uint32_t on, uint32_t off);
+
+    Lamp lamp;
+    RTOS::FsmTask<Machine, kQueueLength, kStackSize> fsmTask;
+
+    /** singleton instance */
+    static FsmTask instance;
+};
+}  // namespace Test
+#endif  //__TESTFSMTASK_H__
@@ -0,0 +1,61 @@
+/**
+ * @file TestProfiler.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS profiler
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTPROFILER_H__
+#define __TESTPROFILER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Profiler;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Profiler.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing RTOS profiler
+ */
+class Profiler : public Test::Base
+{
+    // constructors
+public:
+    // delete default constructors
+    Profiler(const Profiler &other) = delete;
+    Profiler &operator=(const Profiler &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static Profiler &getInstance();
+
+private:
+    Profiler();
+
+    virtual void runInternal() final;
+
+    /** find the task running the tests in the snapshot */
+    const RTOS::Profiler::TaskSample *findCurrentTask();
+
+    /** singleton instance */
+    static Profiler instance;
+};
+}  // namespace Test
+#endif  //__TESTPROFILER_H__
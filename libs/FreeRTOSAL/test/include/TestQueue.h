@@ -51,8 +51,18 @@ private:
 
     virtual void runInternal() final;
 
+    /**
+     * @brief payload roughly the size of the BLE scanner / advertiser messages
+     */
+    struct Message {
+        uint32_t id;
+        uint8_t  payload[28];
+    };
+
     /** queue used for testing */
     RTOS::Queue<uint64_t, 8> queue1;
+    /** queue used for zero copy API */
+    RTOS::Queue<Message, 8> queue2;
     static const char *const name;
 
     /** singleton instance */
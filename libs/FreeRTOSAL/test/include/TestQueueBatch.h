@@ -0,0 +1,115 @@
+/**
+ * @file TestQueueBatch.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing batched queue receive and batch mode of tasks
+ * @version 1.0
+ * @date 2020-10-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTQUEUEBATCH_H__
+#define __TESTQUEUEBATCH_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class QueueBatch;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Queue.h"
+#include "AL_Task.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing Queue::receiveBatch() and RTOS::ITask::RunMode::Batch.
+ *
+ * @details The benchmark lets the test task produce bursts for a consumer
+ * task of same priority, that stays ready while the consumer works. Once
+ * with one item and a forced yield per onRun(), once batched.
+ */
+class QueueBatch : public Test::Base
+{
+    /** items the producer sends at once */
+    static constexpr size_t kBurstSize = 8;
+    /** Stack size of the consumer tasks */
+    static constexpr size_t kStackSize = 128;
+    /** same priority as the test task */
+    static constexpr uint8_t kConsumerPriority = 1;
+
+    /**
+     * @brief consumer task, either receiving one item or a whole batch
+     */
+    class Consumer
+    {
+        friend RTOS::Task<kStackSize, Consumer>;
+
+    public:
+        // delete default constructors
+        Consumer(const Consumer &other) = delete;
+        Consumer &operator=(const Consumer &other) = delete;
+
+        Consumer(const char *const name, RTOS::ITask::RunMode mode);
+
+        /** queue the consumer drains */
+        RTOS::Queue<uint32_t, kBurstSize> queue;
+        /** number of items consumed, only written by the consumer */
+        volatile uint32_t consumed;
+        /** set if an item came out of order */
+        volatile bool outOfOrder;
+
+    private:
+        const RTOS::ITask::RunMode mode;
+        /** instantiate after all other RTOS objects */
+        RTOS::Task<kStackSize, Consumer> task;
+
+        void onStart();
+        void onRun();
+    };
+
+    // constructors
+public:
+    // delete default constructors
+    QueueBatch(const QueueBatch &other) = delete;
+    QueueBatch &operator=(const QueueBatch &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static QueueBatch &getInstance();
+
+private:
+    QueueBatch();
+
+    // Test::Base
+    virtual void                          runInternal() final;
+    virtual const std::list<Test::Base *> getPrerequisits() final;
+
+    /**
+     * @brief sends bursts to consumer, yields until all is consumed.
+     * @return double context switches per item
+     */
+    double benchmark(Consumer &consumer);
+
+    /** queue without consumer for testing the API */
+    RTOS::Queue<uint32_t, kBurstSize> queue;
+    /** consumer receiving one item per onRun() */
+    Consumer singleConsumer;
+    /** consumer receiving batches in batch mode */
+    Consumer batchConsumer;
+
+    /** singleton instance */
+    static QueueBatch instance;
+};
+}  // namespace Test
+#endif  //__TESTQUEUEBATCH_H__
@@ -0,0 +1,76 @@
+/**
+ * @file TestSimulation.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS simulation in virtual time
+ * @version 1.0
+ * @date 2020-11-06
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTSIMULATION_H__
+#define __TESTSIMULATION_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Simulation;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Simulation.h"
+#include "AL_Timer.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing RTOS simulation in virtual time
+ */
+class Simulation : public Test::Base, RTOS::Timer
+{
+    // constructors
+public:
+    // delete default constructors
+    Simulation(const Simulation &other) = delete;
+    Simulation &operator=(const Simulation &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static Simulation &getInstance();
+
+private:
+    Simulation();
+
+    // Test::Base
+    virtual void runInternal() final;
+
+    // RTOS::Timer
+    virtual void onTimer() final;
+
+    /** a long delay, a timer and a periodic task in virtual time */
+    void testVirtualTime();
+    /** random() repeats with the same seed */
+    void testRandom();
+
+    /** expirations of the timer, counted in the timer task */
+    volatile uint32_t expirations;
+
+    /** singleton instance */
+    static Simulation instance;
+
+    /** period of the restarting timer */
+    static constexpr RTOS::milliseconds kTimerPeriod = 10 * 60 * 1000;
+    /** virtual time the test waits */
+    static constexpr RTOS::milliseconds kSimulatedTime = 60 * 60 * 1000;
+};
+}  // namespace Test
+#endif  //__TESTSIMULATION_H__
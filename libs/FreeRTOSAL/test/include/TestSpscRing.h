@@ -0,0 +1,69 @@
+/**
+ * @file TestSpscRing.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing lock-free ring buffer
+ * @version 1.0
+ * @date 2020-10-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTSPSCRING_H__
+#define __TESTSPSCRING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class SpscRing;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_SpscRing.h"
+#include "AL_Timer.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing lock-free ring buffer.
+ *
+ * @details Timer task acts as producer for the blocking tests.
+ */
+class SpscRing : public Test::Base, RTOS::Timer
+{
+    // constructors
+public:
+    // delete default constructors
+    SpscRing(const SpscRing &other) = delete;
+    SpscRing &operator=(const SpscRing &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static SpscRing &getInstance();
+
+private:
+    SpscRing();
+
+    // Test::Base
+    virtual void                          runInternal() final;
+    virtual const std::list<Test::Base *> getPrerequisits() final;
+
+    // RTOS::Timer
+    virtual void onTimer() final;
+
+    /** ring used for testing */
+    RTOS::SpscRing<uint32_t, 4> ring;
+
+    /** singleton instance */
+    static SpscRing instance;
+};
+}  // namespace Test
+#endif  //__TESTSPSCRING_H__
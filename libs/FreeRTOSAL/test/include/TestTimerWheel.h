@@ -0,0 +1,134 @@
+/**
+ * @file TestTimerWheel.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing timing wheel
+ * @version 1.0
+ * @date 2020-10-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTTIMERWHEEL_H__
+#define __TESTTIMERWHEEL_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class TimerWheel;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Timer.h"
+#include "AL_TimerWheel.h"
+#include "TestBase.h"
+
+#include <array>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing RTOS::TimerWheel.
+ *
+ * @details The benchmark restarts the activity timeout of many simulated
+ * devices round robin, like the BLE scanner does for every advertisement.
+ * Once with a wheel entry per device, once with an RTOS::Timer per device.
+ */
+class TimerWheel : public Test::Base
+{
+    /** slots of the wheel under test */
+    static constexpr size_t kSlots = 16;
+    /** resolution of the wheel under test */
+    static constexpr RTOS::milliseconds kResolution = 10;
+#ifdef HOST
+    /** simulated devices in the benchmark */
+    static constexpr size_t kDevices = 1000;
+#else
+    /** simulated devices in the benchmark, limited by RAM */
+    static constexpr size_t kDevices = 32;
+#endif
+    /** timeout of the simulated devices, long enough to never expire */
+    static constexpr RTOS::milliseconds kDeviceTimeout = 10000;
+
+    using Wheel = RTOS::TimerWheel<kSlots>;
+
+    /**
+     * @brief entry counting its expirations
+     */
+    class Entry : public Wheel::Entry
+    {
+    public:
+        Entry(Wheel &wheel, RTOS::milliseconds timeout);
+
+        /** number of onExpired() calls */
+        volatile uint32_t expirations;
+
+    private:
+        virtual void onExpired() final;
+    };
+
+    /**
+     * @brief activity timeout of a simulated device in the benchmark wheel
+     */
+    class DeviceEntry : public Entry
+    {
+    public:
+        DeviceEntry();
+    };
+
+    /**
+     * @brief activity timer of a simulated device, the way it was before
+     */
+    class DeviceTimer : public RTOS::Timer
+    {
+    public:
+        DeviceTimer();
+    };
+
+    // constructors
+public:
+    // delete default constructors
+    TimerWheel(const TimerWheel &other) = delete;
+    TimerWheel &operator=(const TimerWheel &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static TimerWheel &getInstance();
+
+private:
+    TimerWheel();
+
+    // Test::Base
+    virtual void                          runInternal() final;
+    virtual const std::list<Test::Base *> getPrerequisits() final;
+
+    /** restarts all wheel entries, returns run time counter ticks spent */
+    uint32_t benchmarkWheel();
+    /** restarts all RTOS timers, returns run time counter ticks spent */
+    uint32_t benchmarkTimers();
+
+    /** wheel used for testing */
+    Wheel wheel;
+    /** expires after 5 wheel ticks */
+    Entry shortEntry;
+    /** expires after more than one wheel revolution */
+    Entry longEntry;
+    /** one wheel entry per simulated device */
+    std::array<DeviceEntry, kDevices> wheelDevices;
+    /** one RTOS timer per simulated device */
+    std::array<DeviceTimer, kDevices> timerDevices;
+
+    /** separate wheel for the benchmark, constructed before instance */
+    static Wheel benchWheel;
+    /** singleton instance */
+    static TimerWheel instance;
+};
+}  // namespace Test
+#endif  //__TESTTIMERWHEEL_H__
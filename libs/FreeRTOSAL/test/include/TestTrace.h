@@ -0,0 +1,85 @@
+/**
+ * @file TestTrace.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS trace recorder
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTTRACE_H__
+#define __TESTTRACE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Trace;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_Trace.h"
+#include "TestBase.h"
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief testing RTOS trace recorder
+ */
+class Trace : public Test::Base
+{
+    // constructors
+public:
+    // delete default constructors
+    Trace(const Trace &other) = delete;
+    Trace &operator=(const Trace &other) = delete;
+
+    /**
+     * @brief get singleton instance
+     */
+    static Trace &getInstance();
+
+private:
+    Trace();
+
+    virtual void runInternal() final;
+
+    /** collects a dump in memory */
+    class MemorySink : public RTOS::Trace::Sink
+    {
+    public:
+        virtual Error::Code write(const uint8_t *data, size_t length) final;
+
+        /** the dump */
+        uint8_t bytes[sizeof(RTOS::Trace::DumpHeader) +
+                      (configPROFILER_MAX_TASKS + RTOS::Trace::kMaxQueues) *
+                          sizeof(RTOS::Trace::DumpName) +
+                      RTOS::Trace::kRecords * sizeof(RTOS::Trace::Record)];
+        /** bytes written */
+        size_t size;
+    };
+
+    /** dump into sink, check the header */
+    void takeDump();
+    /** find the last record with id in the dump */
+    bool findLast(uint8_t id, RTOS::Trace::Record &outRecord);
+    /** find a name in the dump */
+    bool findName(uint8_t kind, const char *name, RTOS::Trace::DumpName &outName);
+
+    /** last dump */
+    MemorySink sink;
+    /** header of the last dump */
+    RTOS::Trace::DumpHeader header;
+
+    /** singleton instance */
+    static Trace instance;
+};
+}  // namespace Test
+#endif  //__TESTTRACE_H__
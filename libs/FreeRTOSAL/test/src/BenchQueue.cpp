@@ -0,0 +1,107 @@
+/**
+ * @file BenchQueue.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmarks of the RTOS::Queue APIs
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchQueue.h"
+
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Bench::QueueTransfer Bench::QueueTransfer::sendReceive {"Queue.sendReceive",
+                                                        Api::SendReceive};
+Bench::QueueTransfer Bench::QueueTransfer::emplaceReceiveInto {
+    "Queue.emplaceReceiveInto",
+    Api::EmplaceReceiveInto};
+Bench::QueueTransfer Bench::QueueTransfer::emplacePeekRef {
+    "Queue.emplacePeekRef",
+    Api::EmplacePeekRef};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** keeps the compiler from dropping results */
+static volatile uint32_t sink = 0;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Bench::QueueTransfer::QueueTransfer(const char *const caseName, Api api)
+        : Case("RTOS", caseName, 32), api(api)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Bench::QueueTransfer::runBatch(uint16_t batch)
+{
+    auto &queue = getQueue();
+    Message msg {};
+
+    for (uint16_t i = 0; i < batch; i++) {
+        switch (api) {
+            case Api::SendReceive: {
+                Message tmp {i, {}};
+                CHECK_ERROR(queue.send(std::move(tmp), 0));
+                CHECK_ERROR(queue.receive(msg, 0));
+                break;
+            }
+            case Api::EmplaceReceiveInto:
+                CHECK_ERROR(queue.emplace(0, i));
+                CHECK_ERROR(queue.receiveInto(msg, 0));
+                break;
+            case Api::EmplacePeekRef: {
+                const Message *ref = nullptr;
+                CHECK_ERROR(queue.emplace(0, i));
+                CHECK_ERROR(queue.peekRef(ref));
+                if (ref != nullptr) {
+                    msg.id = ref->id;
+                } else {
+                    CHECK_ERROR(Error::Unknown);
+                }
+                CHECK_ERROR(queue.drop());
+                break;
+            }
+        }
+    }
+    sink = msg.id;
+}
+
+/**
+ * @brief message bytes copied per transfer, see Api.
+ *
+ */
+uint32_t Bench::QueueTransfer::getBytesCopied()
+{
+    switch (api) {
+        case Api::SendReceive:
+            return 4 * sizeof(Message);
+        case Api::EmplaceReceiveInto:
+            return 2 * sizeof(Message);
+        case Api::EmplacePeekRef:
+            return sizeof(Message);
+    }
+    return 0;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Queue shared by all cases, created on first use.
+ *
+ */
+RTOS::Queue<Bench::QueueTransfer::Message, 8> &Bench::QueueTransfer::getQueue()
+{
+    static RTOS::Queue<Message, 8> queue {"BenchQueue"};
+    return queue;
+}
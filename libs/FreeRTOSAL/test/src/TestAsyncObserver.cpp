@@ -0,0 +1,147 @@
+/**
+ * @file TestAsyncObserver.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing observers with their own queue and task
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestAsyncObserver.h"
+#include "AL_ITask.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::AsyncObserver Test::AsyncObserver::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::AsyncObserver::AsyncObserver()
+        : Test::Base("RTOS", "AsyncObserver"), droppingSubject(),
+          blockingSubject(),
+          dropNewest(droppingSubject, "DropNewest", RTOS::Overflow::DropNewest),
+          dropOldest(droppingSubject, "DropOldest", RTOS::Overflow::DropOldest),
+          blocking(blockingSubject, "Blocking", RTOS::Overflow::Block)
+{}
+
+Test::AsyncObserver &Test::AsyncObserver::getInstance()
+{
+    return instance;
+}
+
+Test::AsyncObserver::Recorder::Recorder(Subject &            subject,
+                                        const char *const    name,
+                                        RTOS::Overflow       policy)
+        : RTOS::AsyncObserver<Message, kQueueLength, kStackSize, uint32_t>(
+              subject,
+              name,
+              kObserverPriority,
+              policy),
+          values(), count(0)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::AsyncObserver::runInternal()
+{
+    testDropping();
+    testBlocking();
+}
+
+void Test::AsyncObserver::Recorder::onMessage(const Message &message)
+{
+    if (count < values.size()) {
+        values[count] = message.value;
+    }
+    count = count + 1;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief a burst larger than the queues keeps the first or the last values
+ *
+ */
+void Test::AsyncObserver::testDropping()
+{
+    for (uint32_t i = 1; i <= kBurst; ++i) {
+        droppingSubject.trigger(i);
+    }
+    assert(dropNewest.count == 0 && dropOldest.count == 0,
+           "delivered within the triggering task");
+
+    waitForDelivery(dropNewest, kQueueLength);
+    waitForDelivery(dropOldest, kQueueLength);
+
+    uint32_t drops = kBurst - kQueueLength;
+    assert(dropNewest.getDropped() == drops,
+           "DropNewest dropped %u instead of %u",
+           dropNewest.getDropped(),
+           drops);
+    assert(dropOldest.getDropped() == drops,
+           "DropOldest dropped %u instead of %u",
+           dropOldest.getDropped(),
+           drops);
+    for (uint32_t i = 0; i < kQueueLength; ++i) {
+        assert(dropNewest.values[i] == i + 1,
+               "DropNewest got %u instead of %u",
+               dropNewest.values[i],
+               i + 1);
+        assert(dropOldest.values[i] == drops + i + 1,
+               "DropOldest got %u instead of %u",
+               dropOldest.values[i],
+               drops + i + 1);
+    }
+}
+
+/**
+ * @brief a full queue makes the triggering task wait, nothing gets lost
+ *
+ */
+void Test::AsyncObserver::testBlocking()
+{
+    for (uint32_t i = 1; i <= kBurst; ++i) {
+        blockingSubject.trigger(i);
+    }
+    // the overflow got received while the test task was blocked, the last
+    // one might still wait for onMessage() as the test task took over again
+    assert(blocking.count >= kBurst - kQueueLength - 1,
+           "only %u delivered during the burst",
+           blocking.count);
+
+    waitForDelivery(blocking, kBurst);
+    assert(blocking.getDropped() == 0,
+           "blocking observer dropped %u",
+           blocking.getDropped());
+    for (uint32_t i = 0; i < kBurst; ++i) {
+        assert(blocking.values[i] == i + 1,
+               "got %u instead of %u",
+               blocking.values[i],
+               i + 1);
+    }
+}
+
+/**
+ * @brief let the observer task run until it handled count messages
+ *
+ */
+void Test::AsyncObserver::waitForDelivery(Recorder &recorder, uint32_t count)
+{
+    for (size_t i = 0; (i < 100) && (recorder.getDelivered() < count); ++i) {
+        RTOS::ITask::delayCurrentTask(2);
+    }
+    assert(recorder.getDelivered() == count,
+           "%u instead of %u messages delivered",
+           recorder.getDelivered(),
+           count);
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,203 @@
+/**
+ * @file TestCoTask.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing stackless tasks on an executor
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestCoTask.h"
+#include "AL_ITask.h"
+#include "TestEvent.h"
+#include "TestMutex.h"
+#include "TestQueue.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::CoTask Test::CoTask::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** items sent to each consumer per benchmark */
+static constexpr uint32_t kItems = 200;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::CoTask::CoTask()
+        : Test::Base("RTOS", "CoTask"), executor("CoExecutor", kPriority),
+          mutex(), sequence(executor, mutex),
+          coConsumers {{{executor}, {executor}, {executor}, {executor}}},
+          taskConsumers()
+{}
+
+Test::CoTask &Test::CoTask::getInstance()
+{
+    return instance;
+}
+
+Test::CoTask::Sequence::Sequence(Executor &executor, RTOS::Mutex &mutex)
+        : RTOS::CoTask(executor), event(executor.getEventGroup()), results(),
+          step(0), mutex(mutex), queue("TestCoTask"), item(0)
+{}
+
+Test::CoTask::CoConsumer::CoConsumer(Executor &executor)
+        : RTOS::CoTask(executor), queue("CoConsumer"), consumed(0),
+          outOfOrder(false), sendEvent(executor.getEventGroup()), item(0),
+          started(false)
+{
+    queue.setSendEvent(&sendEvent);
+}
+
+Test::CoTask::TaskConsumer::TaskConsumer()
+        : queue("TaskConsumer"), consumed(0), outOfOrder(false),
+          task(*this, "TaskConsumer", kPriority)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::CoTask::runInternal()
+{
+    assert(executor.getCoTaskCount() == 1 + kConsumers,
+           "executor runs %u instead of %u CoTasks",
+           static_cast<unsigned int>(executor.getCoTaskCount()),
+           static_cast<unsigned int>(1 + kConsumers));
+
+    // sequence awaits event with timeout of 40ms
+    assert(mutex.tryObtain(0) == Error::None, "could not obtain mutex");
+    RTOS::ITask::delayCurrentTask(60);
+    assert(sequence.step == 2 && sequence.results[0] == Error::Timeout,
+           "event did not time out");
+
+    // then event without timeout, followed by a delay of 30ms
+    sequence.event.trigger();
+    RTOS::ITask::delayCurrentTask(10);
+    assert(sequence.step == 3 && sequence.results[1] == Error::None,
+           "triggered event did not resume");
+    RTOS::ITask::delayCurrentTask(50);
+    assert(sequence.step == 4 && sequence.results[2] == Error::None,
+           "delay did not resume");
+
+    // mutex is still held by this task
+    RTOS::ITask::delayCurrentTask(20);
+    assert(sequence.step == 4, "resumed without obtaining mutex");
+    assert(mutex.tryRelease() == Error::None, "could not release mutex");
+    RTOS::ITask::delayCurrentTask(20);
+    assert(sequence.step == 6 && sequence.results[3] == Error::None,
+           "mutex was not obtained");
+    assert(!mutex.isLocked(), "mutex was not released by CoTask");
+
+    // queue without send event
+    assert(sequence.results[4] == Error::InvalidParameter,
+           "awaiting queue without send event not rejected");
+    assert(sequence.isFinished(), "sequence not finished");
+
+    uint32_t taskSwitches = benchmark(taskConsumers);
+    uint32_t coSwitches   = benchmark(coConsumers);
+    bool     outOfOrder   = false;
+    for (size_t i = 0; i < kConsumers; ++i) {
+        outOfOrder = outOfOrder || taskConsumers[i].outOfOrder ||
+                     coConsumers[i].outOfOrder;
+    }
+    assert(!outOfOrder, "consumer received items out of order");
+    assert(coSwitches < taskSwitches,
+           "CoTasks caused more context switches than tasks");
+
+    size_t taskRam = sizeof(taskConsumers);
+    size_t coRam   = sizeof(coConsumers) + sizeof(executor);
+    print("\tbenchmark %u consumers, %u items each:",
+          static_cast<unsigned int>(kConsumers),
+          kItems);
+    print("\t\tRTOS::Task:\t%u context switches, %u bytes",
+          taskSwitches,
+          static_cast<unsigned int>(taskRam));
+    print("\t\tRTOS::CoTask:\t%u context switches, %u bytes",
+          coSwitches,
+          static_cast<unsigned int>(coRam));
+}
+
+const std::list<Test::Base *> Test::CoTask::getPrerequisits()
+{
+    return std::list<Test::Base *>({&Test::Event::getInstance(),
+                                    &Test::Mutex::getInstance(),
+                                    &Test::Queue::getInstance()});
+}
+
+RTOS::Await Test::CoTask::Sequence::onResume(Error::Code result)
+{
+    if (step > 0) {
+        results[step - 1] = result;
+    }
+
+    switch (step++) {
+        case 0:
+            return RTOS::Await::event(event, 40);
+        case 1:
+            return RTOS::Await::event(event);
+        case 2:
+            event.reset();
+            return RTOS::Await::delay(30);
+        case 3:
+            return RTOS::Await::obtain(mutex);
+        case 4:
+            mutex.tryRelease();
+            return RTOS::Await::receive(queue, item);
+        default:
+            return RTOS::Await::finished();
+    }
+}
+
+RTOS::Await Test::CoTask::CoConsumer::onResume(Error::Code result)
+{
+    if (started && result == Error::None) {
+        outOfOrder = outOfOrder || item != consumed;
+        consumed   = consumed + 1;
+    }
+    started = true;
+    return RTOS::Await::receive(queue, item);
+}
+
+void Test::CoTask::TaskConsumer::onStart()
+{
+    // nothing to prepare
+}
+
+void Test::CoTask::TaskConsumer::onRun()
+{
+    uint32_t item = 0;
+    if (queue.receive(item) == Error::None) {
+        outOfOrder = outOfOrder || item != consumed;
+        consumed   = consumed + 1;
+    }
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+template<class ConsumerT>
+uint32_t Test::CoTask::benchmark(std::array<ConsumerT, kConsumers> &consumers)
+{
+    uint32_t switchesStart = RTOS::getContextSwitchCount();
+
+    for (uint32_t item = 0; item < kItems; ++item) {
+        for (auto &consumer : consumers) {
+            uint32_t copy = item;
+            consumer.queue.send(std::move(copy), 0);
+        }
+        // stay ready, just like any other busy task of same priority
+        for (auto &consumer : consumers) {
+            while (consumer.consumed <= item) {
+                RTOS::ITask::yield();
+            }
+        }
+    }
+
+    return RTOS::getContextSwitchCount() - switchesStart;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,183 @@
+/**
+ * @file TestCrashLog.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing error site IDs and the crash log ring
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestCrashLog.h"
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::CrashLog Test::CrashLog::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(Error::getSiteLine(Error::makeSite("/src/Foo.cpp", 42)) == 42,
+              "line not in site ID");
+static_assert(Error::makeSite("/src/Foo.cpp", 42) ==
+                  Error::makeSite("C:\\src\\Foo.cpp", 42),
+              "directories change the site ID");
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::CrashLog::CrashLog() : Test::Base("Diagnostics", "CrashLog"), store() {}
+
+Test::CrashLog &Test::CrashLog::getInstance()
+{
+    return instance;
+}
+
+Test::CrashLog::RamStore::RamStore() : ring(), empty(true), broken(false) {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::CrashLog::runInternal()
+{
+    testSites();
+    testCommit();
+    testRing();
+}
+
+Error::Code Test::CrashLog::RamStore::load(Diagnostics::CrashLog::Ring &ring)
+{
+    if (empty) {
+        return Error::NotFound;
+    }
+    ring = this->ring;
+    return Error::None;
+}
+
+Error::Code
+    Test::CrashLog::RamStore::store(const Diagnostics::CrashLog::Ring &ring)
+{
+    if (broken) {
+        return Error::CommunicationFailed;
+    }
+    this->ring = ring;
+    empty      = false;
+    return Error::None;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief site IDs hold the line and tell files apart
+ *
+ */
+void Test::CrashLog::testSites()
+{
+    uint32_t line = __LINE__ + 1;
+    uint32_t site = ERROR_SITE;
+    assert(Error::getSiteLine(site) == line,
+           "site 0x%08X does not hold line %u",
+           site,
+           line);
+    assert(site >> Error::kSiteLineBits ==
+               Error::hashFileName("TestCrashLog.cpp"),
+           "site 0x%08X does not hold the file name hash",
+           site);
+    assert(Error::makeSite("TestCrashLog.cpp", line) !=
+               Error::makeSite("TestTrace.cpp", line),
+           "files are not told apart");
+    assert(Error::getSiteLine(Error::makeSite("Long.cpp", 100000)) ==
+               Error::kSiteLineMask,
+           "long file overflows into the hash");
+}
+
+/**
+ * @brief saved record is committed once, with the task that failed
+ *
+ */
+void Test::CrashLog::testCommit()
+{
+    Diagnostics::CrashLog::Record record {};
+    assert(!Diagnostics::CrashLog::hasPending(), "pending after start");
+    assert(Diagnostics::CrashLog::commit(store) == Error::NotFound,
+           "committed nothing");
+    assert(Diagnostics::CrashLog::read(store, 0, record) == Error::NotFound,
+           "read from empty store");
+
+    uint32_t site = ERROR_SITE;
+    Diagnostics::CrashLog::save(Error::Timeout, site);
+    assert(Diagnostics::CrashLog::hasPending(), "save not pending");
+
+    // failing store keeps the record
+    store.broken = true;
+    assert(Diagnostics::CrashLog::commit(store) == Error::CommunicationFailed,
+           "store error not returned");
+    assert(Diagnostics::CrashLog::hasPending(), "record lost on store error");
+    store.broken = false;
+
+    assert(Diagnostics::CrashLog::commit(store) == Error::None,
+           "commit failed");
+    assert(!Diagnostics::CrashLog::hasPending(), "still pending");
+    assert(Diagnostics::CrashLog::commit(store) == Error::NotFound,
+           "committed twice");
+
+    TaskStatus_t status {};
+    vTaskGetInfo(nullptr, &status, pdFALSE, eRunning);
+    assert(Diagnostics::CrashLog::read(store, 0, record) == Error::None,
+           "read failed");
+    assert(record.site == site && record.code == Error::Timeout &&
+               record.sequence == 1,
+           "record 0x%08X, code %u, #%u wrong",
+           record.site,
+           record.code,
+           record.sequence);
+    assert(record.task == status.xTaskNumber,
+           "task %u instead of %u",
+           record.task,
+           static_cast<unsigned int>(status.xTaskNumber));
+    assert(record.uptimeMs <= xTaskGetTickCount() * 1000 / configTICK_RATE_HZ,
+           "uptime %u ms in the future",
+           record.uptimeMs);
+    assert(Diagnostics::CrashLog::read(store, 1, record) == Error::NotFound,
+           "empty slot read");
+}
+
+/**
+ * @brief the ring keeps the newest records
+ *
+ */
+void Test::CrashLog::testRing()
+{
+    constexpr uint32_t kCommits = Diagnostics::CrashLog::kRecords + 3;
+    for (uint32_t i = 0; i < kCommits; i++) {
+        Diagnostics::CrashLog::save(Error::Full, i);
+        assert(Diagnostics::CrashLog::commit(store) == Error::None,
+               "commit %u failed",
+               i);
+    }
+
+    Diagnostics::CrashLog::Record record {};
+    for (uint32_t age = 0; age < Diagnostics::CrashLog::kRecords; age++) {
+        assert(Diagnostics::CrashLog::read(store, age, record) == Error::None,
+               "read %u failed",
+               age);
+        // first commit was in testCommit()
+        assert(record.site == kCommits - 1 - age &&
+                   record.sequence == kCommits + 1 - age,
+               "age %u is site %u, #%u",
+               age,
+               record.site,
+               record.sequence);
+    }
+    assert(Diagnostics::CrashLog::read(
+               store, Diagnostics::CrashLog::kRecords, record) ==
+               Error::NotFound,
+           "read beyond the ring");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
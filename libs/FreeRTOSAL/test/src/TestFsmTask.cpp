@@ -0,0 +1,92 @@
+/**
+ * @file TestFsmTask.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing state machines driven by their own task
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestFsmTask.h"
+#include "AL_ITask.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::FsmTask Test::FsmTask::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::FsmTask::FsmTask()
+        : Test::Base("RTOS", "FsmTask"), lamp(),
+          fsmTask(lamp, "FsmTask", kFsmPriority)
+{}
+
+Test::FsmTask &Test::FsmTask::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief events are queued by the test task and dispatched in order by the
+ * state machine task
+ *
+ */
+void Test::FsmTask::runInternal()
+{
+    waitForActions(0, 1);
+    assert(fsmTask.getState() == State::Off, "initial state not entered");
+
+    // queue is full after this, nothing dispatched yet
+    assert(fsmTask.post(Event::Toggle) == Error::None &&
+               fsmTask.post(Event::Brighten) == Error::None &&
+               fsmTask.post(Event::Brighten) == Error::None &&
+               fsmTask.post(Event::Toggle) == Error::None,
+           "post failed");
+    assert(fsmTask.post(Event::Toggle) == Error::OutOfResources,
+           "posted to a full queue");
+    assert(lamp.switchedOn == 0, "dispatched within the posting task");
+
+    // second Brighten is not handled in Bright and dropped
+    waitForActions(1, 2);
+    assert(lamp.brightened == 1 && fsmTask.getState() == State::Off,
+           "brightened %u times, state %u",
+           lamp.brightened,
+           static_cast<unsigned int>(fsmTask.getState()));
+
+    assert(fsmTask.post(Event::Toggle) == Error::None, "post failed");
+    waitForActions(2, 2);
+    assert(fsmTask.getState() == State::Dim, "initial sub state not entered");
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief let the state machine task run until it switched on and off
+ *
+ */
+void Test::FsmTask::waitForActions(uint32_t on, uint32_t off)
+{
+    for (size_t i = 0;
+         (i < 100) && (lamp.switchedOn != on || lamp.switchedOff != off);
+         ++i) {
+        RTOS::ITask::delayCurrentTask(2);
+    }
+    assert(lamp.switchedOn == on && lamp.switchedOff == off,
+           "switched on %u and off %u times instead of %u and %u",
+           lamp.switchedOn,
+           lamp.switchedOff,
+           on,
+           off);
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
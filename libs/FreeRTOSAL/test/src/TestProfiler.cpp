@@ -0,0 +1,121 @@
+/**
+ * @file TestProfiler.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS profiler
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestProfiler.h"
+#include "AL_ITask.h"
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Profiler Test::Profiler::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Profiler::Profiler() : Test::Base("RTOS", "Profiler") {}
+
+Test::Profiler &Test::Profiler::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::Profiler::runInternal()
+{
+    assert(RTOS::Profiler::sample() == Error::None, "first sample failed");
+
+    // burn some CPU time, then let the scheduler switch a few times
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+    while (portGET_RUN_TIME_COUNTER_VALUE() - start <
+           configRUN_TIME_COUNTER_HZ / 100) {
+        // busy for 10ms
+    }
+    for (uint32_t i = 0; i < 5; ++i) {
+        RTOS::ITask::delayCurrentTask(2);
+    }
+
+    assert(RTOS::Profiler::sample() == Error::None, "second sample failed");
+    const auto &snapshot = RTOS::Profiler::getSnapshot();
+    assert(snapshot.version == RTOS::Profiler::kSnapshotVersion,
+           "wrong snapshot version");
+    assert(snapshot.taskCount > 1, "too few tasks %u", snapshot.taskCount);
+    assert(snapshot.intervalMs >= 10,
+           "interval of %u ms too short",
+           snapshot.intervalMs);
+    assert(snapshot.cpuLoadPermille <= 1000,
+           "cpu load %u above 100%%",
+           snapshot.cpuLoadPermille);
+    assert(snapshot.switches >= 5,
+           "only %u context switches",
+           snapshot.switches);
+
+    uint32_t permilleSum = 0;
+    for (size_t i = 0; i < snapshot.taskCount; ++i) {
+        permilleSum += snapshot.tasks[i].cpuPermille;
+        assert(i == 0 || snapshot.tasks[i - 1].taskNumber <
+                             snapshot.tasks[i].taskNumber,
+               "tasks not ordered by number");
+        assert(std::strncmp(snapshot.tasks[i].name,
+                            RTOS::Profiler::getTaskName(i),
+                            RTOS::Profiler::kNameLength) == 0,
+               "task name %s does not match",
+               RTOS::Profiler::getTaskName(i));
+    }
+    // every task is rounded down
+    assert(permilleSum <= 1000 && permilleSum + snapshot.taskCount >= 1000,
+           "cpu usage sums up to %u permille",
+           permilleSum);
+    assert(RTOS::Profiler::getTaskName(snapshot.taskCount) == nullptr,
+           "name of not existing task");
+
+    auto task = findCurrentTask();
+    assert(task != nullptr, "current task not in snapshot");
+    if (task) {
+        assert(task->cpuPermille > 0, "busy task did not use CPU");
+        assert(task->switches >= 5,
+               "current task only switched in %u times",
+               task->switches);
+        assert(task->stackHighWaterMark > 0, "stack high water mark is 0");
+        print("\tcurrent task: %u permille CPU, %u switches, %u words stack "
+              "left",
+              task->cpuPermille,
+              task->switches,
+              task->stackHighWaterMark);
+    }
+
+    RTOS::Profiler::PackedSnapshot packed {};
+    RTOS::Profiler::getPackedSnapshot(packed);
+    assert(std::memcmp(packed.data(), &snapshot, sizeof(snapshot)) == 0,
+           "packed snapshot differs");
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+const RTOS::Profiler::TaskSample *Test::Profiler::findCurrentTask()
+{
+    const auto &snapshot = RTOS::Profiler::getSnapshot();
+    const char *name     = pcTaskGetName(nullptr);
+
+    for (size_t i = 0; i < snapshot.taskCount; ++i) {
+        if (std::strcmp(RTOS::Profiler::getTaskName(i), name) == 0) {
+            return &snapshot.tasks[i];
+        }
+    }
+    return nullptr;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
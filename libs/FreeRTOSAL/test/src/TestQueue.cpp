@@ -23,7 +23,9 @@ const char* const Test::Queue::name = "TestQueue";
 
 //------------------------------ CONSTRUCTOR ----------------------------------
 
-Test::Queue::Queue() : Test::Base("RTOS", "Queue"), queue1(name) {}
+Test::Queue::Queue()
+        : Test::Base("RTOS", "Queue"), queue1(name), queue2("TestQueue2")
+{}
 
 Test::Queue& Test::Queue::getInstance()
 {
@@ -47,6 +49,57 @@ void Test::Queue::runInternal()
     value = 0;
     assert(queue1.receive(value, 10) == Error::None, "failed to receive");
     assert(value == 1234, "wrong value received from queue");
+
+    // peek leaves the element in the queue
+    assert(queue1.send(4321, 10) == Error::None, "failed to send value");
+    value = 0;
+    assert(queue1.peek(value, 10) == Error::None && value == 4321,
+           "failed to peek");
+    value = 0;
+    assert(queue1.receive(value, 0) == Error::None && value == 4321,
+           "peeked value left the queue");
+
+    // peekRef() relies on a single consumer task
+    assert(queue1.send(5, 10) == Error::None, "failed to send value to queue");
+    assert(queue1.receiveFromISR(value) == Error::None && value == 5,
+           "failed to receive from ISR");
+    const uint64_t* valueRef = nullptr;
+    assert(queue1.send(6, 10) == Error::None, "failed to send value to queue");
+    assert(queue1.peekRef(valueRef) == Error::InvalidUse,
+           "peeked a queue with two consumers");
+    assert(queue1.drop() == Error::InvalidUse,
+           "dropped from a queue with two consumers");
+    assert(queue1.receive(value, 10) == Error::None && value == 6,
+           "failed to receive");
+
+    // zero copy API
+    assert(queue2.emplace(10, Message {42, {1, 2, 3}}) == Error::None,
+           "failed to emplace value to queue");
+    assert(queue2.emplace(10, Message {43, {4}}) == Error::None,
+           "failed to emplace second value to queue");
+    const Message* ref = nullptr;
+    assert(queue2.peekRef(ref) == Error::None, "failed to peek");
+    assert(ref != nullptr && ref->id == 42 && ref->payload[2] == 3,
+           "peeked wrong element");
+    assert(queue2.drop() == Error::None, "failed to drop");
+    Message msg {};
+    assert(queue2.receiveInto(msg, 10) == Error::None,
+           "failed to receive into");
+    assert(msg.id == 43 && msg.payload[0] == 4,
+           "wrong value received into");
+    assert(queue2.peekRef(ref) == Error::Empty, "empty queue peeked value");
+    assert(queue2.drop() == Error::Empty, "empty queue dropped value");
+
+    // read index has to follow FreeRTOS around the ring
+    for (uint32_t i = 0; i < 20; ++i) {
+        queue2.emplace(0, Message {i, {}});
+        ref = nullptr;
+        queue2.peekRef(ref);
+        assert(ref != nullptr && ref->id == i,
+               "peeked wrong element after wrap %u",
+               i);
+        queue2.drop();
+    }
 }
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
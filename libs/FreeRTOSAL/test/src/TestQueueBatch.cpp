@@ -0,0 +1,153 @@
+/**
+ * @file TestQueueBatch.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing batched queue receive and batch mode of tasks
+ * @version 1.0
+ * @date 2020-10-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestQueueBatch.h"
+#include "TestQueue.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::QueueBatch Test::QueueBatch::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** number of bursts sent per benchmark */
+static constexpr uint32_t kBursts = 200;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::QueueBatch::QueueBatch()
+        : Test::Base("RTOS", "QueueBatch"), queue("TestQueueBatch"),
+          singleConsumer("SingleConsumer", RTOS::ITask::RunMode::Yield),
+          batchConsumer("BatchConsumer", RTOS::ITask::RunMode::Batch)
+{}
+
+Test::QueueBatch &Test::QueueBatch::getInstance()
+{
+    return instance;
+}
+
+Test::QueueBatch::Consumer::Consumer(const char *const    name,
+                                     RTOS::ITask::RunMode mode)
+        : queue(name), consumed(0), outOfOrder(false), mode(mode),
+          task(*this, name, kConsumerPriority, mode)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::QueueBatch::runInternal()
+{
+    std::array<uint32_t, kBurstSize> batch {};
+    size_t                           count = 1234;
+
+    assert(queue.receiveBatch(batch, count, 0) == Error::Empty,
+           "empty queue returned batch");
+    assert(count == 0, "wrong count %u for empty queue",
+           static_cast<unsigned int>(count));
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        queue.send(std::move(i), 0);
+    }
+    assert(queue.receiveBatch(batch, count, 0) == Error::None,
+           "failed to receive batch");
+    assert(count == 5, "received %u instead of 5 elements",
+           static_cast<unsigned int>(count));
+    for (uint32_t i = 0; i < count; ++i) {
+        assert(batch[i] == i, "wrong element %u at %u", batch[i], i);
+    }
+
+    // batch smaller than available elements leaves the rest queued
+    std::array<uint32_t, 3> smallBatch {};
+    for (uint32_t i = 0; i < kBurstSize; ++i) {
+        queue.send(std::move(i), 0);
+    }
+    assert(queue.receiveBatch(smallBatch, count, 0) == Error::None &&
+               count == 3 && smallBatch[2] == 2,
+           "small batch not filled");
+    assert(queue.receiveBatch(batch, count, 0) == Error::None &&
+               count == kBurstSize - 3 && batch[0] == 3,
+           "rest of the queue not received");
+
+    double singleSwitches = benchmark(singleConsumer);
+    double batchSwitches  = benchmark(batchConsumer);
+    assert(!singleConsumer.outOfOrder && !batchConsumer.outOfOrder,
+           "consumer received items out of order");
+    assert(batchSwitches < singleSwitches,
+           "batch mode did not reduce context switches");
+
+    print("\tbenchmark %u bursts of %u items:",
+          kBursts,
+          static_cast<unsigned int>(kBurstSize));
+    print("\t\treceive + yield:\t%u.%02u context switches per item",
+          static_cast<unsigned int>(singleSwitches),
+          static_cast<unsigned int>(singleSwitches * 100) % 100);
+    print("\t\treceiveBatch:\t\t%u.%02u context switches per item",
+          static_cast<unsigned int>(batchSwitches),
+          static_cast<unsigned int>(batchSwitches * 100) % 100);
+}
+
+const std::list<Test::Base *> Test::QueueBatch::getPrerequisits()
+{
+    return std::list<Test::Base *>({&Test::Queue::getInstance()});
+}
+
+void Test::QueueBatch::Consumer::onStart()
+{
+    // nothing to prepare
+}
+
+void Test::QueueBatch::Consumer::onRun()
+{
+    if (mode == RTOS::ITask::RunMode::Yield) {
+        uint32_t item = 0;
+        if (queue.receive(item) == Error::None) {
+            outOfOrder = outOfOrder || item != consumed;
+            consumed   = consumed + 1;
+        }
+        return;
+    }
+
+    std::array<uint32_t, kBurstSize> batch {};
+    size_t                           count = 0;
+    if (queue.receiveBatch(batch, count) == Error::None) {
+        for (size_t i = 0; i < count; ++i) {
+            outOfOrder = outOfOrder || batch[i] != consumed + i;
+        }
+        consumed = consumed + count;
+    }
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+double Test::QueueBatch::benchmark(Consumer &consumer)
+{
+    uint32_t sent          = 0;
+    uint32_t switchesStart = RTOS::getContextSwitchCount();
+
+    for (uint32_t burst = 0; burst < kBursts; ++burst) {
+        for (size_t i = 0; i < kBurstSize; ++i) {
+            consumer.queue.send(std::move(sent), 0);
+            ++sent;
+        }
+        // stay ready, just like any other busy task of same priority
+        while (consumer.consumed < sent) {
+            RTOS::ITask::yield();
+        }
+    }
+
+    uint32_t switches = RTOS::getContextSwitchCount() - switchesStart;
+    return static_cast<double>(switches) / sent;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
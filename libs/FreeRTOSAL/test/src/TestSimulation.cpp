@@ -0,0 +1,124 @@
+/**
+ * @file TestSimulation.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS simulation in virtual time
+ * @version 1.0
+ * @date 2020-11-06
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestSimulation.h"
+#include "AL_ITask.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Simulation Test::Simulation::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Simulation::Simulation()
+        : Test::Base("RTOS", "Simulation"),
+          RTOS::Timer("TestSimulation", kTimerPeriod, true), expirations(0)
+{}
+
+Test::Simulation &Test::Simulation::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::Simulation::runInternal()
+{
+    testRandom();
+    testVirtualTime();
+}
+
+void Test::Simulation::onTimer()
+{
+    // not an ISR!!
+    expirations = expirations + 1;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+void Test::Simulation::testVirtualTime()
+{
+    // getTime() counts milliseconds, not ticks
+    auto start = RTOS::getTime();
+    RTOS::ITask::delayCurrentTask(20);
+    auto elapsed = RTOS::getTime() - start;
+    assert(elapsed >= 20 && elapsed < 200,
+           "20 ms delay took %u ms",
+           static_cast<unsigned int>(elapsed));
+
+    if (!RTOS::Simulation::isActive()) {
+        assert(RTOS::Simulation::getSkippedTicks() == 0,
+               "ticks skipped in real time");
+        print("\treal time, build with SIMULATION=1 for virtual time");
+        return;
+    }
+
+    auto skippedBefore = RTOS::Simulation::getSkippedTime();
+    expirations        = 0;
+    start              = RTOS::getTime();
+    assert(RTOS::Timer::start() == Error::None, "could not start timer");
+    RTOS::ITask::delayCurrentTask(kSimulatedTime);
+    assert(RTOS::Timer::stop() == Error::None, "could not stop timer");
+    elapsed = RTOS::getTime() - start;
+
+    auto realTime =
+        elapsed - (RTOS::Simulation::getSkippedTime() - skippedBefore);
+    assert(elapsed >= kSimulatedTime,
+           "only %u ms passed",
+           static_cast<unsigned int>(elapsed));
+    assert(realTime < 1000,
+           "simulation took %u ms real time",
+           static_cast<unsigned int>(realTime));
+    // the last expiration is due at the same tick as the end of the delay
+    assert(expirations + 1 >= kSimulatedTime / kTimerPeriod &&
+               expirations <= kSimulatedTime / kTimerPeriod,
+           "timer expired %u times",
+           expirations);
+    print("\t%u ms virtual time in %u ms real time, %u skips so far",
+          static_cast<unsigned int>(elapsed),
+          static_cast<unsigned int>(realTime),
+          RTOS::Simulation::getSkips());
+}
+
+void Test::Simulation::testRandom()
+{
+    constexpr size_t kCount = 16;
+    uint32_t         first[kCount];
+    auto             seed = RTOS::Simulation::getSeed();
+
+    RTOS::Simulation::seed(42);
+    for (auto &value : first) {
+        value = RTOS::Simulation::random();
+    }
+    RTOS::Simulation::seed(42);
+    for (auto value : first) {
+        assert(RTOS::Simulation::random() == value,
+               "sequence differs with same seed");
+    }
+    for (size_t i = 0; i < kCount; ++i) {
+        auto value = RTOS::Simulation::random(10, 20);
+        assert(value >= 10 && value <= 20, "%u out of range", value);
+    }
+    RTOS::Simulation::seed(43);
+    assert(RTOS::Simulation::random() != first[0],
+           "sequence same with other seed");
+
+    // leave the generator as the application seeded it
+    RTOS::Simulation::seed(seed);
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,91 @@
+/**
+ * @file TestSpscRing.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing lock-free ring buffer
+ * @version 1.0
+ * @date 2020-10-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestSpscRing.h"
+#include "TestTimer.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::SpscRing Test::SpscRing::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::SpscRing::SpscRing()
+        : Test::Base("RTOS", "SpscRing"),
+          RTOS::Timer("TestSpscRing", 20, false), ring()
+{}
+
+Test::SpscRing &Test::SpscRing::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::SpscRing::runInternal()
+{
+    uint32_t value = 0;
+    assert(ring.isEmpty(), "new ring not empty");
+    assert(ring.pop(value, 0) == Error::Empty, "empty ring returned value");
+    assert(ring.drop() == Error::Empty, "empty ring dropped value");
+
+    for (uint32_t i = 0; i < 4; ++i) {
+        assert(ring.tryPush(i) == Error::None, "failed to push %u", i);
+    }
+    assert(ring.size() == 4, "wrong size %u", ring.size());
+    assert(ring.tryPush(4) == Error::Full, "pushed into full ring");
+
+    const uint32_t *ref = nullptr;
+    assert(ring.peekRef(ref, 0) == Error::None && ref != nullptr && *ref == 0,
+           "failed to peek oldest value");
+    assert(ring.drop() == Error::None, "failed to drop");
+    for (uint32_t i = 1; i < 4; ++i) {
+        assert(ring.pop(value, 0) == Error::None && value == i,
+               "popped wrong value %u instead of %u",
+               value,
+               i);
+    }
+
+    // wrap around several times
+    for (uint32_t i = 0; i < 10; ++i) {
+        ring.tryPushFromISR(i);
+        assert(ring.pop(value, 0) == Error::None && value == i,
+               "wrong value after wrap");
+    }
+
+    // consumer blocks and gets notified by the timer task
+    assert(start(0) == Error::None, "could not start timer");
+    assert(ring.pop(value, 100) == Error::None, "blocking pop not woken");
+    assert(value == 1234, "wrong value from producer task");
+    assert(ring.pop(value, 30) == Error::Empty,
+           "blocking pop did not time out");
+}
+
+const std::list<Test::Base *> Test::SpscRing::getPrerequisits()
+{
+    return std::list<Test::Base *>({&Test::Timer::getInstance()});
+}
+
+void Test::SpscRing::onTimer()
+{
+    // timer task is the producer
+    ring.tryPush(1234);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,178 @@
+/**
+ * @file TestTimerWheel.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing timing wheel
+ * @version 1.0
+ * @date 2020-10-28
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestTimerWheel.h"
+#include "AL_ITask.h"
+#include "TestTimer.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::TimerWheel::Wheel Test::TimerWheel::benchWheel {"BenchWheel", 100};
+Test::TimerWheel        Test::TimerWheel::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** times every simulated device gets restarted in the benchmark */
+static constexpr uint32_t kRounds = 5;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::TimerWheel::TimerWheel()
+        : Test::Base("RTOS", "TimerWheel"), wheel("TestWheel", kResolution),
+          shortEntry(wheel, 4 * kResolution),
+          longEntry(wheel, 25 * kResolution), wheelDevices(), timerDevices()
+{}
+
+Test::TimerWheel &Test::TimerWheel::getInstance()
+{
+    return instance;
+}
+
+Test::TimerWheel::Entry::Entry(Wheel &wheel, RTOS::milliseconds timeout)
+        : Wheel::Entry(wheel, timeout), expirations(0)
+{}
+
+Test::TimerWheel::DeviceEntry::DeviceEntry()
+        : Entry(benchWheel, kDeviceTimeout)
+{}
+
+Test::TimerWheel::DeviceTimer::DeviceTimer()
+        : RTOS::Timer("DeviceTimer", kDeviceTimeout, false)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::TimerWheel::runInternal()
+{
+    assert(!shortEntry.isActive() && wheel.getActiveCount() == 0,
+           "entry active before start");
+
+    // expires between timeout and timeout + resolution
+    shortEntry.start();
+    assert(shortEntry.isActive() && wheel.getActiveCount() == 1,
+           "entry not active after start");
+    RTOS::ITask::delayCurrentTask(3 * kResolution);
+    assert(shortEntry.expirations == 0, "entry expired too early");
+    RTOS::ITask::delayCurrentTask(3 * kResolution);
+    assert(shortEntry.expirations == 1,
+           "entry expired %u times instead of once",
+           shortEntry.expirations);
+    assert(!shortEntry.isActive() && wheel.getActiveCount() == 0,
+           "entry still active after expiring");
+
+    // restarting postpones expiration
+    shortEntry.start();
+    for (uint32_t i = 0; i < 5; ++i) {
+        RTOS::ITask::delayCurrentTask(2 * kResolution);
+        shortEntry.start();
+    }
+    assert(shortEntry.expirations == 1, "restarted entry expired");
+    RTOS::ITask::delayCurrentTask(6 * kResolution);
+    assert(shortEntry.expirations == 2, "restarted entry did not expire");
+
+    // stopped entry never expires
+    shortEntry.start();
+    RTOS::ITask::delayCurrentTask(2 * kResolution);
+    shortEntry.stop();
+    assert(!shortEntry.isActive(), "entry active after stop");
+    RTOS::ITask::delayCurrentTask(6 * kResolution);
+    assert(shortEntry.expirations == 2, "stopped entry expired");
+
+    // timeout longer than one revolution of the wheel
+    longEntry.start();
+    RTOS::ITask::delayCurrentTask(20 * kResolution);
+    assert(longEntry.expirations == 0,
+           "long entry expired after one revolution");
+    RTOS::ITask::delayCurrentTask(8 * kResolution);
+    assert(longEntry.expirations == 1, "long entry did not expire");
+    assert(wheel.getActiveCount() == 0, "entries left in wheel");
+
+    // benchmark
+    uint32_t switchesStart = RTOS::getContextSwitchCount();
+    uint32_t wheelTicks    = benchmarkWheel();
+    uint32_t wheelSwitches = RTOS::getContextSwitchCount() - switchesStart;
+
+    switchesStart          = RTOS::getContextSwitchCount();
+    uint32_t timerTicks    = benchmarkTimers();
+    uint32_t timerSwitches = RTOS::getContextSwitchCount() - switchesStart;
+    uint32_t restarts      = kRounds * kDevices;
+
+    assert(benchWheel.getActiveCount() == kDevices,
+           "%u instead of %u devices active",
+           static_cast<unsigned int>(benchWheel.getActiveCount()),
+           static_cast<unsigned int>(kDevices));
+    assert(wheelSwitches < timerSwitches,
+           "wheel caused more context switches than timers");
+
+    for (auto &device : wheelDevices) {
+        device.stop();
+    }
+    for (auto &device : timerDevices) {
+        device.stop();
+    }
+    assert(benchWheel.getActiveCount() == 0, "devices left in wheel");
+
+    print("\tbenchmark %u restarts of %u devices:",
+          static_cast<unsigned int>(restarts),
+          static_cast<unsigned int>(kDevices));
+    print("\t\tTimerWheel:\t%u ns, %u context switches, %u bytes per device",
+          static_cast<unsigned int>(
+              uint64_t(wheelTicks) * 1000000000 / configRUN_TIME_COUNTER_HZ /
+              restarts),
+          static_cast<unsigned int>(wheelSwitches),
+          static_cast<unsigned int>(sizeof(DeviceEntry)));
+    print("\t\tRTOS::Timer:\t%u ns, %u context switches, %u bytes per device",
+          static_cast<unsigned int>(
+              uint64_t(timerTicks) * 1000000000 / configRUN_TIME_COUNTER_HZ /
+              restarts),
+          static_cast<unsigned int>(timerSwitches),
+          static_cast<unsigned int>(sizeof(DeviceTimer)));
+}
+
+const std::list<Test::Base *> Test::TimerWheel::getPrerequisits()
+{
+    return std::list<Test::Base *>({&Test::Timer::getInstance()});
+}
+
+void Test::TimerWheel::Entry::onExpired()
+{
+    expirations = expirations + 1;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+uint32_t Test::TimerWheel::benchmarkWheel()
+{
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+    for (uint32_t round = 0; round < kRounds; ++round) {
+        for (auto &device : wheelDevices) {
+            device.start();
+        }
+    }
+    return portGET_RUN_TIME_COUNTER_VALUE() - start;
+}
+
+uint32_t Test::TimerWheel::benchmarkTimers()
+{
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+    for (uint32_t round = 0; round < kRounds; ++round) {
+        for (auto &device : timerDevices) {
+            device.start();
+        }
+    }
+    return portGET_RUN_TIME_COUNTER_VALUE() - start;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,215 @@
+/**
+ * @file TestTrace.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief testing RTOS trace recorder
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestTrace.h"
+#include "AL_ITask.h"
+#include "AL_Queue.h"
+#include "PatternsPort.h"
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Trace Test::Trace::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Trace::Trace() : Test::Base("RTOS", "Trace"), sink {}, header {} {}
+
+Test::Trace &Test::Trace::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::Trace::runInternal()
+{
+    using RTOS::Trace;
+    Trace::Record   first {}, second {}, send {}, receive {}, record {};
+    Trace::DumpName name {};
+
+    Trace::disable();
+    Trace::clear();
+    Trace::enable();
+
+    // user events, argument gets truncated to 24 bit
+    TRACE_EVENT(Trace::User + 1, 0x123456);
+    TRACE_EVENT(Trace::User + 2, 0xFFFFFFFF);
+
+    {
+        RTOS::Queue<uint32_t, 4> queue("TraceQueue");
+        uint32_t                 value = 0;
+        assert(queue.send(1, 0) == Error::None, "queue send failed");
+        assert(queue.send(2, 0) == Error::None, "queue send failed");
+        assert(queue.receive(value, 0) == Error::None, "queue receive failed");
+
+        // names of queues are only in dumps while they exist
+        takeDump();
+        assert(findLast(Trace::User + 1, first) &&
+                   (first.idAndArg & Trace::kMaxArg) == 0x123456,
+               "user event not recorded");
+        assert(findLast(Trace::User + 2, second) &&
+                   (second.idAndArg & Trace::kMaxArg) == Trace::kMaxArg,
+               "argument not truncated");
+        assert(second.timestamp >= first.timestamp, "timestamps not in order");
+
+        assert(findName(Trace::QueueName, "TraceQueue", name),
+               "queue name not in dump");
+        assert(findLast(Trace::QueueSend, send) &&
+                   findLast(Trace::QueueReceive, receive),
+               "queue events not recorded");
+        assert((send.idAndArg & 0xFF) == name.number &&
+                   (receive.idAndArg & 0xFF) == name.number,
+               "queue events with wrong number");
+        assert(((send.idAndArg & Trace::kMaxArg) >> 8) == 2,
+               "fill level after send is %u",
+               (send.idAndArg & Trace::kMaxArg) >> 8);
+        assert(((receive.idAndArg & Trace::kMaxArg) >> 8) == 1,
+               "fill level after receive is %u",
+               (receive.idAndArg & Trace::kMaxArg) >> 8);
+    }
+    takeDump();
+    assert(!findName(Trace::QueueName, "TraceQueue", name),
+           "destructed queue still in dump");
+
+    // this task was the last one switched in
+    RTOS::ITask::delayCurrentTask(2);
+    takeDump();
+    TaskStatus_t status {};
+    vTaskGetInfo(nullptr, &status, pdFALSE, eRunning);
+    auto number = status.xTaskNumber;
+    assert(findLast(Trace::TaskSwitchIn, record) &&
+               (record.idAndArg & Trace::kMaxArg) == number,
+           "switch to current task not recorded");
+    assert(findName(Trace::TaskName, pcTaskGetName(nullptr), name) &&
+               name.number == number,
+           "task name not in dump");
+
+    // failed error checks, called by Error::internalCheck()
+    Port::traceError(Error::Timeout, Error::makeSite("TestTrace.cpp", 1234));
+    takeDump();
+    assert(findLast(Trace::ErrorCheck, record) &&
+               (record.idAndArg & Trace::kMaxArg) ==
+                   ((Error::Timeout << 16) | 1234),
+           "error check not recorded");
+
+    // nothing recorded while disabled
+    Trace::disable();
+    Trace::clear();
+    TRACE_EVENT(Trace::User, 1);
+    takeDump();
+    assert(header.recordCount == 0 && header.lostRecords == 0,
+           "%u records while disabled",
+           header.recordCount);
+
+    // oldest records get overwritten
+    Trace::enable();
+    for (uint32_t i = 0; i < Trace::kRecords + 10; ++i) {
+        TRACE_EVENT(Trace::User + 3, i);
+    }
+    Trace::disable();
+    takeDump();
+    assert(header.recordCount == Trace::kRecords,
+           "%u records in full ring",
+           header.recordCount);
+    assert(header.lostRecords >= 10, "%u records lost", header.lostRecords);
+    assert(findLast(Trace::User + 3, record) &&
+               (record.idAndArg & Trace::kMaxArg) == Trace::kRecords + 9,
+           "newest record missing");
+
+    // overhead of a single event
+    constexpr uint32_t kEvents = 10000;
+    Trace::clear();
+    Trace::enable();
+    uint32_t start = portGET_RUN_TIME_COUNTER_VALUE();
+    for (uint32_t i = 0; i < kEvents; ++i) {
+        TRACE_EVENT(Trace::User + 4, i);
+    }
+    uint32_t elapsed = portGET_RUN_TIME_COUNTER_VALUE() - start;
+    Trace::disable();
+    Trace::clear();
+    print("\t%u ns per event",
+          static_cast<unsigned int>(static_cast<uint64_t>(elapsed) *
+                                    1000000000 / configRUN_TIME_COUNTER_HZ /
+                                    kEvents));
+}
+
+/**
+ * @brief Appends to bytes, fails if the dump does not fit.
+ *
+ */
+Error::Code Test::Trace::MemorySink::write(const uint8_t *data, size_t length)
+{
+    if (size + length > sizeof(bytes)) {
+        return Error::OutOfResources;
+    }
+    std::memcpy(bytes + size, data, length);
+    size += length;
+    return Error::None;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+void Test::Trace::takeDump()
+{
+    sink.size = 0;
+    assert(RTOS::Trace::dump(sink) == Error::None, "dump failed");
+    std::memcpy(&header, sink.bytes, sizeof(header));
+
+    assert(header.magic == RTOS::Trace::kDumpMagic, "wrong magic");
+    assert(header.version == RTOS::Trace::kDumpVersion, "wrong version");
+    assert(header.timestampHz == configTRACE_TIMESTAMP_HZ,
+           "wrong timestamp frequency");
+    assert(sink.size == sizeof(header) +
+                            header.nameCount * sizeof(RTOS::Trace::DumpName) +
+                            header.recordCount * sizeof(RTOS::Trace::Record),
+           "dump of %u bytes does not match header",
+           static_cast<unsigned int>(sink.size));
+}
+
+bool Test::Trace::findLast(uint8_t id, RTOS::Trace::Record &outRecord)
+{
+    const uint8_t *records = sink.bytes + sizeof(header) +
+                             header.nameCount * sizeof(RTOS::Trace::DumpName);
+    for (size_t i = header.recordCount; i > 0; --i) {
+        std::memcpy(&outRecord,
+                    records + (i - 1) * sizeof(outRecord),
+                    sizeof(outRecord));
+        if ((outRecord.idAndArg >> 24) == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Test::Trace::findName(uint8_t                 kind,
+                           const char             *name,
+                           RTOS::Trace::DumpName &outName)
+{
+    for (size_t i = 0; i < header.nameCount; ++i) {
+        std::memcpy(&outName,
+                    sink.bytes + sizeof(header) + i * sizeof(outName),
+                    sizeof(outName));
+        if ((outName.kind == kind) &&
+            (std::strncmp(outName.name, name, sizeof(outName.name)) == 0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
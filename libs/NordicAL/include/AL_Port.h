@@ -21,12 +21,21 @@ extern "C" void
 extern "C" void HardFault_c_handler(uint32_t* p_stack_address);
 extern "C" void FPU_IRQHandler(void);
 
+#include <AL_CoExecutor.h>
 #include <cstdint>
 
 namespace Port
 {
 //-------------------------------- CONSTANTS ----------------------------------
 
+/** stack of the shared executor, sized for NRF_LOG_FLUSH() of the logger */
+constexpr size_t kExecutorStackSize = 512;
+/** priority of all CoTasks of the NordicAL modules, logging used to run at 1 */
+constexpr uint8_t kExecutorPriority = 1;
+
+/** executor type shared by the NordicAL modules */
+using Executor = RTOS::CoExecutor<kExecutorStackSize>;
+
 //-------------------------------- FUNCTIONS ----------------------------------
 
 /**
@@ -34,5 +43,10 @@ namespace Port
  */
 void init();
 
+/**
+ * @brief executor all CoTasks of the NordicAL modules run on
+ */
+Executor& getExecutor();
+
 }  // namespace Port
 #endif  //__AL_NORDIC_H__
\ No newline at end of file
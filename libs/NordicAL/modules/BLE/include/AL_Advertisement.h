@@ -115,6 +115,7 @@ public:
         trigger(RTOS::milliseconds timeoutMs = RTOS::Infinity) = 0;
 
 protected:
+    static uint8_t* allocPackage(size_t len);
     Error::Code
         queueForAdvertisement(uint8_t*           data,
                               size_t             len,
@@ -49,8 +49,6 @@ class Characteristic;
 #include "CharacteristicBase.h"
 #include "Observable.h"
 
-#include <memory>
-
 namespace IO::BLE
 {
 //-------------------------------- CONSTANTS ----------------------------------
@@ -88,12 +86,13 @@ private:
     virtual void     onValueChanged() final;
 
     /**
-     * @brief pointer to heap allocated buffer for sending.
+     * @brief buffer for sending, in big endian.
      * 
-     * @details Needed to ensure static position in memory during context switches.
+     * @details Stored inline, characteristics are static objects and
+     * never move, so the softdevice can keep pointing at it.
      * 
      */
-    std::unique_ptr<T> userData;
+    T userData;
 };
 }  // namespace IO::BLE
 
@@ -14,13 +14,23 @@
 
 //--------------------------------- INCLUDES ----------------------------------
 
-#include "AL_Timer.h"
-#include "LifetimeList.h"
+#include "AL_Mutex.h"
+#include "AL_TimerWheel.h"
+#include "HashTable.h"
 #include "ble_gap.h"
 #include "AL_BLE.h"
 
 #include <array>
 
+#ifndef BLE_MAX_DEVICES
+/**
+ * devices known at the same time. Sized for 300+ tags in range at below
+ * 60 % load, costs about 50 bytes of RAM each. Lower it with
+ * -DBLE_MAX_DEVICES=... if fewer devices are expected.
+ */
+#define BLE_MAX_DEVICES 512
+#endif
+
 namespace IO::BLE
 {
 //-------------------------------- CONSTANTS ----------------------------------
@@ -37,12 +47,15 @@ namespace IO::BLE
  * 			the advertisement once it reads the advertisement. Purpose of this
  * 			class is to save that information for eventual later use.
  * 
- * 			By utilizing a lifetime linked list, this class stores information
- * 			on all devices. Depending on user choice (via
- *          setDeleteDevicesOnTimeout function), it either stores all devices
- *          it came into contact with, or just the ones that are actively
- *          broadcasting their messages. All older devices will gett automatically
- *          deleted.
+ * 			Devices are stored in place in a hash table keyed by their
+ * 			address, lookups on every advertisement are O(1). Depending on
+ *          user choice (via setDeleteDevicesOnTimeout function), it either
+ *          stores all devices it came into contact with, or just the ones
+ *          that are actively broadcasting their messages. Once kMaxDevices
+ *          are known, the device seen least recently makes room for a new one.
+ *          With more devices in range than that, every device is evicted
+ *          before it is seen again and always reported as new, so size
+ *          BLE_MAX_DEVICES for the expected number of devices.
  * 
  */
 class Device {
@@ -53,8 +66,29 @@ class Device {
 
     friend class Scanner;
 
+    /** slots of the activity wheel, covers kDefaultActivityTimeout at once */
+    static constexpr size_t kActivityWheelSlots = 128;
+    /** activity timeouts are rounded up to this */
+    static constexpr RTOS::milliseconds kActivityWheelResolution = 100;
+
+    using ActivityWheel = RTOS::TimerWheel<kActivityWheelSlots>;
+
+    /** devices known at the same time, see create() and BLE_MAX_DEVICES */
+    static constexpr size_t kMaxDevices = BLE_MAX_DEVICES;
+
+    /**
+     * @brief folds the 48 bit address into a well mixed hash.
+     *
+     */
+    struct AddressHash {
+        uint32_t operator()(const Address& address) const;
+    };
+
+    using DeviceTable =
+        Collections::HashTable<Address, Device, kMaxDevices, AddressHash>;
+
     // Implements device activity timer
-    class Timer : public RTOS::Timer {
+    class Timer : public ActivityWheel::Entry {
         // Delete default constructors
         Timer()                   = delete;
         Timer(const Timer& other) = delete;
@@ -67,7 +101,7 @@ class Device {
 
     private:
         /*--- Private API ---*/
-        virtual void onTimer() final;
+        virtual void onExpired() final;
 
         /*--- Private members ---*/
         Device& device;
@@ -82,23 +116,26 @@ public:
     bool             isActive();
     IO::BLE::RxPower getLastRSSI() const;
 
-    static Collections::LifetimeList<Device&>& getList();
-    static Device* getByAddress(const Address& address);
-    static void    printDeviceList(bool onlyActives);
-    static void    setDeleteDevicesOnTimeout(bool active);
+    static Device*      create(const Address& address, RxPower rssi);
+    static DeviceTable& getTable();
+    static RTOS::Mutex& getMutex();
+    static Device*      getByAddress(const Address& address);
+    static void         printDeviceList(bool onlyActives);
+    static void         setDeleteDevicesOnTimeout(bool active);
 
     /*--- Public members ---*/
     Address address; /**< 48-bit BT MAC address*/
 
 private:
     /*--- Private members ---*/
-    Timer                                    activityTimer;
-    IO::BLE::RxPower                         lastRSSI;
-    Collections::LifetimeList<Device&>::Node node; /**< DeviceList node */
+    Timer            activityTimer;
+    IO::BLE::RxPower lastRSSI;
 
     void setToActive();
     void setLastRSSI(RxPower rssi);
 
+    static ActivityWheel& getActivityWheel();
+
     static bool deleteDevicesOnTimeout;
 
     /*--- Private constants ---*/
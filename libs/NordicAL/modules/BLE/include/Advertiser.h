@@ -32,26 +32,23 @@ class Advertiser;
 
 #include "AL_Advertisement.h"
 
+#include <AL_CoTask.h>
 #include <AL_Event.h>
-#include <AL_EventGroup.h>
 #include <AL_Queue.h>
-#include <AL_Task.h>
+#include <Pool.h>
 #include <aconnoConfig.h>
 #include <ble.h>
 #include <ble_advdata.h>
+#include <memory>
 
 namespace IO::BLE
 {
 //-------------------------------- CONSTANTS ----------------------------------
 
 //---------------------------- CLASS DEFINITION -------------------------------
-class Advertiser {
-    static constexpr size_t kStackSize =
-        256; /**< Size of the advertiser task stack in sizeof(StackType_t) bytes */
-
+class Advertiser : private RTOS::CoTask {
     // Befriend Advertisement to allow it to put itself into Adv queue
     friend IO::BLE::Advertisement;
-    friend RTOS::Task<kStackSize, Advertiser>;
 
     // Delete default constructors
     Advertiser(const Advertiser& other) = delete;
@@ -70,12 +67,32 @@ private:
         size_t   len;
     };
 
+    /**
+     * @brief what the advertiser waits for
+     */
+    enum class State {
+        Idle, /**< not started yet */
+        Receiving, /**< next advertisement from the queue */
+        Broadcasting, /**< end of the current burst */
+    };
+
     /**
      * Size of the queue containing advertisement to be broadcasted.
      * Value chosen arbitrarily, based on experience.
      */
     static constexpr uint8_t kAdvQueueSize = 25;
 
+    /** Largest legacy advertisement data package in bytes. */
+    static constexpr size_t kMaxPackageSize = BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+
+    /**
+     * Packages that can exist at once. A full queue, the one in broadcast
+     * and the one currently built by an Advertisement.
+     */
+    static constexpr size_t kPackagePoolSize = kAdvQueueSize + 2;
+
+    using PackagePool = Patterns::BlockPool<kMaxPackageSize, kPackagePoolSize>;
+
     /** Total number of events defined in Advertiser class. */
     static constexpr uint8_t kNumOfEvents = 2;
 
@@ -85,18 +102,25 @@ public:
     static void        reset();
 
 private:
-    static Advertiser                  instance;
-    RTOS::EventGroup                   radioEvents;
-    RTOS::Event                        advBurstCompletedEvent;
-    RTOS::Event                        deviceConnectedEvent;
-    RTOS::EventList<kNumOfEvents>      radioEventsList;
-    RTOS::Queue<Data, kAdvQueueSize>    advertisementQueue;
-    RTOS::Task<kStackSize, Advertiser> rtosTask;
-
-    Data advToBroadcast; /**< Holds advertisement instance received from adv. queue to be broadcast next */
-
-    void onStart();
-    void onRun();
+    static Advertiser                instance;
+    RTOS::Event                      advBurstCompletedEvent;
+    RTOS::Event                      deviceConnectedEvent;
+    RTOS::EventList<kNumOfEvents>    radioEventsList;
+    RTOS::Event                      advQueuedEvent;
+    RTOS::Queue<Data, kAdvQueueSize> advertisementQueue;
+
+    State state; /**< what the CoTask currently waits for */
+    Data  advToBroadcast; /**< received from adv. queue, broadcast next */
+    PackagePool::Buffer
+        broadcastData; /**< data of the current burst, freed when done */
+
+    static PackagePool& getPackagePool();
+
+    // RTOS::CoTask
+    virtual RTOS::Await onResume(Error::Code result) final;
+
+    Error::Code startBroadcast();
+    void        finishBroadcast(Error::Code result);
 
     static constexpr uint32_t msToAdvIntervalUnits(RTOS::milliseconds ms);
     static constexpr uint16_t msToAdvDurationUnits(RTOS::milliseconds ms);
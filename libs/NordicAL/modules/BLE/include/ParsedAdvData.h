@@ -16,6 +16,9 @@
 
 #include "AL_Device.h"
 
+#include <StaticString.h>
+#include <StaticVector.h>
+
 namespace IO::BLE
 {
 //-------------------------------- CONSTANTS ----------------------------------
@@ -25,29 +28,23 @@ namespace IO::BLE
 /**
  * @brief Parsed advertisement data package.
  * 
- * @warning Most member are pointers and therefor
- * nullable. If they did not show up in the 
- * advertisement package, they will be nullptr in
- * this struct.
+ * @details Fields are stored inline with the size of a legacy
+ * advertisement, parsing does not allocate and the struct can be
+ * copied into queues. Fields that did not show up in the
+ * advertisement package are empty.
  */
 struct ParsedAdvData {
-    // delete default constructors
-    ParsedAdvData(const ParsedAdvData& other) = delete;
-    ParsedAdvData& operator=(const ParsedAdvData& other) = delete;
-
-    ParsedAdvData()        = default;
-    ParsedAdvData& operator=(ParsedAdvData&& other) = default;
-
-    std::unique_ptr<uint8_t[]> manufacturerData;
-    size_t                     manufacturerDataSize;
-    std::unique_ptr<char[]>    name;
-    size_t                     nameSize;
-    Flags                      flags;
-    Appearance                 appearance;
-
-    static Error::Code parseRawData(ParsedAdvData&             outData,
-                                    std::unique_ptr<uint8_t[]> rawData,
-                                    const size_t               rawDataSize);
+    /** legacy advertisement of 31 bytes minus length and type of a field */
+    static constexpr size_t kMaxFieldSize = 29;
+
+    Collections::StaticVector<uint8_t, kMaxFieldSize> manufacturerData;
+    Collections::StaticString<kMaxFieldSize>          name;
+    Flags                                             flags;
+    Appearance                                        appearance;
+
+    static Error::Code parseRawData(ParsedAdvData& outData,
+                                    const uint8_t* rawData,
+                                    const size_t   rawDataSize);
 };
 }  // namespace IO::BLE
 #endif  //__PARSEDADVDATA_H__
\ No newline at end of file
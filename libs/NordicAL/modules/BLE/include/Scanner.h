@@ -21,11 +21,13 @@
 #include "Observable.h"
 #include "ble.h"
 #include "AL_Task.h"
-#include "AL_Queue.h"
+#include "AL_SpscRing.h"
 #include "BLE_Utility.h"
 #include "ParsedAdvData.h"
 
+#include <StaticVector.h>
 #include <array>
+#include <atomic>
 #include <cstdint>
 
 namespace IO::BLE
@@ -45,7 +47,7 @@ namespace IO::BLE
  * 			the past, or this is the first advertisement received from that 
  * 			device.
  * 
- * 			Scanner class utilizes a lifetime list container as a database
+ * 			Scanner class utilizes the hash table of Device as a database
  * 			of all devices which have been encountered before. User settings
  * 			allow for selection of two modes: either all devices are retained in
  *          the list, or currently active devices are retained in the list.
@@ -74,6 +76,14 @@ namespace IO::BLE
  *          known or if its new and the parsed advertisment data in form of
  *          a ParsedAdvData instance.
  * 
+ *          Observers run in the scanner task. Slow subscribers (flash
+ *          writes, uplinks) should derive from RTOS::AsyncObserver, which
+ *          copies what it needs into its own queue and handles it in its own
+ *          task, so scanning never waits for them. The device table is
+ *          locked while observers run, so the device stays valid. Do not
+ *          call Device::printDeviceList() or hold on to the device from
+ *          an observer.
+ * 
  * @example Start scanner which scans every 500 ms for the duration of 10 ms,
  *          does not time out and filters advertisements by users data field:
  * 
@@ -98,8 +108,15 @@ class Scanner : public Patterns::Observable<const Device&,
     static constexpr size_t kStackSize = 256;
     /** Size of the buffer to hand to softdevice for receiving advertisements */
     static constexpr size_t kMaxAdvDataSize = BLE_GAP_SCAN_BUFFER_EXTENDED_MIN;
-    /** Size of the queue buffering received advertisements */
-    static constexpr size_t kAdvertisementQueueSize = 10;
+    /** Extended advertisements are not scanned for, legacy ones are limited */
+    static constexpr size_t kMaxLegacyAdvDataSize =
+        BLE_GAP_ADV_SET_DATA_SIZE_MAX;
+    /** Size of the ring buffering received advertisements, power of 2 */
+    static constexpr size_t kAdvertisementRingSize = 16;
+    /** Longest filter, manufacturer data can not be longer */
+    static constexpr size_t kMaxFilterSize = ParsedAdvData::kMaxFieldSize;
+
+    using Filter = Collections::StaticVector<uint8_t, kMaxFilterSize>;
 
     using TaskType = RTOS::Task<kStackSize, Scanner>;
     friend TaskType;
@@ -132,12 +149,13 @@ private:
     /**
      * @brief Raw information received from SD scan event.
      * 
+     * @details Data is stored inline, so no heap is needed in SD context.
      */
     struct RawAdvData {
-        RxPower  rssi;
-        size_t   dataSize;
-        uint8_t* data;
-        Address  address;
+        RxPower                                    rssi;
+        uint8_t                                    dataSize;
+        std::array<uint8_t, kMaxLegacyAdvDataSize> data;
+        Address                                    address;
     };
 
     /*--- Constructor ---*/
@@ -146,6 +164,8 @@ private:
     /*--- Private API ---*/
     void        onStart();
     void        onRun();
+    void        processAdvertisement(const RawAdvData& rawAdv);
+    void        reportLosses();
     Error::Code setScanInterval(RTOS::milliseconds timeMs);
     Error::Code setScanWindow(RTOS::milliseconds timeMs);
     Error::Code setScanTimeout(RTOS::milliseconds timeMs);
@@ -163,13 +183,18 @@ private:
     uint16_t                   scanWindow; /**< Internal unit of 0,625ms */
     uint16_t                   scanTimeout; /**< Internal unit of 1s (1000ms) */
     bool                       filteringEnabled;
-    size_t                     dataFilterSize;
-    std::unique_ptr<uint8_t[]> dataFilter;
-    std::unique_ptr<uint8_t[]> dataMask;
+    Filter                     dataFilter; /**< empty if no filter is set */
+    Filter                     dataMask; /**< same size as dataFilter */
     std::array<uint8_t, kMaxAdvDataSize> scanBufferData;
 
-    RTOS::Queue<RawAdvData, kAdvertisementQueueSize>
-        advertisementQueue; /**< Queue that stores discovered advertisements for processing */
+    RTOS::SpscRing<RawAdvData, kAdvertisementRingSize>
+        advertisementRing; /**< Lock-free ring that stores discovered advertisements for processing */
+    std::atomic<uint32_t>
+        droppedCount; /**< Advertisements dropped on a full ring, counted in SD context */
+    std::atomic<uint32_t>
+        truncatedCount; /**< Advertisements cut to kMaxLegacyAdvDataSize, counted in SD context */
+    uint32_t reportedDropped; /**< droppedCount last logged by the task */
+    uint32_t reportedTruncated; /**< truncatedCount last logged by the task */
     TaskType
         task; /**< RTOS task used to execute the scanning, instantiate after all other RTOS objects! */
 
@@ -186,6 +211,8 @@ Error::Code
     IO::BLE::Scanner::setFilterByData(std::array<uint8_t, size>&& filter,
                                       std::array<uint8_t, size>&& mask)
 {
+    static_assert(size > 0 && size <= kMaxFilterSize,
+                  "filter has to fit into manufacturer data");
     auto& scanner = getInstance();
 
     if (mask.back() == 0) {
@@ -193,20 +220,8 @@ Error::Code
         return Error::InvalidParameter;
     }
 
-    scanner.dataFilter = std::make_unique<uint8_t[]>(size);
-    scanner.dataMask   = std::make_unique<uint8_t[]>(size);
-
-    if (!scanner.dataFilter || !scanner.dataMask) {
-        LOG_W("Failed to create filter arrays!");
-        return Error::OutOfResources;
-    }
-
-    for (int i = 0; i != size; i++) {
-        scanner.dataFilter[i] = filter[i];
-        scanner.dataMask[i]   = mask[i];
-    }
-
-    scanner.dataFilterSize = size;
+    RETURN_ON_ERROR(scanner.dataFilter.assign(filter.data(), size));
+    RETURN_ON_ERROR(scanner.dataMask.assign(mask.data(), size));
 
     return Error::None;
 }
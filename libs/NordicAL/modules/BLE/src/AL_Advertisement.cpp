@@ -207,13 +207,27 @@ IO::BLE::TxPower IO::BLE::Advertisement::getTXPower()
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
 //---------------------------- STATIC FUNCTIONS -------------------------------
+/**
+ * @brief Takes memory for an advertisement data package from the pool.
+ * 
+ * @details Usable from ISR. Hand the package to queueForAdvertisement(),
+ * which takes care of returning it to the pool.
+ * 
+ * @param len length of the package in bytes
+ * @return uint8_t* package or nullptr if too long or no package is free
+ */
+uint8_t* IO::BLE::Advertisement::allocPackage(size_t len)
+{
+    return Advertiser::getPackagePool().allocateBuffer(len).release();
+}
+
 /**
  * @brief puts data into the advertisement queue.
  * 
  * @warning do not use from ISR
  * 
- * @param data heap allocated data array. Will be freed by Advertiser.
- * @param len length of heap alloc data array
+ * @param data package from allocPackage(). Will be freed by Advertiser.
+ * @param len length of the package
  * @param timeout 
  * 
  * @return Error::Code 
@@ -229,7 +243,7 @@ Error::Code
 
     // If enqueue failed, we have to free memory here.
     if (retVal != Error::None) {
-        delete (data);
+        CHECK_ERROR(Advertiser::getPackagePool().free(data));
     }
 
     return retVal;
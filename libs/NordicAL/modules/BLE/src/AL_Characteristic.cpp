@@ -40,7 +40,6 @@
 #include <BLE_Utility.h>
 #include <Endians.h>
 #include <aconnoConfig.h>
-#include <memory>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -62,9 +61,9 @@ IO::BLE::Characteristic<T>::Characteristic(Service&     parentService,
                                            Properties&& userProperties,
                                            const T&     userData)
     : CharacteristicBase{parentService, std::move(userProperties)},
-      userData(new T(userData))
+      userData(userData)
 {
-    Endians::machineToBig(*this->userData);
+    Endians::machineToBig(this->userData);
 }
 
 /**
@@ -89,14 +88,14 @@ IO::BLE::Characteristic<T>::Characteristic(
                          std::move(userProperties),
                          userBaseUUID,
                          userCharUUID},
-      userData(new T(userData))
+      userData(userData)
 {}
 
 template <class T>
 void IO::BLE::Characteristic<T>::updateValue(const T& newValue)
 {
-    *userData = newValue;
-    Endians::machineToBig(*userData);
+    userData = newValue;
+    Endians::machineToBig(userData);
 
     // Call to softdevice update function while not in connection
     // will cause a crash.
@@ -112,8 +111,10 @@ void IO::BLE::Characteristic<T>::updateValue(const T& newValue)
 template <class T>
 const T IO::BLE::Characteristic<T>::getValue()
 {
-    Endians::bigToMachine(*userData);
-    return (*userData);
+    // convert a copy, the stored value stays in big endian for the stack
+    T value {userData};
+    Endians::bigToMachine(value);
+    return value;
 }
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
@@ -131,13 +132,13 @@ size_t IO::BLE::Characteristic<T>::getDataSize()
 template <class T>
 uint8_t* IO::BLE::Characteristic<T>::getDataPtr()
 {
-    return reinterpret_cast<uint8_t*>(userData.get());
+    return reinterpret_cast<uint8_t*>(&userData);
 }
 
 template <class T>
 void IO::BLE::Characteristic<T>::onValueChanged()
 {
-    T value{*userData};
+    T value{userData};
     Endians::bigToMachine(value);
     this->trigger(value);
 }
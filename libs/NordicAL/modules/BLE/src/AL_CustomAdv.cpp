@@ -40,6 +40,8 @@
 #include "BLE_Utility.h"
 #include "aconnoConfig.h"
 
+#include <Wire.h>
+
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
 //-------------------------------- CONSTANTS ----------------------------------
@@ -110,7 +112,10 @@ Error::Code IO::BLE::CustomAdv<ManufSpecDataSize>::trigger(
     buildPackage(nullptr, packageLen);
 
     // Allocate memory for advertisement data package
-    uint8_t* package = new uint8_t[packageLen];
+    uint8_t* package = allocPackage(packageLen);
+    if (package == nullptr) {
+        return Error::OutOfResources;
+    }
 
     // Populate package with data
     buildPackage(package, packageLen);
@@ -172,29 +177,23 @@ void IO::BLE::CustomAdv<ManufSpecDataSize>::includeManufSpecData(
     uint8_t* package,
     size_t&  offset)
 {
-    size_t fieldSize = 0;
+    // length, type, company id and data
+    using Field = Wire::Struct<Wire::Little<uint8_t>,
+                               Wire::Little<Advertisement::AdvType>,
+                               Wire::Little<uint16_t>,
+                               Wire::Bytes<ManufSpecDataSize>>;
 
     if (ManufSpecDataSize > 0) {
         // ManufSpecData field enabled; process it
-        fieldSize += ManufSpecDataSize;
-        fieldSize += sizeof(CompanySigId);
-        fieldSize += AD_DATA_OFFSET;
-
-        if (package == nullptr) {
-            // Dry run, don't enqueue data, just add field size to offset variable
-            offset += fieldSize;
-        } else {
+        if (package != nullptr) {
             // Not a dry run, enqueue data
-            package[offset++] = static_cast<uint8_t>(fieldSize) - 1;
-            package[offset++] = static_cast<uint8_t>(
-                Advertisement::AdvType::ManufacturerSpecific);
-            package[offset++] = reinterpret_cast<uint8_t*>(&companyId)[0];
-            package[offset++] = reinterpret_cast<uint8_t*>(&companyId)[1];
-            memcpy(&package[(offset)],
-                   manufacturerData.data(),
-                   ManufSpecDataSize);
-            offset += ManufSpecDataSize;
+            Field::encode(&package[offset],
+                          static_cast<uint8_t>(Field::kSize - 1),
+                          Advertisement::AdvType::ManufacturerSpecific,
+                          companyId,
+                          manufacturerData);
         }
+        offset += Field::kSize;
     }
 }
 
@@ -12,10 +12,10 @@
  * 			the advertisement once it reads the advertisement. Purpose of this
  * 			class is to save that information for eventual later use.
  * 
- * 			By utilizing a lifetime linked list, this class stores information
- * 			on all devices. Depending on user choice (via kDelistInactive flag), 
- * 			it either stores all devices it came into contact with, or just 
- * 			the ones that are actively broadcasting their messages.
+ * 			Devices live in place in a fixed hash table keyed by their address.
+ * 			Depending on user choice (via setDeleteDevicesOnTimeout), it either
+ * 			stores all devices it came into contact with, or just the ones
+ * 			that are actively broadcasting their messages.
  * 
  * @version	0.1.0
  * @date 	2020-09-16
@@ -26,6 +26,7 @@
 //--------------------------------- INCLUDES ----------------------------------
 #include "AL_Device.h"
 #include "AL_Log.h"
+#include "ScopeExit.h"
 
 #include <cstring>
 
@@ -42,8 +43,7 @@ bool IO::BLE::Device::deleteDevicesOnTimeout {true};
 IO::BLE::Device::Device(const std::array<uint8_t, BLE_GAP_ADDR_LEN>& MACaddress,
                         int8_t                                       rssi)
         : address {MACaddress},
-          activityTimer(*this, kDefaultActivityTimeout), lastRSSI {rssi},
-          node(getList().appendStatic(*this))
+          activityTimer(*this, kDefaultActivityTimeout), lastRSSI {rssi}
 {
     activityTimer.start();
 }
@@ -52,7 +52,7 @@ IO::BLE::Device::Device(const std::array<uint8_t, BLE_GAP_ADDR_LEN>& MACaddress,
  * @brief Constructor of Device class Timer object.
  */
 IO::BLE::Device::Timer::Timer(Device& device, RTOS::milliseconds timeMs)
-        : RTOS::Timer("activityTimer", timeMs, false), device(device)
+        : ActivityWheel::Entry(getActivityWheel(), timeMs), device(device)
 {}
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
@@ -78,6 +78,21 @@ int8_t IO::BLE::Device::getLastRSSI() const
 
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
+/**
+ * @brief Hash of a device address for the device table.
+ * 
+ * @details Multiplicative hashing of all 48 bit, so devices of the same
+ * vendor that only differ in the lower bytes still spread evenly.
+ */
+uint32_t IO::BLE::Device::AddressHash::operator()(const Address& address) const
+{
+    uint64_t value = 0;
+    for (auto byte : address) {
+        value = (value << 8) | byte;
+    }
+    return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
 /**
@@ -105,55 +120,115 @@ void IO::BLE::Device::setLastRSSI(IO::BLE::RxPower rssi)
 /**
  * @brief Implements Device timer timeout handler.
  * 
+ * @details Runs in the timer task, deleting the device here is fine as
+ * the wheel already released the entry. The scanner might have seen the
+ * device again before the mutex was obtained, it is kept then.
+ * 
  * @return None.
  */
-void IO::BLE::Device::Timer::onTimer()
+void IO::BLE::Device::Timer::onExpired()
 {
     if (IO::BLE::Device::deleteDevicesOnTimeout) {
-        delete (&device);
+        CHECK_ERROR(getMutex().tryObtain());
+        auto mutexExit =
+            Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+        if (device.isActive()) {
+            // restarted meanwhile
+            return;
+        }
+        CHECK_ERROR(getTable().erase(device.address));
     }
 }
 
 //---------------------------- STATIC FUNCTIONS -------------------------------
 
 /**
- * @brief Device lifetime list getter function.
+ * @brief Creates a new device in the device table.
+ * 
+ * @details Devices are created from the scanner on every unknown address,
+ * so they are constructed in place in a fixed table instead of the heap.
+ * If kMaxDevices are known already, the device seen least recently gets
+ * deleted to make room. The device removes itself again on activity timeout.
+ * 
+ * @warning Only call with getMutex() obtained.
+ * 
+ * @param address BLE address of the device
+ * @param rssi Signal strength of the first advertisement
+ * @return IO::BLE::Device* New device or nullptr if address is known already
+ */
+IO::BLE::Device* IO::BLE::Device::create(const Address& address, RxPower rssi)
+{
+    return getTable().emplace(address, address, rssi);
+}
+
+/**
+ * @brief Device table getter function.
  * 
  * @details Uses eager loading to keep the right order of construction.
  * 			This way statically constructed objects always get a valid 
- * 			LifetimeList instance.
+ * 			table instance. Iterating the table visits the most recently
+ * 			seen devices first.
+ * 
+ * @warning Only use with getMutex() obtained.
  * 
- * @return Reference to device lifetime list.
+ * @return Reference to device table.
  */
-Collections::LifetimeList<IO::BLE::Device&>& IO::BLE::Device::getList()
+IO::BLE::Device::DeviceTable& IO::BLE::Device::getTable()
 {
-    static Collections::LifetimeList<Device&> list {};
-    return list;
+    static DeviceTable table {};
+    return table;
+}
+
+/**
+ * @brief Mutex guarding the device table.
+ * 
+ * @details The scanner task looks devices up and creates them, the timer
+ * task deletes them on timeout. Function local static for the same reason
+ * as getTable().
+ * 
+ * @return Reference to the device table mutex.
+ */
+RTOS::Mutex& IO::BLE::Device::getMutex()
+{
+    static RTOS::Mutex mutex {};
+    return mutex;
+}
+
+/**
+ * @brief Activity wheel getter function.
+ * 
+ * @details All device activity timers share this wheel, so restarting one
+ * on every advertisement is a few pointer operations instead of a command
+ * to the timer task. Function local static for the same reason as getTable().
+ * 
+ * @return Reference to the activity wheel.
+ */
+IO::BLE::Device::ActivityWheel& IO::BLE::Device::getActivityWheel()
+{
+    static ActivityWheel wheel {"activityWheel", kActivityWheelResolution};
+    return wheel;
 }
 
 /**
  * @brief Searches the device with the given address in all known devices.
  * 
+ * @details O(1), counts as seen for the eviction order.
+ * 
+ * @warning Only call with getMutex() obtained.
+ * 
  * @param address BLE address of the device
  * @return IO::BLE::Device* Pointer to the device or nullptr if not found
  */
 IO::BLE::Device* IO::BLE::Device::getByAddress(const IO::BLE::Address& address)
 {
-    for (auto& device : Device::getList()) {
-        if (std::equal(address.cbegin(),
-                       address.cend(),
-                       device.address.cbegin())) {
-            return &device;
-        }
-    }
-
-    return nullptr;
+    return getTable().find(address);
 }
 
 /**
  * @brief Prints list of all detected broadcasting devices.
  * 
- * @details Prints out all devices found in DeviceList as info log messages.
+ * @details Prints out all devices found in the table as info log messages,
+ * 			most recently seen first.
  * 			Devices are saved into the list as their advertisements are
  * 			processed. Depending on parameter setting, list may contains all devices
  * 			ever scanned, or just found devices which are still active.
@@ -170,7 +245,11 @@ void IO::BLE::Device::printDeviceList(bool onlyActives)
         LOG_I("BLE device list:");
     }
 
-    for (auto& device : IO::BLE::Device::getList()) {
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexExit =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    for (auto& device : IO::BLE::Device::getTable()) {
         if (device.isActive()) {
             LOG_I("\t%02X:%02X:%02X:%02X:%02X:%02X,  status: active",
                   device.address[0],
@@ -195,8 +274,8 @@ void IO::BLE::Device::printDeviceList(bool onlyActives)
 /**
  * @brief Set whether to delete discovered devices after kDefaultActivityTimeout.
  * 
- * @details Devices are heap allocated. Thereby deleting discovered device
- * after some time avoids an overflow of heap memory.
+ * @details The table holds kMaxDevices. Deleting discovered devices after
+ * some time keeps room for new ones without evicting active devices.
  * 
  * @param active Deletes old devices when true.
  */
@@ -64,7 +64,10 @@ Error::Code IO::BLE::Eddystone<ManufSpecDataSize>::trigger(
 {
     constexpr size_t packageLen = ManufSpecDataSize + sizeof(CompanySigId) +
                                   sizeof(Advertisement::AdvType) + 1;
-    uint8_t* package = new uint8_t[packageLen];
+    uint8_t* package = allocPackage(packageLen);
+    if (package == nullptr) {
+        return Error::OutOfResources;
+    }
     package[0]       = static_cast<uint8_t>(packageLen) - 1;
     package[1] =
         static_cast<uint8_t>(Advertisement::AdvType::ManufacturerSpecific);
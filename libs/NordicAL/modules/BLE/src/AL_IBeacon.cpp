@@ -14,6 +14,7 @@
 #include "AL_IBeacon.h"
 
 #include <AL_Log.h>
+#include <Wire.h>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -37,28 +38,31 @@ IO::BLE::IBeacon::IBeacon(RTOS::milliseconds        interval,
 
 Error::Code IO::BLE::IBeacon::trigger(RTOS::milliseconds timeout)
 {
-    constexpr size_t packageLen =
-        sizeof(Advertisement::AdvType) + sizeof(CompanySigId) +
-        sizeof(AdvIndicator) + sizeof(uuid) + sizeof(major) + sizeof(minor) + 2;
-    uint8_t* package = new uint8_t[packageLen];
+    // length, type, company id, indicator, uuid, major, minor, rssi at 1m
+    using Frame = Wire::Struct<Wire::Little<uint8_t>,
+                               Wire::Little<Advertisement::AdvType>,
+                               Wire::Little<CompanySigId>,
+                               Wire::Little<uint16_t>,
+                               Wire::Bytes<16>,
+                               Wire::Big<uint16_t>,
+                               Wire::Big<uint16_t>,
+                               Wire::Little<int8_t>>;
 
-    const auto companyId = CompanySigId::Apple;
+    constexpr size_t packageLen = Frame::kSize;
+    uint8_t*         package    = allocPackage(packageLen);
+    if (package == nullptr) {
+        return Error::OutOfResources;
+    }
 
-    size_t i     = 0;
-    package[i++] = static_cast<uint8_t>(packageLen) - 1;
-    package[i++] =
-        static_cast<uint8_t>(Advertisement::AdvType::ManufacturerSpecific);
-    package[i++] = reinterpret_cast<const uint8_t*>(&companyId)[0];
-    package[i++] = reinterpret_cast<const uint8_t*>(&companyId)[1];
-    package[i++] = reinterpret_cast<const uint8_t*>(&AdvIndicator)[0];
-    package[i++] = reinterpret_cast<const uint8_t*>(&AdvIndicator)[1];
-    memcpy(&package[i], uuid.data(), sizeof(uuid));
-    i += 16;
-    package[i++] = reinterpret_cast<uint8_t*>(&major)[1];
-    package[i++] = reinterpret_cast<uint8_t*>(&major)[0];
-    package[i++] = reinterpret_cast<uint8_t*>(&minor)[1];
-    package[i++] = reinterpret_cast<uint8_t*>(&minor)[0];
-    package[i++] = static_cast<int8_t>(getStdRx(getTXPower()));
+    Frame::encode(package,
+                  static_cast<uint8_t>(packageLen - 1),
+                  Advertisement::AdvType::ManufacturerSpecific,
+                  CompanySigId::Apple,
+                  AdvIndicator,
+                  uuid,
+                  major,
+                  minor,
+                  static_cast<int8_t>(getStdRx(getTXPower())));
 
     return queueForAdvertisement(package, packageLen, timeout);
 }
@@ -61,7 +61,11 @@ Error::Code IO::BLE::AconnoBeacon::trigger(RTOS::milliseconds timeout)
         CHECK_ERROR(setTXPower(getNextTxValue(getTXPower())));
     }
 
-    uint8_t* package           = new uint8_t[packageLen];
+    uint8_t* package = allocPackage(packageLen);
+    if (package == nullptr) {
+        return Error::OutOfResources;
+    }
+
     size_t   i                 = 0;
     auto     stdRx             = getStdRx(getTXPower());
     auto     stdRxStdDeviation = getStdRxStdDeviation(getTXPower());
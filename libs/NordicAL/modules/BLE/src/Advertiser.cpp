@@ -29,6 +29,7 @@
 #include "nrf_sdh_soc.h"
 
 #include <AL_Log.h>
+#include <AL_Port.h>
 #include <BLE_Utility.h>
 #include <Error.h>
 #include <PortUtility.h>
@@ -52,18 +53,24 @@ extern const char* const Config::DEVICE_NAME;
 
 //------------------------------ CONSTRUCTOR ----------------------------------
 /**
- * @brief Advertiser task constructor.
+ * @brief Advertiser CoTask constructor.
  * 
  * @details As there should always be only one advertiser per module, advertiser
  * 			is implemented according to singleton design pattern. Note that in 
  * 			singleton pattern no public constructors are available.
  */
 IO::BLE::Advertiser::Advertiser()
-        : radioEvents {}, advBurstCompletedEvent {radioEvents},
-          deviceConnectedEvent {radioEvents},
+        : RTOS::CoTask(Port::getExecutor()),
+          advBurstCompletedEvent {Port::getExecutor().getEventGroup()},
+          deviceConnectedEvent {Port::getExecutor().getEventGroup()},
           radioEventsList {&advBurstCompletedEvent, &deviceConnectedEvent},
-          advertisementQueue {"advQueue"}, rtosTask {*this, "Advertiser", 3}
+          advQueuedEvent {Port::getExecutor().getEventGroup()},
+          advertisementQueue {"advQueue"}, state(State::Idle),
+          advToBroadcast {},
+          broadcastData {nullptr, {&getPackagePool()}}
 {
+    advertisementQueue.setSendEvent(&advQueuedEvent);
+
     // Register a handler for BLE events.
     NRF_SDH_BLE_OBSERVER(m_ble_adv_observer,
                          Utility::APP_BLE_OBSERVER_PRIO,
@@ -78,20 +85,13 @@ IO::BLE::Advertiser::Advertiser()
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
 /**
- * @brief Implementation of task Context
- * 
- */
-void IO::BLE::Advertiser::onStart()
-{
-    // do nothing
-}
-
-/**
- * @brief Implements functionality of the advertiser task.
+ * @brief Implements functionality of the advertiser CoTask.
  *
- * @details This task is unblocked when there is new advertisement to be 
- * 			broadcasted. It updates advertisement data and parameters to match
- * 			the advertisement which is to be broadcasted.
+ * @details Resumed when there is new advertisement to be broadcasted. It
+ * 			updates advertisement data and parameters to match the
+ * 			advertisement which is to be broadcasted, then waits for the burst
+ * 			to finish. Advertisements that queued up meanwhile are broadcasted
+ * 			one after another, without any context switch.
  * 
  *          Broadcasting advertisements is disrupted when a new device connection is formed.
  *          This is due to Nordic stack invoking sd_adv_stop() at connect event. Advertiser has
@@ -99,19 +99,50 @@ void IO::BLE::Advertiser::onStart()
  *          As advertisements by their very nature are not time critical nor guaranteed to arrive
  *          at every interval, this is deemed acceptable.
  * 
- * @return  None.
+ * @param result Result of the last wait.
+ * @return RTOS::Await Next advertisement or end of the burst.
  */
-void IO::BLE::Advertiser::onRun()
+RTOS::Await IO::BLE::Advertiser::onResume(Error::Code result)
 {
-    // Block waiting on advertisement to become available in adv. queue.
-    auto errCode = advertisementQueue.receive(advToBroadcast, RTOS::Infinity);
-    if (errCode != Error::None) {
-        LOG_E("Receiving from advertisement queue failed: %u", errCode);
-        return;
+    switch (state) {
+        case State::Idle:
+            break;
+        case State::Receiving:
+            if (result != Error::None) {
+                LOG_E("Receiving from advertisement queue failed: %u",
+                      result);
+                break;
+            }
+            if (startBroadcast() == Error::None) {
+                // Wait until the advertisement burst is finished
+                // broadcasting or device connects.
+                state = State::Broadcasting;
+                return RTOS::Await::anyEvent(radioEventsList,
+                                             kCriticalTimeout);
+            }
+            broadcastData.reset();
+            break;
+        case State::Broadcasting:
+            finishBroadcast(result);
+            break;
     }
 
-    // Delete dynamic memory on return
-    std::unique_ptr<uint8_t> data {std::move(advToBroadcast.data)};
+    // Wait for advertisement to become available in adv. queue
+    state = State::Receiving;
+    return RTOS::Await::receive(advertisementQueue, advToBroadcast);
+}
+
+/**
+ * @brief Starts broadcasting the advertisement received from the queue.
+ *
+ * @details Takes over the advertisement data, it is freed after the burst.
+ *
+ * @return Error::Code None if the burst got started.
+ */
+Error::Code IO::BLE::Advertiser::startBroadcast()
+{
+    // Return package to the pool when done
+    broadcastData.reset(advToBroadcast.data);
 
     // Reset advetisement parameters struct
     memset(&advParameters, 0, sizeof(advParameters));
@@ -135,17 +166,17 @@ void IO::BLE::Advertiser::onRun()
     }
 
     // Define data to advertise
-    advData.adv_data.p_data      = data.get();
+    advData.adv_data.p_data      = broadcastData.get();
     advData.adv_data.len         = (uint16_t)advToBroadcast.len;
     advData.scan_rsp_data.p_data = nullptr;
     advData.scan_rsp_data.len    = 0;
 
     // Initialize the adv package, do not yet supply any data
-    errCode = Port::Utility::getError(
+    auto errCode = Port::Utility::getError(
         sd_ble_gap_adv_set_configure(&advHandle, &advData, &advParameters));
     if (errCode != Error::None) {
         LOG_D("Failed to configure gap advertisement: %u", errCode);
-        return;
+        return errCode;
     }
 
     // Settable only after m_advertising handle has be initialized
@@ -155,32 +186,39 @@ void IO::BLE::Advertiser::onRun()
                                 (int8_t)advToBroadcast.txPower));
     if (errCode != Error::None) {
         LOG_D("Failed to the advertisement set tx power value: %u", errCode);
-        return;
+        return errCode;
     }
 
-    radioEvents.resetEvents(radioEventsList);
+    Port::getExecutor().getEventGroup().resetEvents(radioEventsList);
 
     errCode = Port::Utility::getError(
         sd_ble_gap_adv_start(advHandle, Utility::APP_BLE_CONN_CFG_TAG));
     if (errCode != Error::None) {
         LOG_D("Failed to start the advertising: %u", errCode);
         LOG_D(" --- expected to occur when a device connects to beacon.");
-        return;
+        return errCode;
     }
 
-    // Wait until the advertisement burst is finished broadcasting or device connects.
-    errCode = radioEvents.await(radioEventsList,
-                                kCriticalTimeout,
-                                RTOS::EventGroup::WaitMode::Or);
+    return Error::None;
+}
 
-    if (errCode != Error::None) {
-        if (errCode == Error::Timeout) {
+/**
+ * @brief Cleans up after the burst finished, the device connected or
+ * the softdevice did not respond in time.
+ *
+ * @param result Result of waiting for radioEventsList.
+ */
+void IO::BLE::Advertiser::finishBroadcast(Error::Code result)
+{
+    if (result != Error::None) {
+        if (result == Error::Timeout) {
             LOG_E("Advertisement timed out. Reseting Advertiser.");
         } else {
             LOG_E("Unknown Advertiser error, resetting.");
         }
         reset();
     }
+    broadcastData.reset();
 }
 
 /**
@@ -210,7 +248,8 @@ void IO::BLE::Advertiser::onConnect()
 void IO::BLE::Advertiser::reset()
 {
     sd_ble_gap_adv_stop(advHandle);
-    getInstance().radioEvents.resetEvents(getInstance().radioEventsList);
+    Port::getExecutor().getEventGroup().resetEvents(
+        getInstance().radioEventsList);
 }
 
 /**
@@ -223,6 +262,21 @@ IO::BLE::Advertiser& IO::BLE::Advertiser::getInstance()
     return instance;
 }
 
+/**
+ * @brief Pool all advertisement data packages are taken from.
+ *
+ * @details Function local static, so Advertisements constructed statically
+ * find it initialized. Packages are returned to it by the Advertiser after
+ * the burst.
+ *
+ * @return PackagePool& The package pool
+ */
+IO::BLE::Advertiser::PackagePool& IO::BLE::Advertiser::getPackagePool()
+{
+    static PackagePool pool {};
+    return pool;
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
 
 /**
@@ -32,16 +32,18 @@
  * @brief Takes raw adv data and parses it
  * 
  * @param outData Parsed data output.
- * @param rawData Pointer to raw data in Heap.
+ * @param rawData Pointer to raw data, only read during the call.
  * @param rawDataSize Size of the raw data.
- * @return Error::Code Might fail on length checks for certain fields.
+ * @return Error::Code Might fail on length checks for certain fields,
+ * SizeMissmatch if a field exceeds the raw data. A field of length 0 ends
+ * the data.
  */
 Error::Code
-    IO::BLE::ParsedAdvData::parseRawData(IO::BLE::ParsedAdvData&    outData,
-                                         std::unique_ptr<uint8_t[]> rawData,
-                                         const size_t               rawDataSize)
+    IO::BLE::ParsedAdvData::parseRawData(IO::BLE::ParsedAdvData& outData,
+                                         const uint8_t*          rawData,
+                                         const size_t            rawDataSize)
 {
-    outData     = std::move(ParsedAdvData {});
+    outData     = ParsedAdvData {};
     auto result = Error::None;
 
     size_t offset    = 0;
@@ -49,9 +51,20 @@ Error::Code
 
     // Disassemble advertisement field by field
     while (offset < rawDataSize) {
+        if (rawData[offset] == 0) {
+            // length 0 terminates the data, the rest is padding
+            break;
+        }
+        if (offset + 1 >= rawDataSize) {
+            // field type missing
+            return Error::SizeMissmatch;
+        }
         fieldSize =
             rawData[offset++] - 1;  // fieldSize also contains fieldType size 1
         AdvDataField fieldType = static_cast<AdvDataField>(rawData[offset++]);
+        if (offset + fieldSize > rawDataSize) {
+            return Error::SizeMissmatch;
+        }
 
         switch (fieldType) {
             case AdvDataField::Flags: {
@@ -78,22 +91,17 @@ Error::Code
             }
 
             case AdvDataField::ManufSpecificData: {
-                outData.manufacturerDataSize = fieldSize;
-                outData.manufacturerData.reset(
-                    new uint8_t[outData.manufacturerDataSize]);
-                std::copy(&rawData[offset],
-                          &rawData[offset + outData.manufacturerDataSize],
-                          outData.manufacturerData.get());
+                RETURN_ON_ERROR(
+                    outData.manufacturerData.assign(&rawData[offset],
+                                                    fieldSize));
                 break;
             }
 
             case AdvDataField::ShortenedLocalName:
             case AdvDataField::CompleteLocalName: {
-                outData.nameSize = fieldSize;
-                outData.name.reset(new char[outData.nameSize]);
-                std::copy(&rawData[offset],
-                          &rawData[offset + outData.nameSize],
-                          outData.name.get());
+                RETURN_ON_ERROR(outData.name.assign(
+                    reinterpret_cast<const char*>(&rawData[offset]),
+                    fieldSize));
                 break;
             }
 
@@ -14,8 +14,11 @@
 #include "Endians.h"
 #include "PortUtility.h"
 #include "Scanner.h"
+#include "ScopeExit.h"
 #include "nrf_sdh_ble.h"
 
+#include <algorithm>
+
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
 //-------------------------------- CONSTANTS ----------------------------------
@@ -28,10 +31,9 @@
 IO::BLE::Scanner::Scanner()
         : scanInterval {kDefaultScanInterval}, scanWindow {kDefaultScanWindow},
           scanTimeout {kDefaultScanTimeout}, filteringEnabled {false},
-          dataFilter {nullptr}, dataMask {nullptr}, advertisementQueue {"Scanne"
-                                                                        "rAdvQu"
-                                                                        "eue"},
-          task {*this, "scannerTask", 3}
+          dataFilter {}, dataMask {}, advertisementRing {}, droppedCount {0},
+          truncatedCount {0}, reportedDropped {0}, reportedTruncated {0},
+          task {*this, "scannerTask", 3, TaskType::RunMode::Batch}
 {
     NRF_SDH_BLE_OBSERVER(m_ble_scanner_observer,
                          NRF_BLE_SCAN_OBSERVER_PRIO,
@@ -178,39 +180,65 @@ void IO::BLE::Scanner::onStart()
 /**
  * @brief Implementation of scanner task
  * 
- * @details Scanner task blocks on advertisement queue, waiting for scanner to
- * 			detect advertisements. Once placed in queue, advertisements are
- * 			taken from the queue and processed one by one by this task function.
+ * @details Scanner task blocks on advertisement ring, waiting for scanner to
+ * 			detect advertisements. Once woken, all advertisements in the ring
+ * 			are processed in place before blocking again. Task runs in batch
+ * 			mode, so bursts of advertisements do not cost a context switch
+ * 			each.
  * 
  * @return None.
  */
 void IO::BLE::Scanner::onRun()
 {
-    RawAdvData rawAdv {};
+    const RawAdvData* rawAdvPtr = nullptr;
 
-    // Block until there is advertisement to process
-    Error::Code retVal = advertisementQueue.receive(rawAdv);
+    // Block until there is advertisement to process, then drain the ring
+    Error::Code retVal = advertisementRing.peekRef(rawAdvPtr);
     if (retVal != Error::None) {
-        LOG_W("Scanner could not receive from queue");
+        LOG_W("Scanner could not receive from ring");
         return;
     }
 
-    bool  newDevice = false;
-    auto* device    = Device::getByAddress(rawAdv.address);
+    do {
+        processAdvertisement(*rawAdvPtr);
+        // slot is handed back to onAdvReport once done with it
+        advertisementRing.drop();
+    } while (advertisementRing.peekRef(rawAdvPtr, 0) == Error::None);
+
+    reportLosses();
+}
+
+/**
+ * @brief Processes a single advertisement taken from the ring.
+ * 
+ * @details Updates the device list, parses the data and notifies observers
+ * 			if the advertisement passes the filter.
+ * 
+ * 			The device table stays locked until observers are notified,
+ * 			the timer task could delete the device otherwise.
+ * 
+ * @param rawAdv Advertisement inside the ring, only valid during the call.
+ */
+void IO::BLE::Scanner::processAdvertisement(const RawAdvData& rawAdv)
+{
+    CHECK_ERROR(Device::getMutex().tryObtain());
+    auto mutexRelease =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, Device::getMutex());
+
+    bool    newDevice = false;
+    Device* device    = Device::getByAddress(rawAdv.address);
     if (!device) {
         // If the device is not yet known, create
         newDevice = true;
-        device    = new Device {rawAdv.address, rawAdv.rssi};
+        device    = Device::create(rawAdv.address, rawAdv.rssi);
     } else {
         device->setToActive();
         device->setLastRSSI(rawAdv.rssi);
     }
 
-    std::unique_ptr<uint8_t[]> uniqueData {rawAdv.data};
-    ParsedAdvData              parsed {};
-    retVal = ParsedAdvData::parseRawData(parsed,
-                                         std::move(uniqueData),
-                                         rawAdv.dataSize);
+    ParsedAdvData parsed {};
+    auto          retVal =
+        ParsedAdvData::parseRawData(parsed, rawAdv.data.data(), rawAdv.dataSize);
     if (retVal == Error::NotFound) {
         LOG_D("Advertisement Package contains not implemented fields "
               "%02X:%02X:%02X:%02X:%02X:%02X",
@@ -238,6 +266,32 @@ void IO::BLE::Scanner::onRun()
     }
 }
 
+/**
+ * @brief Log advertisements lost in onAdvReport() since the last report.
+ * 
+ * @details Counting happens in SD context, where logging every loss would
+ * 			slow down scanning even more. The task logs the sum instead.
+ * 
+ * @return None.
+ */
+void IO::BLE::Scanner::reportLosses()
+{
+    uint32_t dropped   = droppedCount.load(std::memory_order_relaxed);
+    uint32_t truncated = truncatedCount.load(std::memory_order_relaxed);
+
+    if (dropped != reportedDropped) {
+        LOG_W("Scanner ring full, dropped %u advertisements",
+              dropped - reportedDropped);
+        reportedDropped = dropped;
+    }
+    if (truncated != reportedTruncated) {
+        LOG_W("Scanner truncated %u advertisements to %u bytes",
+              truncated - reportedTruncated,
+              static_cast<unsigned>(kMaxLegacyAdvDataSize));
+        reportedTruncated = truncated;
+    }
+}
+
 /**
  * @brief Scanning interval setter function.
  * 
@@ -366,19 +420,19 @@ bool IO::BLE::Scanner::advertisementApproved(const ParsedAdvData& advData) const
 bool IO::BLE::Scanner::filterByManufacturerData(
     const ParsedAdvData& advData) const
 {
-    if (!dataFilter) {
+    if (dataFilter.empty()) {
         // No filter data set, do not apply
         LOG_W("Scanner filter activated but not set.");
         return true;
     }
 
-    if (advData.manufacturerDataSize < dataFilterSize) {
+    if (advData.manufacturerData.size() < dataFilter.size()) {
         // Data is smaller than filter, therefore cannot match it
         return false;
     }
 
     // Compare manufacturer data field with filter, byte by byte
-    for (size_t i = 0; i != dataFilterSize; i++) {
+    for (size_t i = 0; i != dataFilter.size(); i++) {
         if (dataMask[i] == 0x0) {
             // Any value for this field is OK
             continue;
@@ -467,7 +521,13 @@ void IO::BLE::Scanner::eventHandler(ble_evt_t const* p_ble_evt, void* p_context)
  * 
  * @details Advertising report event denotes that an advertisement has been
  * 			detected and read by the scanner. Required information is extracted
- * 			from the report and copied to advertisement queue.
+ * 			from the report and copied to the lock-free advertisement ring.
+ * 			Neither heap nor critical sections are involved, the scanner task
+ * 			only gets notified if it is waiting.
+ * 
+ * 			If the ring is full the report is dropped instead of waiting
+ * 			for the task, data beyond kMaxLegacyAdvDataSize is cut off.
+ * 			Both are counted and logged by the task, see reportLosses().
  * 
  * 			From there, advertisements are processed without blocking scanner
  * 			functionality.
@@ -480,38 +540,36 @@ void IO::BLE::Scanner::eventHandler(ble_evt_t const* p_ble_evt, void* p_context)
  */
 void IO::BLE::Scanner::onAdvReport(ble_gap_evt_adv_report_t const* p_adv_report)
 {
-    size_t   dataSize = p_adv_report->data.len;
-    uint8_t* data     = nullptr;
-    Address  address {};
+    auto& scanner = getInstance();
 
-    if (dataSize > 0) {
-        data = new uint8_t[dataSize];
+    if (p_adv_report->data.len > kMaxLegacyAdvDataSize) {
+        scanner.truncatedCount.fetch_add(1, std::memory_order_relaxed);
     }
 
+    RawAdvData rawAdv;
+    rawAdv.rssi     = p_adv_report->rssi;
+    rawAdv.dataSize = static_cast<uint8_t>(
+        std::min<size_t>(p_adv_report->data.len, kMaxLegacyAdvDataSize));
+
     // Fill scanner data package using scanned advertisement
     std::copy(&p_adv_report->data.p_data[0],
-              &p_adv_report->data.p_data[dataSize],
-              data);
+              &p_adv_report->data.p_data[rawAdv.dataSize],
+              rawAdv.data.begin());
 
     std::copy(&p_adv_report->peer_addr.addr[0],
               &p_adv_report->peer_addr.addr[sizeof(Address)],
-              address.begin());
+              rawAdv.address.begin());
 
-    // Copy to queue
-    Error::Code retVal = getInstance().advertisementQueue.send(
-        {p_adv_report->rssi, dataSize, data, std::move(address)});
+    // Copy to ring, drop the report if the task falls behind
+    Error::Code retVal = scanner.advertisementRing.tryPush(rawAdv);
     if (retVal != Error::Code::None) {
-        LOG_E("Scanner - advertisement queue enqueue failed!: %u", retVal);
-        // heap memor needs to be freed here
-        if (data) {
-            delete[](data);
-        }
+        scanner.droppedCount.fetch_add(1, std::memory_order_relaxed);
     }
 
     // Continue scanning
     ble_data_t scanBuffer = {
-        .p_data = getInstance().scanBufferData.data(),
-        .len    = static_cast<uint16_t>(getInstance().scanBufferData.size())};
+        .p_data = scanner.scanBufferData.data(),
+        .len    = static_cast<uint16_t>(scanner.scanBufferData.size())};
     ret_code_t errCode = sd_ble_gap_scan_start(NULL, &scanBuffer);
     if (errCode != NRF_SUCCESS) {
         LOG_W("BLE scanner error %u", Port::Utility::getError(errCode));
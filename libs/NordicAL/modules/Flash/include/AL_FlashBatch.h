@@ -0,0 +1,83 @@
+/**
+ * @file AL_FlashBatch.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief queues several flash operations and waits for them at once
+ * @version 1.0
+ * @date 2020-11-21
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_FLASHBATCH_H__
+#define __AL_FLASHBATCH_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+class Batch;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashFile.h"
+#include "sdk_config.h"
+
+#include <Error.h>
+#include <array>
+#include <cstddef>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Keeps the FDS queue filled while writing a burst of records.
+ *
+ * @details Every operation gets its Pending from next(). Once kDepth
+ * operations are in flight, next() waits for the oldest one, so any number
+ * of records can be written while flash programs the previous ones.
+ * await() waits for the rest and reports the first error.
+ *
+ * @example Store a burst of samples:
+ * ```cpp
+ * IO::Flash::Batch batch {};
+ * for (auto& sample : samples) {
+ *     RETURN_ON_ERROR(collection.add(sample, batch.next()));
+ * }
+ * RETURN_ON_ERROR(batch.await());
+ * ```
+ *
+ * @warning Not thread safe, use one batch per task.
+ */
+class Batch {
+    // delete default constructors
+    Batch(const Batch& other) = delete;
+    Batch& operator=(const Batch& other) = delete;
+
+    static_assert(FDS_OP_QUEUE_SIZE >= 3, "FDS queue too short to batch");
+
+public:
+    /**
+     * operations in flight, leaves one slot for queueing the next one and
+     * one for the garbage collection it might need
+     */
+    static constexpr size_t kDepth = FDS_OP_QUEUE_SIZE - 2;
+
+    Batch();
+
+    Pending&    next();
+    Error::Code await();
+
+private:
+    std::array<Pending, kDepth> pendings; /**< used round robin */
+    size_t      nextIndex; /**< pending handed out by next() */
+    Error::Code firstError; /**< first failed operation since await() */
+
+    void collect(Pending& pending);
+};
+}  // namespace IO::Flash
+#endif  //__AL_FLASHBATCH_H__
@@ -0,0 +1,80 @@
+/**
+ * @file AL_FlashCachedRecord.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief record in flash with a write through copy in RAM
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_FLASHCACHEDRECORD_H__
+#define __AL_FLASHCACHEDRECORD_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+template<class T>
+class CachedRecord;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashRecord.h"
+#include "FlashRecordCache.h"
+
+#include <Error.h>
+#include <type_traits>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Record in flash, served from RAM after the first read.
+ *
+ * @details Drop in for Record with values that are read far more often
+ * than written, like configuration read on every sensor cycle. The first
+ * tryGet() reads flash and fills the RecordCache, later ones copy from RAM
+ * without searching FDS. trySet() writes flash through Record and updates
+ * the cache once the write finished. Values are left out of the cache if
+ * another write finished while reading or writing, see RecordCache.
+ *
+ * The cache is shared and bounded, a value evicted by others is simply read
+ * from flash again. CachedRecord and Record of the same name and file can
+ * be mixed, writes through either keep the cache coherent.
+ *
+ * @warning All writing operations will block until done, see Record.
+ *
+ * @tparam T trivially copyable, at most RecordCache::kMaxValueBytes.
+ */
+template<class T>
+class CachedRecord {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "cached values are copied byte wise");
+    static_assert(sizeof(T) <= RecordCache::kMaxValueBytes,
+                  "value too large for the record cache");
+
+    // delete default constructors
+    CachedRecord()                          = delete;
+    CachedRecord(const CachedRecord& other) = delete;
+    CachedRecord& operator=(const CachedRecord& other) = delete;
+
+public:
+    CachedRecord(const char* const identifier, File& file);
+
+    Error::Code tryGet(T& value);
+    Error::Code trySet(const T& value);
+
+private:
+    Record<T>        record; /**< flash side of the value */
+    RecordCache::Key key; /**< RAM side, record key hashed only once */
+};
+}  // namespace IO::Flash
+
+#include "../src/AL_FlashCachedRecord.cpp"
+#endif  //__AL_FLASHCACHEDRECORD_H__
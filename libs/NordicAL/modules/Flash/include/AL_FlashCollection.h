@@ -39,8 +39,8 @@ namespace IO::Flash
 /**
  * @brief String identified generic list stored in flash memory.
  * 
- * @warning All writing operations will block until done.
- * This is due to the async underlying "FDS" library not
+ * @warning All writing operations will block until done, except add() with
+ * a Pending. This is due to the async underlying "FDS" library not
  * having timeouts.
  * 
  * @details Used to store multiple entries of the same data type
@@ -73,6 +73,7 @@ public:
     Collection(const char* const name);
 
     Error::Code add(const T& element);
+    Error::Code add(const T& element, Pending& pending);
     Error::Code remove(const T& element);
 
     Iterator begin();
@@ -0,0 +1,195 @@
+/**
+ * @file AL_FlashDeferredRecord.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief flash record that holds back frequent writes in RAM
+ * @version 1.0
+ * @date 2020-11-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_FLASHDEFERREDRECORD_H__
+#define __AL_FLASHDEFERREDRECORD_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+class DeferredRecordBase;
+
+template<class T>
+class DeferredRecord;
+}  // namespace IO::Flash
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashRecord.h"
+
+#include <AL_Event.h>
+#include <AL_EventGroup.h>
+#include <AL_Mutex.h>
+#include <AL_RTOS.h>
+#include <AL_Task.h>
+#include <Error.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Registry of all DeferredRecords, so they can be flushed together.
+ *
+ * @details Every DeferredRecord links itself in on construction. Create
+ * them at startup, like other eager singletons, linking is not locked.
+ */
+class DeferredRecordBase {
+    // delete default constructors
+    DeferredRecordBase(const DeferredRecordBase& other) = delete;
+    DeferredRecordBase& operator=(const DeferredRecordBase& other) = delete;
+
+public:
+    static Error::Code flushAll();
+    static bool        tryFlushAll();
+    static uint32_t    getWritesAvoided();
+    static uint32_t    getWrites();
+
+    /**
+     * @brief Write the held back value, blocks until done.
+     *
+     */
+    virtual Error::Code flush() = 0;
+
+protected:
+    DeferredRecordBase();
+    virtual ~DeferredRecordBase();
+
+    /**
+     * @brief Queue the held back value without waiting for flash.
+     *
+     * @return true once the value is written.
+     */
+    virtual bool tryFlush() = 0;
+
+    static void requestFlush();
+
+    /** trySet() calls that did not write */
+    static std::atomic<uint32_t> writesAvoided;
+    /** values actually written */
+    static std::atomic<uint32_t> writes;
+
+private:
+    class Flusher;
+
+    static DeferredRecordBase*& getFirst();
+    static Flusher&             getFlusher();
+
+    DeferredRecordBase* next; /**< next record in the registry */
+};
+
+/**
+ * @brief Task running flushAll() for tryFlushAll(), when a value needs
+ * flash to be waited for, e.g. to create its file.
+ *
+ */
+class DeferredRecordBase::Flusher {
+    /** StackSize of the flush task in sizeof(StackType_t) bytes */
+    static constexpr size_t kStackSize = 256;
+
+    using TaskType = RTOS::Task<kStackSize, Flusher>;
+    friend TaskType;
+
+    // delete default constructors
+    Flusher(const Flusher& other) = delete;
+    Flusher& operator=(const Flusher& other) = delete;
+
+public:
+    Flusher();
+
+    void request();
+    bool isRequested();
+
+private:
+    RTOS::EventGroup events; /**< holds requested */
+    RTOS::Event      requested; /**< set until flushAll() starts */
+    TaskType         task; /**< runs flushAll() */
+
+    void onStart();
+    void onRun();
+};
+
+/**
+ * @brief Record in flash for values that change often, like counters and
+ * last known states.
+ *
+ * @details trySet() keeps the value in RAM and writes it to flash only
+ * - when window passed since the first value that was held back,
+ * - when maxUpdates values were held back,
+ * - on flush(), or flushAll() for all DeferredRecords.
+ * Values equal to the one in flash (or the one held back) are not written
+ * at all. Every value that does not reach flash counts as a write avoided.
+ *
+ * The window is checked on trySet(), a value set last stays in RAM until
+ * the next trySet() or a flush. Call DeferredRecordBase::flushAll() before
+ * sleeping and once the battery gets low. SYS::DFU flushes all of them
+ * before resetting into the bootloader.
+ *
+ * @warning A value held back is lost on a reset.
+ *
+ * @tparam T trivially copyable, compared byte wise.
+ */
+template<class T>
+class DeferredRecord : public DeferredRecordBase {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "deferred values are compared byte wise");
+
+    // delete default constructors
+    DeferredRecord()                            = delete;
+    DeferredRecord(const DeferredRecord& other) = delete;
+    DeferredRecord& operator=(const DeferredRecord& other) = delete;
+
+public:
+    DeferredRecord(const char* const  identifier,
+                   File&              file,
+                   RTOS::milliseconds window,
+                   size_t             maxUpdates);
+    virtual ~DeferredRecord();
+
+    Error::Code tryGet(T& value);
+    Error::Code trySet(const T& value);
+    bool        isDirty() const;
+
+    // DeferredRecordBase
+    virtual Error::Code flush() final;
+
+private:
+    Record<T>                record; /**< flash side of the value */
+    /** minimum time between flash writes of a changing value */
+    const RTOS::milliseconds window;
+    const size_t             maxUpdates; /**< most values held back */
+    T                        value; /**< latest value, valid if known */
+    bool                     known; /**< whether value was read or set */
+    bool                     dirty; /**< value not yet handed to flash */
+    bool                     isCacheStale; /**< cache to drop after a write */
+    size_t                   updates; /**< values set since last write */
+    RTOS::milliseconds       firstUpdate; /**< time of first held back value */
+    Pending                  pending; /**< write queued by tryFlush() */
+    RTOS::Mutex              mutex; /**< guards all of the above */
+
+    Error::Code write();
+    bool        collect(RTOS::milliseconds timeout);
+    bool        isSame(const T& other) const;
+
+    // DeferredRecordBase
+    virtual bool tryFlush() final;
+};
+}  // namespace IO::Flash
+
+#include "../src/AL_FlashDeferredRecord.cpp"
+#endif  //__AL_FLASHDEFERREDRECORD_H__
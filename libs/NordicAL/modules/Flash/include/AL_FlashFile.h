@@ -25,7 +25,10 @@ class File;
 #include "sdk_config.h"
 
 #include <AL_Event.h>
+#include <AL_Mutex.h>
+#include <AL_RTOS.h>
 #include <Error.h>
+#include <Pool.h>
 #include <array>
 #include <iterator>
 #include <memory>
@@ -39,7 +42,10 @@ namespace IO::Flash
 /**
  * @brief File stored in flash.
  * 
- * @warning All writing operations will block until done.
+ * @warning All writing operations will block until done, unless a Pending
+ * is given to wait on later. Async operations given a timeout never wait
+ * for flash, they return Busy if the file has to be created first or
+ * flash needs a garbage collection.
  * This is due to the async underlying "FDS" library not
  * having timeouts.
  * 
@@ -64,26 +70,68 @@ class File {
     friend class Record;
 
 public:
+    class Pending;
+
+    /** Largest record (including padding to words) that can be written. */
+    static constexpr size_t kMaxRecordBytes = 128;
+
+    /**
+     * @brief Notified from the flash event handler once an operation
+     * finished, must not block.
+     *
+     */
+    using Callback = void (*)(Error::Code result, void* context);
+
     File(const char* const name);
     const char* const getName();
     Error::Code       clear();
 
 protected:
-    Error::Code createRecord(uint16_t                         recordKey,
-                             std::unique_ptr<const uint8_t[]> buffer,
-                             const size_t                     lenBytes);
-    Error::Code updateRecord(fds_record_desc_t&               descriptor,
-                             uint16_t                         newRecordKey,
-                             std::unique_ptr<const uint8_t[]> buffer,
-                             const size_t                     lenBytes);
+    /**
+     * @brief Pool for the data of records being written.
+     * One for every queued operation, plus the file descriptor record and
+     * one per writer waiting for a free operation slot.
+     *
+     */
+    using BufferPool =
+        Patterns::BlockPool<kMaxRecordBytes, FDS_OP_QUEUE_SIZE + 2>;
+    using Buffer = BufferPool::Buffer;
+
+    static Error::Code allocBuffer(Buffer& buffer, size_t lenBytes);
+
+    Error::Code createRecord(uint16_t     recordKey,
+                             Buffer       buffer,
+                             const size_t lenBytes,
+                             uint32_t*    recordId = nullptr);
+    Error::Code updateRecord(fds_record_desc_t& descriptor,
+                             uint16_t           newRecordKey,
+                             Buffer             buffer,
+                             const size_t       lenBytes);
 
     Error::Code removeRecord(fds_record_desc_t& descriptor);
 
+    Error::Code createRecordAsync(uint16_t           recordKey,
+                                  Buffer             buffer,
+                                  const size_t       lenBytes,
+                                  Pending&           pending,
+                                  RTOS::milliseconds timeout = RTOS::Infinity);
+    Error::Code updateRecordAsync(fds_record_desc_t& descriptor,
+                                  uint16_t           newRecordKey,
+                                  Buffer             buffer,
+                                  const size_t       lenBytes,
+                                  Pending&           pending,
+                                  RTOS::milliseconds timeout = RTOS::Infinity);
+    Error::Code removeRecordAsync(fds_record_desc_t& descriptor,
+                                  Pending&           pending,
+                                  RTOS::milliseconds timeout = RTOS::Infinity);
+
     RecordCollection findByRecordKey(uint16_t recordKey);
 
 private:
-    Error::Code getId(uint16_t& id);
+    Error::Code getId(uint16_t&          id,
+                      RTOS::milliseconds timeout = RTOS::Infinity);
     Error::Code create();
+    Error::Code createDescriptor(uint16_t fileId);
 
     static void init();
 
@@ -119,17 +167,23 @@ private:
                  recordId; /**< record id of the record. On update this gets updated from the handler */
         uint16_t fileId; /**< file id if needed */
         uint16_t recordKey; /**< record key if needed */
-        std::unique_ptr<const uint8_t[]>
-            heapPtr; /**< pointer to allocated heap where raw data is stored */
+        Buffer heapPtr; /**< buffer from the pool where raw data is stored */
+        uint32_t sequence; /**< queue order, FDS finishes in order */
+        Callback callback; /**< notified on completion if set */
+        void*    context; /**< passed to callback */
 
         HeapChunk();
 
+        void submit(const Pending& pending);
+        void finish(Error::Code result);
         void free();
     };
 
     static std::array<HeapChunk, FDS_OP_QUEUE_SIZE>& getChunks();
     static RTOS::EventGroup&                         getFinishEvents();
     static RTOS::EventGroup&                         getFreeEvents();
+    static BufferPool&                               getBufferPool();
+    static RTOS::Mutex&                              getSubmitMutex();
     static void handler(fds_evt_t const* evt);
     static void handlerWriteUpdate(fds_evt_t const* evt);
     static void handlerDeleteRecord(fds_evt_t const* evt);
@@ -137,8 +191,14 @@ private:
     static void handlerGarbageCollection(fds_evt_t const* evt);
 
     static Error::Code callGarbageCollection(bool& ran);
-    static Error::Code allocRecordSpace(HeapChunk*&    iChunk,
-                                        AsyncOperation operation);
+    static Error::Code submitWrite(HeapChunk*         chunk,
+                                   fds_record_desc_t& descriptor,
+                                   const size_t       lenBytes,
+                                   RTOS::milliseconds timeout);
+    static Error::Code
+        allocRecordSpace(HeapChunk*&        iChunk,
+                         AsyncOperation     operation,
+                         RTOS::milliseconds timeout = RTOS::Infinity);
     static RTOS::EventList<FDS_OP_QUEUE_SIZE> getFreeEventList();
 };
 
@@ -181,6 +241,49 @@ private:
     void nextAllFiles();
 };
 
+/**
+ * @brief Handle of a queued flash operation.
+ *
+ * @details Returned filled by the ...Async() functions once FDS accepted the
+ * operation, those return right away instead of waiting for flash to be
+ * programmed. FDS queues up to FDS_OP_QUEUE_SIZE operations and works
+ * through them in order, so writing a burst overlaps queueing with
+ * programming. Use Batch for bursts.
+ *
+ * A Pending holds one of the FDS_OP_QUEUE_SIZE operation slots until
+ * awaited. Destroying or reusing it waits for its operation first, the
+ * ...Async() functions then return the error of that operation instead of
+ * queueing the next one.
+ */
+class File::Pending {
+    friend class File;
+
+public:
+    using Callback = File::Callback;
+
+    Pending();
+    Pending(const Pending& other) = delete;
+    Pending& operator=(const Pending& other) = delete;
+    Pending(Pending&& other);
+    Pending& operator=(Pending&& other);
+    ~Pending();
+
+    Error::Code setCallback(Callback callback, void* context);
+    Error::Code await(RTOS::milliseconds timeout = RTOS::Infinity);
+    bool        isQueued() const;
+    bool        isDone();
+    uint32_t    getRecordId() const;
+
+private:
+    HeapChunk*  chunk; /**< operation in flight, nullptr once awaited */
+    uint32_t    recordId; /**< record written by the last operation */
+    Callback    callback; /**< handed to the next operation */
+    void*       context; /**< passed to callback */
+};
+
+/** handle of a queued flash operation */
+using Pending = File::Pending;
+
 /**
  * @brief contains begin and end iterator for a search.
  * 
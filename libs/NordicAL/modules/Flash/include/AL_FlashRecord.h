@@ -47,11 +47,24 @@ namespace IO::Flash
  */
 template<class T>
 class Record : Patterns::Observable<T> {
+    // payload only, the name in front of it is only known at runtime and
+    // trySet() returns TooLarge if both do not fit
+    static_assert(sizeof(T) <= File::kMaxRecordBytes,
+                  "payload alone does not fit into a flash record");
+
     // delete default constructors
     Record()                    = delete;
     Record(const Record& other) = delete;
     Record& operator=(const Record& other) = delete;
 
+    // cached records use the identifier
+    template<class U>
+    friend class CachedRecord;
+
+    // deferred records queue their writes
+    template<class U>
+    friend class DeferredRecord;
+
 public:
     constexpr Record(const char* const identifier, File& file);
 
@@ -67,6 +80,10 @@ private:
     constexpr size_t   lengthBytes();
     Error::Code        tryOpen(fds_record_desc_t&  descriptor,
                                fds_flash_record_t& record);
+    Error::Code        trySetAsync(const T&           value,
+                                   Pending&           pending,
+                                   RTOS::milliseconds timeout = RTOS::Infinity);
+    bool dropCached(RTOS::milliseconds timeout = RTOS::Infinity);
 };
 }  // namespace IO::Flash
 
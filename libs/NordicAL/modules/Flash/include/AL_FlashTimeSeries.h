@@ -0,0 +1,204 @@
+/**
+ * @file AL_FlashTimeSeries.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compressed log of time stamped samples in flash
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __AL_FLASHTIMESERIES_H__
+#define __AL_FLASHTIMESERIES_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace IO::Flash
+{
+template<class T, size_t kMaxPages>
+class TimeSeries;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashFile.h"
+#include "FlashSamplePage.h"
+#include "FlashUtility.h"
+#include "fds.h"
+
+#include <AL_Mutex.h>
+#include <Error.h>
+#include <StaticVector.h>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief String identified log of time stamped samples, oldest samples are
+ * dropped first.
+ *
+ * @details Samples are packed into pages of up to kMaxRecordBytes, one FDS
+ * record each, see SamplePage for the encoding. A Collection spends a
+ * record header and padding on every element, a page holds about fifty
+ * samples taken at a fixed rate.
+ *
+ * The page being filled stays in RAM and is written once the next sample
+ * does not fit or on flush(). Once kMaxPages are in flash, the oldest page
+ * is deleted for a new one. Start times of the pages are indexed in RAM,
+ * so range() only reads the pages it needs.
+ *
+ * @warning Samples not yet flushed are lost on a reset. Writing a page
+ * blocks until done.
+ *
+ * @warning Times have to come from a clock that keeps counting across
+ * resets, e.g. unix time from an RTC. The newest time in flash is restored
+ * after a reset and older samples are rejected, with an uptime clock
+ * append() fails until the uptime passes it. clear() the series when the
+ * time base is reset.
+ *
+ * @example Log temperatures in centi degree and print the last hour:
+ * ```cpp
+ * IO::Flash::TimeSeries<int16_t, 64> temperatures {"temperature"};
+ * CHECK_ERROR(temperatures.append(now, 2150));
+ * for (auto sample : temperatures.range(now - 3600, now)) {
+ *     LOG_I("%u: %d", sample.time, sample.value);
+ * }
+ * ```
+ *
+ * @tparam T integral value type, at most 32 bit. Store fixed point values.
+ * @tparam kMaxPages pages kept in flash, each up to kMaxRecordBytes
+ */
+template<class T, size_t kMaxPages>
+class TimeSeries : public File {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= sizeof(int32_t),
+                  "samples are encoded as integer differences");
+
+    // delete default constructors
+    TimeSeries()                        = delete;
+    TimeSeries(const TimeSeries& other) = delete;
+    TimeSeries& operator=(const TimeSeries& other) = delete;
+
+public:
+    /**
+     * @brief One entry of the log.
+     *
+     */
+    struct Sample {
+        uint32_t time; /**< time stamp, any unit, never decreasing */
+        T        value; /**< measured value */
+    };
+
+    class Iterator;
+    class Range;
+    friend class Iterator;
+
+    TimeSeries(const char* const name);
+
+    Error::Code append(uint32_t time, const T& value);
+    Error::Code flush();
+    Error::Code clear();
+    Range       range(uint32_t from, uint32_t to);
+    Range       all();
+    size_t      getPageCount();
+
+private:
+    /**
+     * @brief RAM index entry of a page in flash.
+     *
+     */
+    struct PageInfo {
+        uint32_t startTime; /**< time of the first sample */
+        uint32_t recordId; /**< FDS record id, increases with every write */
+    };
+
+    /** record key of all pages */
+    static constexpr uint16_t kRecordKeyPage = Utility::kRecordKeyMin;
+    /** record id standing for the page in RAM, after all written ones */
+    static constexpr uint32_t kRecordIdOpen = UINT32_MAX;
+
+    Collections::StaticVector<PageInfo, kMaxPages>
+                pages; /**< pages in flash, oldest first */
+    SamplePage  openPage; /**< samples not written yet */
+    uint32_t    lastTime; /**< newest time known, appends must not be older */
+    bool        isIndexed; /**< whether pages was built from flash */
+    RTOS::Mutex mutex; /**< guards all of the above */
+
+    Error::Code buildIndex();
+    Error::Code writePage();
+    Error::Code dropOldest();
+    Error::Code loadPageAfter(uint32_t& recordId, SamplePage& page);
+    uint32_t    getRecordIdBefore(uint32_t time);
+
+    static Error::Code readPage(uint32_t recordId, SamplePage& page);
+};
+
+/**
+ * @brief Iterates the samples of a TimeSeries within a time range.
+ *
+ * @details Holds a copy of one page, so the TimeSeries is not locked while
+ * iterating and can be appended to. Pages dropped in the meantime are
+ * skipped.
+ */
+template<class T, size_t kMaxPages>
+class TimeSeries<T, kMaxPages>::Iterator
+        : public std::iterator<std::forward_iterator_tag,
+                               Sample,
+                               std::ptrdiff_t,
+                               Sample> {
+public:
+    Iterator();
+    Iterator(TimeSeries& series, uint32_t from, uint32_t to);
+
+    bool      operator==(const Iterator& other);
+    bool      operator!=(const Iterator& other);
+    Sample    operator*() const;
+    Iterator& operator++();
+
+private:
+    TimeSeries*        series; /**< iterated series, nullptr when end element */
+    uint32_t           from; /**< first time included */
+    uint32_t           to; /**< last time included */
+    uint32_t           recordId; /**< record id of page */
+    SamplePage         page; /**< copy of the current page */
+    SamplePage::Cursor cursor; /**< position in page */
+    Sample             current; /**< sample returned by operator* */
+
+    void next();
+};
+
+/**
+ * @brief begin and end iterator of a time range.
+ *
+ */
+template<class T, size_t kMaxPages>
+class TimeSeries<T, kMaxPages>::Range {
+    // delete default constructors
+    Range() = delete;
+
+public:
+    Range(TimeSeries& series, uint32_t from, uint32_t to);
+
+    Iterator begin();
+    Iterator end();
+
+private:
+    TimeSeries& series;
+    uint32_t    from;
+    uint32_t    to;
+};
+}  // namespace IO::Flash
+
+// templates need to include src here
+#include "../src/AL_FlashTimeSeries.cpp"
+#include "../src/AL_FlashTimeSeriesIterator.cpp"
+#endif  //__AL_FLASHTIMESERIES_H__
@@ -0,0 +1,119 @@
+/**
+ * @file FlashDirectory.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RAM index of the files stored in flash
+ * @version 1.0
+ * @date 2020-11-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHDIRECTORY_H__
+#define __FLASHDIRECTORY_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+class Directory;
+}
+
+namespace Test::IOFlash
+{
+class Directory;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Mutex.h>
+#include <AL_RTOS.h>
+#include <Error.h>
+#include <StaticMap.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Maps file names to FDS file ids without searching flash.
+ *
+ * @details Flash is scanned once on Utility::init(), every file descriptor
+ * record is entered by the hash of its name and every used file id is
+ * marked in a bitmap. File keeps both up to date on create() and clear(),
+ * so resolving a name and finding a free id for a new file no longer
+ * iterate all records.
+ *
+ * The directory only answers what it knows for sure. Once more than
+ * kMaxFiles files exist or two names share a hash, names missing from the
+ * table are looked up in flash again. Ids from kTrackedIds upwards are not
+ * in the bitmap and probed in flash like before.
+ *
+ * @warning only to be used from within flash library
+ */
+class Directory {
+    // allow internal classes to use the directory
+    friend class File;
+    friend class Utility;
+    // white box test
+    friend class ::Test::IOFlash::Directory;
+
+    // delete default constructors
+    Directory()                       = delete;
+    Directory(const Directory& other) = delete;
+    Directory& operator=(const Directory& other) = delete;
+
+public:
+    /** files that can be indexed */
+    static constexpr size_t kMaxFiles = 32;
+    /** file ids [0 .. kTrackedIds) are tracked in the bitmap */
+    static constexpr uint16_t kTrackedIds = 256;
+
+private:
+    /**
+     * @brief How far the directory can be trusted.
+     *
+     */
+    enum class State {
+        Unknown, /**< flash not scanned yet */
+        Complete, /**< every file in flash is in the table */
+        Partial /**< some files did not fit, NotFound has to be checked */
+    };
+
+    /**
+     * @brief location of a file in flash.
+     *
+     */
+    struct Entry {
+        uint16_t fileId; /**< FDS file id */
+        uint32_t descriptorId; /**< FDS record id of the file descriptor */
+    };
+
+    using Table = Collections::StaticMap<uint32_t, Entry, kMaxFiles>;
+
+    static void        init();
+    static Error::Code find(const char*        name,
+                            uint16_t&          fileId,
+                            RTOS::milliseconds timeout = RTOS::Infinity);
+    static Error::Code allocateId(uint16_t& fileId);
+    static void        releaseId(uint16_t fileId);
+    static void add(const char* name, uint16_t fileId, uint32_t descriptorId);
+    static void remove(uint16_t fileId);
+
+    static Error::Code build();
+    static bool        isUsed(uint16_t fileId);
+    static void        markUsed(uint16_t fileId, bool used);
+    static uint32_t    getHash(const char* name);
+
+    static RTOS::Mutex& getMutex();
+    static Table&       getTable();
+
+    static State   state; /**< whether flash was scanned */
+    static uint8_t usedIds[kTrackedIds / 8]; /**< bit set per used file id */
+};
+}  // namespace IO::Flash
+#endif  //__FLASHDIRECTORY_H__
@@ -0,0 +1,128 @@
+/**
+ * @file FlashRecordCache.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RAM cache of record values for IO::Flash::CachedRecord
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHRECORDCACHE_H__
+#define __FLASHRECORDCACHE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+class RecordCache;
+class File;
+}  // namespace IO::Flash
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Mutex.h>
+#include <AL_RTOS.h>
+#include <Error.h>
+#include <HashTable.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Bounded RAM copy of record values, shared by all CachedRecords.
+ *
+ * @details Values are identified by file, record key and name, the same
+ * way Record finds them in flash. Once all slots are taken, the value used
+ * least recently is evicted and read from flash again on its next use.
+ *
+ * Every write through Record drops the cached copy once flash is written
+ * and clearing a file drops all of its values. Each drop advances a
+ * generation, values read or written by CachedRecord are only stored if
+ * no drop happened in the meantime. So a cached copy is never older than
+ * flash as long as flash is only written through this library.
+ *
+ * @warning A DeferredRecord flushing without waiting drops the copy on a
+ * later collect() if the cache was busy, until then the old value is
+ * served.
+ */
+class RecordCache {
+    // allow internal classes to use the cache
+    template<class T>
+    friend class Record;
+
+    template<class T>
+    friend class CachedRecord;
+
+    friend class File;
+
+    // delete default constructors
+    RecordCache()                         = delete;
+    RecordCache(const RecordCache& other) = delete;
+    RecordCache& operator=(const RecordCache& other) = delete;
+
+public:
+    /** values held in RAM at the same time */
+    static constexpr size_t kSlots = 8;
+    /** largest value that can be cached */
+    static constexpr size_t kMaxValueBytes = 32;
+
+    static uint32_t getHits();
+    static uint32_t getMisses();
+    static uint32_t getEvictions();
+
+private:
+    /**
+     * @brief identifies a value, name is compared by content.
+     *
+     */
+    struct Key {
+        const File* file; /**< file the record is stored in */
+        uint16_t    recordKey; /**< hashed record key of name */
+        const char* name; /**< string identifier of the record */
+
+        bool operator==(const Key& other) const;
+    };
+
+    struct KeyHash {
+        uint32_t operator()(const Key& key) const;
+    };
+
+    /**
+     * @brief copy of a value as written to flash.
+     *
+     */
+    struct Value {
+        uint8_t size; /**< bytes used in data */
+        alignas(uint32_t) uint8_t data[kMaxValueBytes]; /**< the value */
+
+        Value(const void* value, size_t size);
+    };
+
+    using Table = Collections::HashTable<Key, Value, kSlots, KeyHash>;
+
+    static bool     load(const Key& key, void* value, size_t size);
+    static void     store(const Key& key,
+                          const void* value,
+                          size_t      size,
+                          uint32_t    generation);
+    static uint32_t getGeneration();
+    static bool erase(const Key&         key,
+                      RTOS::milliseconds timeout = RTOS::Infinity);
+    static void eraseFile(const File& file);
+
+    static RTOS::Mutex& getMutex();
+    static Table&       getTable();
+
+    static uint32_t hits; /**< load() served from RAM */
+    static uint32_t misses; /**< load() that had to read flash */
+    static uint32_t generation; /**< advanced by every drop */
+};
+}  // namespace IO::Flash
+#endif  //__FLASHRECORDCACHE_H__
@@ -0,0 +1,110 @@
+/**
+ * @file FlashSamplePage.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compressed page of time stamped samples
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHSAMPLEPAGE_H__
+#define __FLASHSAMPLEPAGE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace IO::Flash
+{
+class SamplePage;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashFile.h"
+
+#include <Error.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace IO::Flash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Up to one flash record of samples, encoded as varints.
+ *
+ * @details The first sample stores its value, every following one the
+ * change of the time step and the change of the value, both zigzag
+ * encoded. Samples taken at a fixed rate with slowly changing values need
+ * two bytes each.
+ *
+ * Layout in flash: Header, followed by Header::lenBytes of samples.
+ *
+ * @warning Only used by TimeSeries.
+ */
+class SamplePage {
+public:
+    /** largest encoded page, header included */
+    static constexpr size_t kMaxBytes = File::kMaxRecordBytes;
+
+    /**
+     * @brief Read position inside a page.
+     *
+     */
+    struct Cursor {
+        size_t   offset; /**< next byte to decode */
+        uint16_t index; /**< samples read so far */
+        uint32_t time; /**< time of the last sample read */
+        int64_t  delta; /**< time step to the last sample read */
+        int64_t  value; /**< value of the last sample read */
+
+        Cursor();
+    };
+
+    SamplePage();
+
+    void        clear();
+    bool        add(uint32_t time, int64_t value);
+    bool        read(Cursor& cursor, uint32_t& time, int64_t& value) const;
+    Error::Code load(const void* data, size_t lenBytes);
+    void        store(uint8_t* data) const;
+
+    bool     isEmpty() const;
+    uint16_t getCount() const;
+    uint32_t getStartTime() const;
+    uint32_t getLastTime() const;
+    size_t   getLenBytes() const;
+
+private:
+    /**
+     * @brief Stored in front of the samples.
+     *
+     */
+    struct Header {
+        uint32_t startTime; /**< time of the first sample */
+        uint16_t count; /**< number of samples */
+        uint16_t lenBytes; /**< bytes of samples following the header */
+    };
+
+    static constexpr size_t kMaxPayloadBytes = kMaxBytes - sizeof(Header);
+    /** varint of a 64 bit zigzag value */
+    static constexpr size_t kMaxVarintBytes = 10;
+
+    Header   header; /**< kept in RAM the same way it is written */
+    uint8_t  payload[kMaxPayloadBytes]; /**< encoded samples */
+    uint32_t lastTime; /**< time of the last sample added */
+    int64_t  lastDelta; /**< time step to the last sample added */
+    int64_t  lastValue; /**< value of the last sample added */
+
+    static uint64_t zigzag(int64_t value);
+    static int64_t  unzigzag(uint64_t value);
+    static size_t   putVarint(uint64_t value, uint8_t* data);
+    static size_t   getVarint(const uint8_t* data,
+                              size_t         lenBytes,
+                              uint64_t&      value);
+};
+}  // namespace IO::Flash
+#endif  //__FLASHSAMPLEPAGE_H__
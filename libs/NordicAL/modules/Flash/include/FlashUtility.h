@@ -48,7 +48,11 @@ class Utility {
     template<class T>
     friend class Collection;
 
+    template<class T, size_t kMaxPages>
+    friend class TimeSeries;
+
     friend class File;
+    friend class Directory;
 
     // delete default constructors
     Utility()                     = delete;
@@ -0,0 +1,81 @@
+/**
+ * @file AL_FlashBatch.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief queues several flash operations and waits for them at once
+ * @version 1.0
+ * @date 2020-11-21
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashBatch.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+IO::Flash::Batch::Batch() : pendings(), nextIndex(0), firstError(Error::None)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Pending for the next operation.
+ *
+ * @details Waits for the oldest operation if kDepth are in flight. FDS
+ * works through its queue in order, so that one finishes first anyway.
+ *
+ * @return Pending& Pass to one of the asynchronous flash functions.
+ */
+IO::Flash::Pending& IO::Flash::Batch::next()
+{
+    auto& pending = pendings[nextIndex];
+    nextIndex     = (nextIndex + 1) % kDepth;
+    collect(pending);
+    return pending;
+}
+
+/**
+ * @brief Wait for all operations handed out by next().
+ *
+ * @return Error::Code First error of those operations, the batch can be
+ * used again afterwards.
+ */
+Error::Code IO::Flash::Batch::await()
+{
+    // oldest first
+    for (size_t i = 0; i < kDepth; i++) {
+        collect(pendings[(nextIndex + i) % kDepth]);
+    }
+
+    auto result = firstError;
+    firstError  = Error::None;
+    return result;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Wait for pending and remember its error.
+ *
+ */
+void IO::Flash::Batch::collect(Pending& pending)
+{
+    if (!pending.isQueued()) {
+        // result was collected before
+        return;
+    }
+    auto result = pending.await();
+    if (firstError == Error::None) {
+        firstError = result;
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
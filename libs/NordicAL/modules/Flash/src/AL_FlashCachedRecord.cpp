@@ -0,0 +1,82 @@
+/**
+ * @file AL_FlashCachedRecord.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief record in flash with a write through copy in RAM
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashCachedRecord.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTORS ---------------------------------
+
+/**
+ * @brief Create a new cached record instance.
+ *
+ * @details Neither reads nor writes flash, the first tryGet() does.
+ *
+ * @param identifier String identifier, same as for Record.
+ * @param file File to store the record in.
+ */
+template<class T>
+IO::Flash::CachedRecord<T>::CachedRecord(const char* const identifier,
+                                         File&             file)
+        : record(identifier, file),
+          key {&file, record.getRecordIndex(), identifier}
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the value, from RAM if cached.
+ *
+ * @param value Variable to write the value to.
+ * @return Error::Code only on a miss, see Record::tryGet().
+ */
+template<class T>
+Error::Code IO::Flash::CachedRecord<T>::tryGet(T& value)
+{
+    if (RecordCache::load(key, &value, sizeof(T))) {
+        return Error::None;
+    }
+
+    // a write finishing while flash is read would be cached over otherwise
+    auto generation = RecordCache::getGeneration();
+    RETURN_ON_ERROR(record.tryGet(value));
+    RecordCache::store(key, &value, sizeof(T), generation);
+    return Error::None;
+}
+
+/**
+ * @brief Write the value to flash and the cache.
+ *
+ * @warning Will block until done. Refer to Record.
+ *
+ * @param value Value to set.
+ * @return Error::Code see Record::trySet(), the cache is left empty then.
+ */
+template<class T>
+Error::Code IO::Flash::CachedRecord<T>::trySet(const T& value)
+{
+    // trySet() drops the copy once, any other drop in between might be a
+    // write that finished after this one
+    auto generation = RecordCache::getGeneration();
+    RETURN_ON_ERROR(record.trySet(value));
+    RecordCache::store(key, &value, sizeof(T), generation + 1);
+    return Error::None;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -49,13 +49,43 @@ IO::Flash::Collection<T>::Collection(const char* const name) : File(name)
 template<class T>
 Error::Code IO::Flash::Collection<T>::add(const T& element)
 {
-    std::unique_ptr<uint8_t[]> data {new uint8_t[sizeof(T)]};
+    static_assert(sizeof(T) <= kMaxRecordBytes,
+                  "element type too large for a flash record");
+
+    Buffer data {};
+    RETURN_ON_ERROR(allocBuffer(data, sizeof(T)));
     memcpy(data.get(), reinterpret_cast<const uint8_t*>(&element), sizeof(T));
     return createRecord(Utility::getHashedIndex<T>(element),
                         std::move(data),
                         sizeof(T));
 }
 
+/**
+ * @brief Queue adding a new element, without waiting for flash.
+ * 
+ * @details Use with a Batch to write many elements in a row.
+ * 
+ * @tparam T Type of the elements of the collection
+ * @param element Value of the element to add
+ * @param pending Set to the queued write.
+ * @return Error::Code Result of queueing, the write result is reported by
+ * pending.
+ */
+template<class T>
+Error::Code IO::Flash::Collection<T>::add(const T& element, Pending& pending)
+{
+    static_assert(sizeof(T) <= kMaxRecordBytes,
+                  "element type too large for a flash record");
+
+    Buffer data {};
+    RETURN_ON_ERROR(allocBuffer(data, sizeof(T)));
+    memcpy(data.get(), reinterpret_cast<const uint8_t*>(&element), sizeof(T));
+    return createRecordAsync(Utility::getHashedIndex<T>(element),
+                             std::move(data),
+                             sizeof(T),
+                             pending);
+}
+
 /**
  * @brief Tries to delete element with given value.
  * 
@@ -0,0 +1,251 @@
+/**
+ * @file AL_FlashDeferredRecord.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief flash record that holds back frequent writes in RAM
+ * @version 1.0
+ * @date 2020-11-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashDeferredRecord.h"
+
+#include <ScopeExit.h>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Create a new deferred record, nothing is read or written yet.
+ *
+ * @param identifier String identifier of the record, same as for Record.
+ * @param file File to store the record in.
+ * @param window Minimum time between flash writes of a changing value.
+ * @param maxUpdates Most values held back before writing, at least 1.
+ */
+template<class T>
+IO::Flash::DeferredRecord<T>::DeferredRecord(const char* const  identifier,
+                                             File&              file,
+                                             RTOS::milliseconds window,
+                                             size_t             maxUpdates)
+        : record(identifier, file), window(window), maxUpdates(maxUpdates),
+          value(), known(false), dirty(false), isCacheStale(false), updates(0),
+          firstUpdate(0), pending(), mutex()
+{}
+
+/**
+ * @brief Waits for a queued write, a held back value is lost.
+ *
+ */
+template<class T>
+IO::Flash::DeferredRecord<T>::~DeferredRecord()
+{
+    collect(RTOS::Infinity);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the latest value, also if it is still held back.
+ *
+ * @param value Variable to write the value to.
+ * @return Error::Code Might not find the record in flash.
+ */
+template<class T>
+Error::Code IO::Flash::DeferredRecord<T>::tryGet(T& value)
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    if (!known) {
+        RETURN_ON_ERROR(record.tryGet(this->value));
+        known = true;
+    }
+    value = this->value;
+    return Error::None;
+}
+
+/**
+ * @brief Set the value, written to flash once due.
+ *
+ * @details Blocks only if the value is written, see class doc.
+ *
+ * @param value New value.
+ * @return Error::Code Error of writing, None if held back.
+ */
+template<class T>
+Error::Code IO::Flash::DeferredRecord<T>::trySet(const T& value)
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    if (!known && record.tryGet(this->value) == Error::None) {
+        // compare against flash for the first value
+        known = true;
+    }
+    if (known && isSame(value)) {
+        writesAvoided++;
+        return Error::None;
+    }
+
+    auto now = RTOS::getTime();
+    if (dirty) {
+        // held back value never reaches flash
+        writesAvoided++;
+    } else {
+        dirty       = true;
+        updates     = 0;
+        firstUpdate = now;
+    }
+    this->value = value;
+    known       = true;
+    updates++;
+
+    if (updates >= maxUpdates || now - firstUpdate >= window) {
+        return write();
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Whether a value is held back in RAM.
+ *
+ */
+template<class T>
+bool IO::Flash::DeferredRecord<T>::isDirty() const
+{
+    return dirty;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Write a held back value now.
+ *
+ * @warning Will block until done.
+ *
+ * @return Error::Code Error of writing.
+ */
+template<class T>
+Error::Code IO::Flash::DeferredRecord<T>::flush()
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    return write();
+}
+
+/**
+ * @brief Queue a held back value, for callers that must not wait for
+ * flash.
+ *
+ * @details Never blocks. If the file has to be created, a corrupted record
+ * deleted or flash garbage collected first, the flush task is asked to
+ * write the value instead.
+ *
+ * @return true once the value is in flash.
+ */
+template<class T>
+bool IO::Flash::DeferredRecord<T>::tryFlush()
+{
+    if (mutex.tryObtain(0) != Error::None) {
+        // owner is busy with it, try again later
+        return false;
+    }
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    if (!collect(0)) {
+        return false;
+    }
+    if (!dirty) {
+        return true;
+    }
+
+    auto result = record.trySetAsync(value, pending, 0);
+    if (result == Error::None) {
+        dirty = false;
+        writes++;
+    } else if (result == Error::Busy) {
+        // needs to wait for flash
+        requestFlush();
+    }
+    return false;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Write the held back value, caller holds the mutex.
+ *
+ */
+template<class T>
+Error::Code IO::Flash::DeferredRecord<T>::write()
+{
+    collect(RTOS::Infinity);
+    if (!dirty) {
+        return Error::None;
+    }
+
+    RETURN_ON_ERROR(record.trySet(value));
+    dirty = false;
+    writes++;
+    return Error::None;
+}
+
+/**
+ * @brief Finish the write queued by tryFlush().
+ *
+ * @details A failed write marks the value dirty again. Copies of
+ * CachedRecords are dropped once flash is written, on a later call if the
+ * cache was busy.
+ *
+ * @param timeout 0 to return false instead of waiting for flash or the
+ * cache, Infinity to wait.
+ * @return true nothing is queued anymore.
+ */
+template<class T>
+bool IO::Flash::DeferredRecord<T>::collect(RTOS::milliseconds timeout)
+{
+    if (pending.isQueued()) {
+        if (timeout != RTOS::Infinity && !pending.isDone()) {
+            return false;
+        }
+        auto result  = pending.await();
+        isCacheStale = true;
+        if (result != Error::None) {
+            dirty = true;
+            writes--;
+        }
+    }
+
+    if (isCacheStale) {
+        if (!record.dropCached(timeout)) {
+            return false;
+        }
+        isCacheStale = false;
+    }
+    return true;
+}
+
+/**
+ * @brief Whether other has the same bytes as the latest value.
+ *
+ */
+template<class T>
+bool IO::Flash::DeferredRecord<T>::isSame(const T& other) const
+{
+    return std::memcmp(&value, &other, sizeof(T)) == 0;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,203 @@
+/**
+ * @file AL_FlashDeferredRecordBase.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief registry of all flash records that hold back writes
+ * @version 1.0
+ * @date 2020-11-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashDeferredRecord.h"
+
+#include "AL_Log.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+std::atomic<uint32_t> IO::Flash::DeferredRecordBase::writesAvoided {0};
+std::atomic<uint32_t> IO::Flash::DeferredRecordBase::writes {0};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Link into the registry.
+ *
+ * @details The first record creates the flush task.
+ */
+IO::Flash::DeferredRecordBase::DeferredRecordBase() : next(getFirst())
+{
+    getFirst() = this;
+    getFlusher();
+}
+
+/**
+ * @brief Unlink from the registry.
+ *
+ */
+IO::Flash::DeferredRecordBase::~DeferredRecordBase()
+{
+    for (auto link = &getFirst(); *link != nullptr; link = &(*link)->next) {
+        if (*link == this) {
+            *link = next;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Create the flush task, waiting for requests.
+ *
+ */
+IO::Flash::DeferredRecordBase::Flusher::Flusher()
+        : events(), requested(events), task(*this, "flashFlusher", 1)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Write the held back values of all DeferredRecords.
+ *
+ * @warning Will block until done. Call from a task, e.g. before sleeping
+ * or once the battery gets low.
+ *
+ * @return Error::Code First error of writing, all records are tried.
+ */
+Error::Code IO::Flash::DeferredRecordBase::flushAll()
+{
+    Error::Code result = Error::None;
+    for (auto record = getFirst(); record != nullptr; record = record->next) {
+        auto recordResult = record->flush();
+        if (result == Error::None) {
+            result = recordResult;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Queue the held back values of all DeferredRecords without waiting
+ * for flash.
+ *
+ * @details For handlers that get called again until they agree, like the
+ * shutdown handlers of nrf_pwr_mgmt. Those run in the context delivering
+ * flash events, so they must not wait for a write to finish. Values that
+ * need flash to be waited for, e.g. to create their file, are left to the
+ * flush task.
+ *
+ * @return true once all values are written.
+ */
+bool IO::Flash::DeferredRecordBase::tryFlushAll()
+{
+    if (getFlusher().isRequested()) {
+        // flushAll() did not start yet
+        return false;
+    }
+
+    bool done = true;
+    for (auto record = getFirst(); record != nullptr; record = record->next) {
+        // queue all of them, even if one is still busy
+        done = record->tryFlush() && done;
+    }
+    return done;
+}
+
+/**
+ * @brief Values that did not need to be written, because they were equal
+ * or got replaced while held back.
+ *
+ */
+uint32_t IO::Flash::DeferredRecordBase::getWritesAvoided()
+{
+    return writesAvoided;
+}
+
+/**
+ * @brief Values written to flash.
+ *
+ */
+uint32_t IO::Flash::DeferredRecordBase::getWrites()
+{
+    return writes;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Have the flush task run flushAll().
+ *
+ */
+void IO::Flash::DeferredRecordBase::requestFlush()
+{
+    getFlusher().request();
+}
+
+/**
+ * @brief Wake the flush task.
+ *
+ */
+void IO::Flash::DeferredRecordBase::Flusher::request()
+{
+    requested.trigger();
+}
+
+/**
+ * @brief Whether a request waits for the flush task.
+ *
+ */
+bool IO::Flash::DeferredRecordBase::Flusher::isRequested()
+{
+    return requested.wasTriggered();
+}
+
+void IO::Flash::DeferredRecordBase::Flusher::onStart() {}
+
+/**
+ * @brief Wait for a request, then write all held back values.
+ *
+ * @details Records locked by tryFlushAll() meanwhile are written once the
+ * request is repeated.
+ */
+void IO::Flash::DeferredRecordBase::Flusher::onRun()
+{
+    CHECK_ERROR(requested.await(RTOS::Infinity));
+    requested.reset();
+
+    auto result = flushAll();
+    if (result != Error::None) {
+        LOG_E("flushing deferred records failed: %u", result);
+    }
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief First record of the registry.
+ *
+ * @details Lazy loading for proper order of initialization.
+ *
+ */
+IO::Flash::DeferredRecordBase*& IO::Flash::DeferredRecordBase::getFirst()
+{
+    static DeferredRecordBase* first = nullptr;
+    return first;
+}
+
+/**
+ * @brief Task writing values tryFlushAll() must not wait for.
+ *
+ * @details Lazy loading for proper order of initialization.
+ *
+ */
+IO::Flash::DeferredRecordBase::Flusher&
+    IO::Flash::DeferredRecordBase::getFlusher()
+{
+    static Flusher flusher {};
+    return flusher;
+}
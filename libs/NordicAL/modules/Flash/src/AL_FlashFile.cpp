@@ -13,12 +13,19 @@
 
 #include "AL_FlashFile.h"
 
+#include "FlashDirectory.h"
+#include "FlashRecordCache.h"
 #include "FlashUtility.h"
 #include "PortUtility.h"
 #include "FunctionScopeTimer.h"
 
+#include <atomic>
+
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
+/** sequence of the next operation handed to FDS */
+static std::atomic<uint32_t> nextSequence {0};
+
 //-------------------------------- CONSTANTS ----------------------------------
 
 //------------------------------ CONSTRUCTOR ----------------------------------
@@ -42,7 +49,9 @@ IO::Flash::File::HeapChunk::HeapChunk()
         : result(Error::Unknown), onFinish(getFinishEvents()),
           isFree(getFreeEvents()), operation(AsyncOperation::None), recordId(0),
           fileId(Utility::kFileIdInvalid),
-          recordKey(Utility::kRecordKeyReserved)
+          recordKey(Utility::kRecordKeyReserved),
+          heapPtr(nullptr, {&getBufferPool()}), sequence(0), callback(nullptr),
+          context(nullptr)
 {
     // make this heap chunk available
     isFree.trigger();
@@ -79,6 +88,10 @@ Error::Code IO::Flash::File::clear()
     HeapChunk* chunk {nullptr};
     RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::DeleteFile));
 
+    // cached values of the file are gone too, even if deleting failed midway
+    auto cacheDropper =
+        Patterns::make_scopeExit([this]() { RecordCache::eraseFile(*this); });
+
     // call clean on the heapchunk when this function returns
     auto stackGuard = Patterns::make_scopeExit([chunk]() { chunk->free(); });
     chunk->fileId   = fileId;
@@ -89,6 +102,9 @@ Error::Code IO::Flash::File::clear()
         return chunk->result;
     }
 
+    // the id is free for new files now
+    Directory::remove(fileId);
+    lastKnownFileId = Utility::kFileIdInvalid;
     return Error::None;
 }
 
@@ -105,21 +121,99 @@ Error::Code IO::Flash::File::clear()
  * @param recordKey Record key to create the new record with
  * @param buffer Buffered array to write
  * @param lenBytes Length of the buffer in bytes
+ * @param recordId Optional output for the FDS record id of the new record
  * 
  * @return Error::Code Might fail because of invalid parameters timeout.
  */
 Error::Code
-    IO::Flash::File::createRecord(uint16_t                         recordKey,
-                                  std::unique_ptr<const uint8_t[]> buffer,
-                                  size_t                           lenBytes)
+    IO::Flash::File::createRecord(uint16_t  recordKey,
+                                  Buffer    buffer,
+                                  size_t    lenBytes,
+                                  uint32_t* recordId)
 {
-    fds_record_desc_t descriptor = {0};
+    Pending pending {};
+    RETURN_ON_ERROR(
+        createRecordAsync(recordKey, std::move(buffer), lenBytes, pending));
+    RETURN_ON_ERROR(pending.await());
+    if (recordId != nullptr) {
+        *recordId = pending.getRecordId();
+    }
+    return Error::None;
+}
 
-    auto lenWords = (lenBytes + Utility::kWordSize - 1) / Utility::kWordSize;
+/**
+ * @brief Tries to update an existing record.
+ * 
+ * @warning Will block until done.
+ * Timeout can not be implemented due to underlying library.
+ * 
+ * @param descriptor Descriptor to existing record that shall be updated
+ * @param newRecordKey New recordKey to use
+ * @param buffer Buffer with the new data to use
+ * @param lenBytes Length of the buffer
+ * @return Error::Code Might time out or invalid parameters
+ */
+Error::Code
+    IO::Flash::File::updateRecord(fds_record_desc_t& descriptor,
+                                  uint16_t           newRecordKey,
+                                  Buffer             buffer,
+                                  size_t             lenBytes)
+{
+    Pending pending {};
+    RETURN_ON_ERROR(updateRecordAsync(
+        descriptor, newRecordKey, std::move(buffer), lenBytes, pending));
+    return pending.await();
+}
+
+/**
+ * @brief Removes the record with the given descriptor.
+ * 
+ * @warning Will block until done.
+ * Timeout can not be implemented due to underlying library.
+ * 
+ * @param descriptor Descriptor to existing FileRecord
+ * @return Error::Code Might timeout or invalid parameters
+ */
+Error::Code IO::Flash::File::removeRecord(fds_record_desc_t& descriptor)
+{
+    Pending pending {};
+    RETURN_ON_ERROR(removeRecordAsync(descriptor, pending));
+    return pending.await();
+}
+
+/**
+ * @brief Queue creating a record, without waiting for flash.
+ * 
+ * @details Blocks only while all operation slots are taken, for creating
+ * the file and for garbage collection if flash is full. Given a timeout,
+ * it waits for a slot only and returns Busy instead of doing the rest.
+ *
+ * @param recordKey Record key to create the new record with
+ * @param buffer Buffered array to write, freed once written
+ * @param lenBytes Length of the buffer in bytes
+ * @param pending Set to the queued write, a previous operation of it is
+ * waited for first and its error returned.
+ * @param timeout Maximum time to wait for a free operation slot.
+ * 
+ * @return Error::Code Result of queueing, the write itself is reported by
+ * pending. Busy if the file or a garbage collection is needed first.
+ */
+Error::Code IO::Flash::File::createRecordAsync(uint16_t           recordKey,
+                                               Buffer             buffer,
+                                               const size_t       lenBytes,
+                                               Pending&           pending,
+                                               RTOS::milliseconds timeout)
+{
+    // an error of the previous operation would be lost otherwise
+    RETURN_ON_ERROR(pending.await());
 
     uint16_t fileId;
-    auto     result = getId(fileId);
+    auto     result = getId(fileId, timeout);
     if (result == Error::NotFound) {
+        if (timeout != RTOS::Infinity) {
+            // creating the file waits for flash
+            return Error::Busy;
+        }
         // file not yet existing, create
         RETURN_ON_ERROR(create());
         RETURN_ON_ERROR(getId(fileId));
@@ -130,68 +224,61 @@ Error::Code
 
     // get dynamicly allocated buffer
     HeapChunk* chunk {nullptr};
-    RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::Write));
+    RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::Write, timeout));
 
-    // call clean on the heapchunk when this function returns
-    auto stackGuard  = Patterns::make_scopeExit([chunk]() { chunk->free(); });
+    // give the chunk back unless the write is queued
+    auto stackGuard = Patterns::make_scopeExit([chunk]() { chunk->free(); });
+
+    // number and queue in one go, so sequences follow the FDS queue
+    if (getSubmitMutex().tryObtain(timeout) != Error::None) {
+        return Error::Busy;
+    }
+    auto submitReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getSubmitMutex());
+    chunk->submit(pending);
     chunk->heapPtr   = std::move(buffer);
     chunk->fileId    = fileId;
     chunk->recordKey = recordKey;
 
-    fds_record_t tmpRecord = {.file_id = fileId,
-                              .key     = recordKey,
-                              .data    = {.p_data       = chunk->heapPtr.get(),
-                                       .length_words = lenWords}};
-
-    chunk->onFinish.reset();
-    auto nordicResult = fds_record_write(&descriptor, &tmpRecord);
-    if (nordicResult != NRF_SUCCESS) {
-        if (nordicResult == FDS_ERR_NO_SPACE_IN_FLASH) {
-            // flash is full, try to call gc
-            bool recordsFreed = false;
-            RETURN_ON_ERROR(callGarbageCollection(recordsFreed));
-            if (recordsFreed) {
-                // if it fails now, there is nothing left to do, flash might be full
-                RETURN_ON_ERROR(::IO::Flash::Utility::getError(
-                    fds_record_write(&descriptor, &tmpRecord)));
-            } else {
-                // no records to free, flash is just full
-                return Error::OutOfResources;
-            }
-        } else {
-            return ::IO::Flash::Utility::getError(nordicResult);
-        }
-    }
-    // wait for write to finish
-    RETURN_ON_ERROR(chunk->onFinish.await(RTOS::Infinity));
+    fds_record_desc_t descriptor = {0};
+    RETURN_ON_ERROR(submitWrite(chunk, descriptor, lenBytes, timeout));
 
-    result = chunk->result;
-    return result;
+    stackGuard.deactivate();
+    pending.chunk = chunk;
+    return Error::None;
 }
 
 /**
- * @brief Tries to update an existing record.
+ * @brief Queue updating an existing record, without waiting for flash.
  * 
- * @warning Will block until done.
- * Timeout can not be implemented due to underlying library.
+ * @details Same as createRecordAsync(), the old record is deleted once the
+ * new one is written.
  * 
  * @param descriptor Descriptor to existing record that shall be updated
  * @param newRecordKey New recordKey to use
  * @param buffer Buffer with the new data to use
  * @param lenBytes Length of the buffer
- * @return Error::Code Might time out or invalid parameters
+ * @param pending Set to the queued update, see createRecordAsync().
+ * @param timeout Maximum time to wait for a free operation slot.
+ * @return Error::Code Result of queueing.
  */
-Error::Code
-    IO::Flash::File::updateRecord(fds_record_desc_t&               descriptor,
-                                  uint16_t                         newRecordKey,
-                                  std::unique_ptr<const uint8_t[]> buffer,
-                                  size_t                           lenBytes)
+Error::Code IO::Flash::File::updateRecordAsync(fds_record_desc_t& descriptor,
+                                               uint16_t           newRecordKey,
+                                               Buffer             buffer,
+                                               const size_t       lenBytes,
+                                               Pending&           pending,
+                                               RTOS::milliseconds timeout)
 {
-    auto lenWords = (lenBytes + Utility::kWordSize - 1) / Utility::kWordSize;
+    // an error of the previous operation would be lost otherwise
+    RETURN_ON_ERROR(pending.await());
 
     uint16_t fileId;
-    auto     result = getId(fileId);
+    auto     result = getId(fileId, timeout);
     if (result == Error::NotFound) {
+        if (timeout != RTOS::Infinity) {
+            // creating the file waits for flash
+            return Error::Busy;
+        }
         // file not yet existing, create
         RETURN_ON_ERROR(create());
         RETURN_ON_ERROR(getId(fileId));
@@ -201,9 +288,17 @@ Error::Code
 
     // get dynamicly allocated buffer
     HeapChunk* chunk {nullptr};
-    RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::Update));
-    // call clean when this function returns
+    RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::Update, timeout));
+    // give the chunk back unless the update is queued
     auto stackGuard = Patterns::make_scopeExit([chunk]() { chunk->free(); });
+
+    // number and queue in one go, so sequences follow the FDS queue
+    if (getSubmitMutex().tryObtain(timeout) != Error::None) {
+        return Error::Busy;
+    }
+    auto submitReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getSubmitMutex());
+    chunk->submit(pending);
     uint32_t oldRecordId;
     RETURN_ON_ERROR(::IO::Flash::Utility::getError(
         fds_record_id_from_desc(&descriptor, &oldRecordId)));
@@ -212,58 +307,40 @@ Error::Code
     chunk->recordKey = newRecordKey;
     chunk->heapPtr   = std::move(buffer);
 
-    fds_record_t tmpRecord = {.file_id = fileId,
-                              .key     = newRecordKey,
-                              .data    = {.p_data       = chunk->heapPtr.get(),
-                                       .length_words = lenWords}};
-
-    chunk->onFinish.reset();
-    auto nordicResult = fds_record_update(&descriptor, &tmpRecord);
-    if (nordicResult != NRF_SUCCESS) {
-        if (nordicResult == FDS_ERR_NO_SPACE_IN_FLASH) {
-            // flash is full, try to call gc
-            bool recordsFreed = false;
-            RETURN_ON_ERROR(callGarbageCollection(recordsFreed));
-            if (recordsFreed) {
-                // if it fails now, there is nothing left to do, flash might be full
-                RETURN_ON_ERROR(::IO::Flash::Utility::getError(
-                    fds_record_update(&descriptor, &tmpRecord)));
-            } else {
-                // no records to free, flash is just full
-                return Error::OutOfResources;
-            }
-        } else {
-            // some other plain old error
-            return ::IO::Flash::Utility::getError(nordicResult);
-        }
-    }
-    RETURN_ON_ERROR(chunk->onFinish.await(RTOS::Infinity));
+    RETURN_ON_ERROR(submitWrite(chunk, descriptor, lenBytes, timeout));
 
-    result = chunk->result;
-    return result;
+    stackGuard.deactivate();
+    pending.chunk = chunk;
+    return Error::None;
 }
 
 /**
- * @brief Removes the record with the given descriptor.
- * 
- * @warning Will block until done.
- * Timeout can not be implemented due to underlying library.
+ * @brief Queue removing the record with the given descriptor.
  * 
  * @param descriptor Descriptor to existing FileRecord
- * @return Error::Code Might timeout or invalid parameters
+ * @param pending Set to the queued delete, see createRecordAsync().
+ * @param timeout Maximum time to wait for a free operation slot.
+ * @return Error::Code Result of queueing.
  */
-Error::Code IO::Flash::File::removeRecord(fds_record_desc_t& descriptor)
+Error::Code IO::Flash::File::removeRecordAsync(fds_record_desc_t& descriptor,
+                                               Pending&           pending,
+                                               RTOS::milliseconds timeout)
 {
+    // an error of the previous operation would be lost otherwise
+    RETURN_ON_ERROR(pending.await());
+
     uint16_t fileId;
     // Return Not found if file does noot even exist
-    RETURN_ON_ERROR(getId(fileId));
+    RETURN_ON_ERROR(getId(fileId, timeout));
 
     // get dynamicly allocated buffer
     HeapChunk* chunk {nullptr};
-    RETURN_ON_ERROR(allocRecordSpace(chunk, AsyncOperation::DeleteRecord));
+    RETURN_ON_ERROR(
+        allocRecordSpace(chunk, AsyncOperation::DeleteRecord, timeout));
 
-    // call clean when this function returns
+    // give the chunk back unless the delete is queued
     auto stackGuard = Patterns::make_scopeExit([chunk]() { chunk->free(); });
+    chunk->submit(pending);
 
     uint32_t oldRecordId;
     RETURN_ON_ERROR(::IO::Flash::Utility::getError(
@@ -271,20 +348,15 @@ Error::Code IO::Flash::File::removeRecord(fds_record_desc_t& descriptor)
     chunk->recordId = oldRecordId;
     chunk->fileId   = fileId;
 
-    chunk->onFinish.reset();
     auto nordicCode = fds_record_delete(&descriptor);
     if (nordicCode != NRF_SUCCESS) {
         LOG_E("fds_record_delete failed: %u", nordicCode);
     }
     RETURN_ON_ERROR(::IO::Flash::Utility::getError(nordicCode));
-    RETURN_ON_ERROR(chunk->onFinish.await(RTOS::Infinity));
-
-    if (chunk->result != Error::None) {
-        return chunk->result;
-    }
 
-    auto result = chunk->result;
-    return result;
+    stackGuard.deactivate();
+    pending.chunk = chunk;
+    return Error::None;
 }
 
 /**
@@ -302,17 +374,30 @@ IO::Flash::File::RecordCollection
 /**
  * @brief Gets the FDS file_id for this file
  * 
+ * @details Searches flash if the Directory is busy for longer than
+ * timeout, which only reads.
+ *
  * @param id Output for the id if found
+ * @param timeout Maximum time to wait for the Directory.
  * @return Error::Code might not find the given file
  */
-Error::Code IO::Flash::File::getId(uint16_t& id)
+Error::Code IO::Flash::File::getId(uint16_t& id, RTOS::milliseconds timeout)
 {
     if (lastKnownFileId != Utility::kFileIdInvalid) {
         // file was already found and its id can just be used
         id = lastKnownFileId;
         return Error::None;
     } else {
-        // search the file in flash
+        auto result = Directory::find(name, id, timeout);
+        if (result == Error::None) {
+            lastKnownFileId = id;
+            return Error::None;
+        } else if (result == Error::NotFound) {
+            id = Utility::kFileIdInvalid;
+            return Error::NotFound;
+        }
+
+        // directory does not know, search the file in flash
         for (auto iter = Iterator(Utility::kRecordKeyDescriptor);
              iter != Iterator();
              ++iter) {
@@ -348,31 +433,102 @@ Error::Code IO::Flash::File::getId(uint16_t& id)
  * @warning Will block until done.
  * Timeout can not be implemented due to underlying library.
  * 
+ * @details Takes the lowest free id from the Directory. Only if the directory
+ * is not available or its ids are all taken, ids are probed in flash.
+ *
  * @return Error::Code All files might be in use
  */
 Error::Code IO::Flash::File::create()
 {
+    uint16_t fileId;
+    auto     result = Directory::allocateId(fileId);
+    if (result == Error::None) {
+        return createDescriptor(fileId);
+    }
+
     // not found, create new file desriptor and file
-    for (auto fileId = Utility::kFileIdMin; fileId <= Utility::kFileIdMax;
-         ++fileId) {
+    fileId = (result == Error::OutOfResources) ? Directory::kTrackedIds
+                                               : Utility::kFileIdMin;
+    for (; fileId <= Utility::kFileIdMax; ++fileId) {
         // check whether there is at least one record
         lastKnownFileId = fileId;
         if (Iterator(*this) == Iterator()) {
             // file iterator does not yield any results, fileId is unused
-            size_t                     dataLength = strlen(name) + 1;
-            std::unique_ptr<uint8_t[]> dataPtr {new uint8_t[dataLength]};
-            memcpy(dataPtr.get(), name, dataLength);
-            RETURN_ON_ERROR(createRecord(Utility::kRecordKeyDescriptor,
-                                         std::move(dataPtr),
-                                         dataLength));
-            return Error::None;
+            return createDescriptor(fileId);
         }
     }
 
     // all files used, very unlikely to get here without a bug
+    lastKnownFileId = Utility::kFileIdInvalid;
     return Error::OutOfResources;
 }
 
+/**
+ * @brief Write the descriptor record holding the name of this file.
+ *
+ * @warning Will block until done.
+ *
+ * @param fileId Unused file id to create the file with.
+ * @return Error::Code Write might fail, the id is given back then.
+ */
+Error::Code IO::Flash::File::createDescriptor(uint16_t fileId)
+{
+    lastKnownFileId = fileId;
+
+    size_t   dataLength   = strlen(name) + 1;
+    uint32_t descriptorId = 0;
+    Buffer   dataPtr {};
+    auto     result = allocBuffer(dataPtr, dataLength);
+    if (result == Error::None) {
+        memcpy(dataPtr.get(), name, dataLength);
+        result = createRecord(Utility::kRecordKeyDescriptor,
+                              std::move(dataPtr),
+                              dataLength,
+                              &descriptorId);
+    }
+
+    if (result != Error::None) {
+        lastKnownFileId = Utility::kFileIdInvalid;
+        Directory::releaseId(fileId);
+        return result;
+    }
+    Directory::add(name, fileId, descriptorId);
+    return Error::None;
+}
+
+/**
+ * @brief Prepare the chunk for the operation of pending.
+ * 
+ * @details Numbers the operation before the handler can match it by file
+ * and record key, so of several writes to the same key the oldest one is
+ * finished first, the same order FDS works in. Writes and updates hold
+ * getSubmitMutex() from here until FDS queued them, otherwise numbering
+ * and queue order could differ.
+ * 
+ */
+void IO::Flash::File::HeapChunk::submit(const Pending& pending)
+{
+    onFinish.reset();
+    sequence = nextSequence++;
+    callback = pending.callback;
+    context  = pending.context;
+}
+
+/**
+ * @brief Store the result and notify callback and waiter.
+ * 
+ * @details Called from the flash event handler.
+ * 
+ */
+void IO::Flash::File::HeapChunk::finish(Error::Code result)
+{
+    this->result = result;
+    if (callback != nullptr) {
+        callback(result, context);
+    }
+    onFinish.trigger();
+}
+
 /**
  * @brief Cleans up the chunk and resets to defaults.
  * 
@@ -386,6 +542,8 @@ void IO::Flash::File::HeapChunk::free()
     fileId    = Utility::kFileIdInvalid;
     recordKey = Utility::kRecordKeyReserved;
     heapPtr.reset();
+    callback = nullptr;
+    context  = nullptr;
 
     // only now free the chunk
     isFree.trigger();
@@ -393,6 +551,34 @@ void IO::Flash::File::HeapChunk::free()
 
 //---------------------------- STATIC FUNCTIONS -------------------------------
 
+/**
+ * @brief Takes a buffer for record data from the pool.
+ * 
+ * @details The buffer is returned to the pool when the write using it
+ * finished. Blocks are word aligned and a multiple of the word size, so
+ * padding the record to full words never reads past the buffer.
+ * 
+ * @warning The pool holds FDS_OP_QUEUE_SIZE + 2 blocks and does not wait
+ * for one to come back. More writers at the same time get OutOfResources,
+ * where heap allocation used to succeed.
+ * 
+ * @param buffer Set to the new buffer.
+ * @param lenBytes Bytes needed.
+ * @return Error::Code TooLarge above kMaxRecordBytes, OutOfResources if the
+ * pool is exhausted.
+ */
+Error::Code IO::Flash::File::allocBuffer(Buffer& buffer, size_t lenBytes)
+{
+    if (lenBytes > kMaxRecordBytes) {
+        return Error::TooLarge;
+    }
+    buffer = getBufferPool().allocateBuffer(lenBytes);
+    if (!buffer) {
+        return Error::OutOfResources;
+    }
+    return Error::None;
+}
+
 /**
  * @brief Get the Chunks holding the memory for flash operations.
  * 
@@ -405,6 +591,33 @@ std::array<IO::Flash::File::HeapChunk, FDS_OP_QUEUE_SIZE>&
     return chunks;
 }
 
+/**
+ * @brief Get the mutex that keeps sequence numbers in FDS queue order.
+ * 
+ * @details Lazy loading for proper order of initialization.
+ * 
+ * @return RTOS::Mutex& Held from HeapChunk::submit() until FDS queued the
+ * write or update.
+ */
+RTOS::Mutex& IO::Flash::File::getSubmitMutex()
+{
+    static RTOS::Mutex mutex {};
+    return mutex;
+}
+
+/**
+ * @brief Get the pool record data is buffered in while written.
+ * 
+ * @details Lazy loading for proper order of initialization.
+ * 
+ * @return BufferPool& Pool of the record buffers.
+ */
+IO::Flash::File::BufferPool& IO::Flash::File::getBufferPool()
+{
+    static BufferPool pool {};
+    return pool;
+}
+
 /**
  * @brief Get Events that mark finishing of an operation in a heapchunk.
  * 
@@ -499,19 +712,26 @@ void IO::Flash::File::handler(fds_evt_t const* evt)
  */
 void IO::Flash::File::handlerWriteUpdate(fds_evt_t const* evt)
 {
+    // several writes to the same key might be queued, FDS finishes the
+    // oldest one first
+    HeapChunk* oldest = nullptr;
     for (auto& chunk : getChunks()) {
-        if (!chunk.isFree.wasTriggered() &&
+        if (!chunk.isFree.wasTriggered() && !chunk.onFinish.wasTriggered() &&
             (chunk.operation == AsyncOperation::Update ||
              chunk.operation == AsyncOperation::Write) &&
             chunk.fileId == evt->write.file_id &&
-            chunk.recordKey == evt->write.record_key) {
-            // update recordId so the blocking function can read it
-            chunk.recordId = evt->write.record_id;
-            chunk.result   = ::Port::Utility::getError(evt->result);
-            chunk.onFinish.trigger();
-            return;
+            chunk.recordKey == evt->write.record_key &&
+            (oldest == nullptr ||
+             static_cast<int32_t>(chunk.sequence - oldest->sequence) < 0)) {
+            oldest = &chunk;
         }
     }
+    if (oldest != nullptr) {
+        // update recordId so the waiting function can read it
+        oldest->recordId = evt->write.record_id;
+        oldest->finish(::Port::Utility::getError(evt->result));
+        return;
+    }
     LOG_W("timeouted write returned with error code: %u", evt->result);
 }
 
@@ -531,8 +751,7 @@ void IO::Flash::File::handlerDeleteRecord(fds_evt_t const* evt)
             chunk.operation == AsyncOperation::DeleteRecord &&
             chunk.recordId == evt->del.record_id) {
             // update recordId so the blocking function can read it
-            chunk.result = ::Port::Utility::getError(evt->result);
-            chunk.onFinish.trigger();
+            chunk.finish(::Port::Utility::getError(evt->result));
             return;
         }
     }
@@ -555,8 +774,7 @@ void IO::Flash::File::handlerDeleteFile(fds_evt_t const* evt)
             chunk.operation == AsyncOperation::DeleteFile &&
             chunk.fileId == evt->del.file_id) {
             // update recordId so the blocking function can read it
-            chunk.result = ::Port::Utility::getError(evt->result);
-            chunk.onFinish.trigger();
+            chunk.finish(::Port::Utility::getError(evt->result));
             return;
         }
     }
@@ -578,8 +796,7 @@ void IO::Flash::File::handlerGarbageCollection(fds_evt_t const* evt)
         if (!iter.isFree.wasTriggered() &&
             iter.operation == AsyncOperation::GarbageCollection) {
             // there must not be more than one garbage collection in the queue
-            iter.result = ::Port::Utility::getError(evt->result);
-            iter.onFinish.trigger();
+            iter.finish(::Port::Utility::getError(evt->result));
             return;
         }
     }
@@ -622,21 +839,72 @@ Error::Code IO::Flash::File::callGarbageCollection(bool& ran)
     }
 }
 
+/**
+ * @brief Hands the write or update prepared in chunk to FDS.
+ * 
+ * @details Runs the garbage collection once if flash is full, unless
+ * there is a timeout.
+ * 
+ * @param chunk Chunk with file id, record key and data set.
+ * @param descriptor Record to update, set to the written record.
+ * @param lenBytes Length of the data in bytes.
+ * @param timeout Infinity to wait for the garbage collection if needed.
+ * @return Error::Code OutOfResources if flash is full, Busy if it needs a
+ * garbage collection that must not be waited for.
+ */
+Error::Code IO::Flash::File::submitWrite(HeapChunk*         chunk,
+                                         fds_record_desc_t& descriptor,
+                                         const size_t       lenBytes,
+                                         RTOS::milliseconds timeout)
+{
+    auto lenWords = (lenBytes + Utility::kWordSize - 1) / Utility::kWordSize;
+    fds_record_t tmpRecord = {.file_id = chunk->fileId,
+                              .key     = chunk->recordKey,
+                              .data    = {.p_data       = chunk->heapPtr.get(),
+                                       .length_words = lenWords}};
+
+    auto write = [chunk, &descriptor, &tmpRecord]() {
+        return (chunk->operation == AsyncOperation::Update)
+                   ? fds_record_update(&descriptor, &tmpRecord)
+                   : fds_record_write(&descriptor, &tmpRecord);
+    };
+
+    auto nordicResult = write();
+    if (nordicResult == FDS_ERR_NO_SPACE_IN_FLASH) {
+        if (timeout != RTOS::Infinity) {
+            // the garbage collection waits for flash
+            return Error::Busy;
+        }
+        // flash is full, try to call gc
+        bool recordsFreed = false;
+        RETURN_ON_ERROR(callGarbageCollection(recordsFreed));
+        if (!recordsFreed) {
+            // no records to free, flash is just full
+            return Error::OutOfResources;
+        }
+        // if it fails now, there is nothing left to do, flash might be full
+        nordicResult = write();
+    }
+    return ::IO::Flash::Utility::getError(nordicResult);
+}
+
 /**
  * @brief Tries to get record space for putting stuff in the operation queue.
  * 
  * @param chunk Index of chunk which was allocated for usage.
  * @param operation Which operation to allocate the HeapChunk for.
+ * @param timeout Maximum time to wait for a chunk to be freed.
  * @return Error::Code If wait for free chunks fails.
  */
 Error::Code
     IO::Flash::File::allocRecordSpace(IO::Flash::File::HeapChunk*&    chunk,
-                                      IO::Flash::File::AsyncOperation operation)
+                                      IO::Flash::File::AsyncOperation operation,
+                                      RTOS::milliseconds              timeout)
 {
     while (1) {
         // wait for one entry to be freed
         RETURN_ON_ERROR(getFreeEvents().await(getFreeEventList(),
-                                              RTOS::Infinity,
+                                              timeout,
                                               RTOS::EventGroup::WaitMode::Or));
         for (auto& iterChunk : getChunks()) {
             if (iterChunk.isFree.wasTriggered()) {
@@ -0,0 +1,145 @@
+/**
+ * @file AL_FlashPending.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief handle of a queued flash operation
+ * @version 1.0
+ * @date 2020-11-21
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashFile.h"
+
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a handle without an operation.
+ *
+ */
+IO::Flash::File::Pending::Pending()
+        : chunk(nullptr), recordId(0), callback(nullptr), context(nullptr)
+{}
+
+/**
+ * @brief Take over the operation of other.
+ *
+ */
+IO::Flash::File::Pending::Pending(Pending&& other)
+        : chunk(other.chunk), recordId(other.recordId),
+          callback(other.callback), context(other.context)
+{
+    other.chunk = nullptr;
+}
+
+/**
+ * @brief Wait for the own operation, then take over the one of other.
+ *
+ */
+IO::Flash::File::Pending& IO::Flash::File::Pending::operator=(Pending&& other)
+{
+    if (this != &other) {
+        await();
+        chunk       = other.chunk;
+        recordId    = other.recordId;
+        callback    = other.callback;
+        context     = other.context;
+        other.chunk = nullptr;
+    }
+    return *this;
+}
+
+/**
+ * @brief Waits for the operation, its slot is needed by others.
+ *
+ */
+IO::Flash::File::Pending::~Pending()
+{
+    await();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Set the function notified when the next operation finished.
+ *
+ * @details The callback runs in the flash event handler, keep it short and
+ * do not block. Stays set for following operations.
+ *
+ * @return Error::Code Busy while an operation is queued.
+ */
+Error::Code IO::Flash::File::Pending::setCallback(Callback callback,
+                                                  void*    context)
+{
+    if (chunk != nullptr) {
+        return Error::Busy;
+    }
+    this->callback = callback;
+    this->context  = context;
+    return Error::None;
+}
+
+/**
+ * @brief Wait for the operation to finish.
+ *
+ * @details The result is reported once, awaiting again returns None.
+ *
+ * @param timeout Maximum time to wait.
+ * @return Error::Code Result of the operation, Timeout if it is still
+ * queued. None if no operation was queued or it was awaited already.
+ */
+Error::Code IO::Flash::File::Pending::await(RTOS::milliseconds timeout)
+{
+    if (chunk == nullptr) {
+        return Error::None;
+    }
+    RETURN_ON_ERROR(chunk->onFinish.await(timeout));
+
+    auto result = chunk->result;
+    recordId    = chunk->recordId;
+    chunk->free();
+    chunk = nullptr;
+    return result;
+}
+
+/**
+ * @brief Whether an operation was queued and not awaited yet.
+ *
+ */
+bool IO::Flash::File::Pending::isQueued() const
+{
+    return chunk != nullptr;
+}
+
+/**
+ * @brief Whether await() returns without blocking.
+ *
+ */
+bool IO::Flash::File::Pending::isDone()
+{
+    return (chunk == nullptr) || chunk->onFinish.wasTriggered();
+}
+
+/**
+ * @brief FDS record id of the record written by the last awaited
+ * operation.
+ *
+ */
+uint32_t IO::Flash::File::Pending::getRecordId() const
+{
+    return recordId;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -14,6 +14,7 @@
 #include "AL_FlashRecord.h"
 
 #include "AL_Log.h"
+#include "FlashRecordCache.h"
 #include "FlashUtility.h"
 #include "FunctionScopeTimer.h"
 
@@ -97,12 +98,57 @@ Error::Code IO::Flash::Record<T>::tryGet(T& value)
  */
 template<class T>
 Error::Code IO::Flash::Record<T>::trySet(const T& value)
+{
+    // CachedRecords of the same name would serve the old value otherwise,
+    // drop it once flash is written, whether that worked or not
+    auto cacheDropper = Patterns::make_scopeExit([this]() { dropCached(); });
+
+    Pending pending {};
+    RETURN_ON_ERROR(trySetAsync(value, pending));
+    return pending.await();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Queue writing the value, without waiting for flash.
+ * 
+ * @details Blocks only to delete a corrupted record first. The caller has
+ * to dropCached() once pending finished.
+ *
+ * Given a timeout, nothing waits for flash and Busy is returned if the
+ * file has to be created, a corrupted record deleted or flash garbage
+ * collected first. Those are left to a call without timeout.
+ *
+ * @param value Value to try to set to.
+ * @param pending Set to the queued write.
+ * @param timeout Maximum time to wait for a free operation slot.
+ * @return Error::Code Result of queueing.
+ */
+template<class T>
+Error::Code IO::Flash::Record<T>::trySetAsync(const T&           value,
+                                              Pending&           pending,
+                                              RTOS::milliseconds timeout)
 {
     fds_record_desc_t  descriptor = {0};
     fds_flash_record_t record     = {0};
 
+    if (timeout != RTOS::Infinity) {
+        // the id is kept by file, so searching records below does not wait
+        // for the Directory
+        uint16_t fileId;
+        auto     result = file.getId(fileId, timeout);
+        if (result == Error::NotFound) {
+            return Error::Busy;
+        }
+        RETURN_ON_ERROR(result);
+    }
+
     // Allocate and put together data field
-    std::unique_ptr<uint8_t[]> buffer {new uint8_t[lengthBytes()]};
+    File::Buffer buffer {};
+    RETURN_ON_ERROR(File::allocBuffer(buffer, lengthBytes()));
     // copy string plus terminating char
     memcpy(buffer.get(), name, strlen(name) + 1);
     // copy in value
@@ -113,29 +159,45 @@ Error::Code IO::Flash::Record<T>::trySet(const T& value)
     if (result == Error::None) {
         // record already exists, close and update
         RETURN_ON_ERROR(Utility::closeRecord(descriptor));
-        return file.updateRecord(descriptor,
-                                 record.p_header->record_key,
-                                 std::move(buffer),
-                                 lengthBytes());
+        return file.updateRecordAsync(descriptor,
+                                      record.p_header->record_key,
+                                      std::move(buffer),
+                                      lengthBytes(),
+                                      pending,
+                                      timeout);
     } else if ((result == Error::NotFound) ||
                (result == Error::ChecksumFailed)) {
         if (result == Error::ChecksumFailed) {
+            if (timeout != RTOS::Infinity) {
+                // deleting waits for flash
+                return Error::Busy;
+            }
             // first delete then create again
             RETURN_ON_ERROR(file.removeRecord(descriptor));
         }
 
         // record does not exist, create
-        return file.createRecord(getRecordIndex(),
-                                 std::move(buffer),
-                                 lengthBytes());
+        return file.createRecordAsync(getRecordIndex(),
+                                      std::move(buffer),
+                                      lengthBytes(),
+                                      pending,
+                                      timeout);
     } else {
         return result;
     }
 }
 
-//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
-
-//--------------------------- PRIVATE FUNCTIONS -------------------------------
+/**
+ * @brief Drop the RAM copy CachedRecords of the same name might hold.
+ *
+ * @param timeout Maximum time to wait for the RecordCache.
+ * @return true no copy is left, false if the cache was busy.
+ */
+template<class T>
+bool IO::Flash::Record<T>::dropCached(RTOS::milliseconds timeout)
+{
+    return RecordCache::erase({&file, getRecordIndex(), name}, timeout);
+}
 
 /**
  * @brief Calculate crc16 from string identifier.
@@ -0,0 +1,404 @@
+/**
+ * @file AL_FlashTimeSeries.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compressed log of time stamped samples in flash
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashTimeSeries.h"
+
+#include <ScopeExit.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Make a new Flash::TimeSeries instance.
+ *
+ * @details This works lazy loading, flash is scanned for the pages when the
+ * series is used for the first time.
+ *
+ * @param name String identifier of the series
+ */
+template<class T, size_t kMaxPages>
+IO::Flash::TimeSeries<T, kMaxPages>::TimeSeries(const char* const name)
+        : File(name), pages(), openPage(), lastTime(0), isIndexed(false),
+          mutex()
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Add a sample to the end of the log.
+ *
+ * @warning Blocks while a full page is written. Refer to class doc.
+ *
+ * @param time Time of the sample, not before the last one appended, also
+ * before a reset. Refer to class doc.
+ * @param value Value of the sample.
+ * @return Error::Code InvalidParameter if time lies before the last sample.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::append(uint32_t time,
+                                                        const T& value)
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    RETURN_ON_ERROR(buildIndex());
+    if (time < lastTime) {
+        return Error::InvalidParameter;
+    }
+
+    if (!openPage.add(time, static_cast<int64_t>(value))) {
+        RETURN_ON_ERROR(writePage());
+        // an empty page takes any sample
+        openPage.add(time, static_cast<int64_t>(value));
+    }
+    lastTime = time;
+    return Error::None;
+}
+
+/**
+ * @brief Write the samples kept in RAM, even if their page is not full.
+ *
+ * @details Call before sleeping or a reset. Every flush starts a new page,
+ * flushing after each sample gives up the compression.
+ *
+ * @warning Will block until done.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::flush()
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    RETURN_ON_ERROR(buildIndex());
+    return writePage();
+}
+
+/**
+ * @brief Delete all samples, in flash and RAM.
+ *
+ * @warning Will block until done.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::clear()
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    RETURN_ON_ERROR(File::clear());
+    pages.clear();
+    openPage.clear();
+    lastTime  = 0;
+    isIndexed = true;
+    return Error::None;
+}
+
+/**
+ * @brief Samples with from <= time <= to, for range based loops.
+ *
+ * @details Pages starting after to are not read, pages ending before from
+ * are skipped by their start time.
+ */
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Range
+    IO::Flash::TimeSeries<T, kMaxPages>::range(uint32_t from, uint32_t to)
+{
+    return Range {*this, from, to};
+}
+
+/**
+ * @brief All samples, for range based loops.
+ *
+ */
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Range
+    IO::Flash::TimeSeries<T, kMaxPages>::all()
+{
+    return Range {*this, 0, UINT32_MAX};
+}
+
+/**
+ * @brief Number of pages in flash, not counting the one in RAM.
+ *
+ */
+template<class T, size_t kMaxPages>
+size_t IO::Flash::TimeSeries<T, kMaxPages>::getPageCount()
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    if (buildIndex() != Error::None) {
+        return 0;
+    }
+    return pages.size();
+}
+
+/**
+ * @brief Construct a range of samples.
+ *
+ */
+template<class T, size_t kMaxPages>
+IO::Flash::TimeSeries<T, kMaxPages>::Range::Range(TimeSeries& series,
+                                                  uint32_t    from,
+                                                  uint32_t    to)
+        : series(series), from(from), to(to)
+{}
+
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Iterator
+    IO::Flash::TimeSeries<T, kMaxPages>::Range::begin()
+{
+    return Iterator {series, from, to};
+}
+
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Iterator
+    IO::Flash::TimeSeries<T, kMaxPages>::Range::end()
+{
+    return Iterator {};
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Scan flash for the pages of this series, once.
+ *
+ * @details Caller has to hold the mutex. Pages beyond kMaxPages, e.g.
+ * written by firmware with a larger kMaxPages, are deleted oldest first.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::buildIndex()
+{
+    if (isIndexed) {
+        return Error::None;
+    }
+
+    pages.clear();
+    bool hasExcess = false;
+    for (auto descriptor : findByRecordKey(kRecordKeyPage)) {
+        SamplePage page {};
+        if (readPage(descriptor.record_id, page) != Error::None) {
+            // corrupted page, nothing to read from it
+            continue;
+        }
+
+        // record ids increase with every write, so they sort by age
+        size_t index = 0;
+        while (index < pages.size() &&
+               pages[index].recordId < descriptor.record_id) {
+            ++index;
+        }
+        if (pages.isFull()) {
+            hasExcess = true;
+            if (index == 0) {
+                continue;
+            }
+            pages.erase(pages.begin());
+            --index;
+        }
+        pages.emplace(pages.begin() + index,
+                      PageInfo {page.getStartTime(), descriptor.record_id});
+    }
+
+    if (hasExcess) {
+        for (auto descriptor : findByRecordKey(kRecordKeyPage)) {
+            if (descriptor.record_id < pages.front().recordId) {
+                RETURN_ON_ERROR(removeRecord(descriptor));
+            }
+        }
+    }
+
+    // appends continue after the newest sample in flash
+    lastTime = 0;
+    if (!pages.empty()) {
+        SamplePage page {};
+        RETURN_ON_ERROR(readPage(pages.back().recordId, page));
+        SamplePage::Cursor cursor {};
+        int64_t            value = 0;
+        while (page.read(cursor, lastTime, value)) {}
+    }
+
+    isIndexed = true;
+    return Error::None;
+}
+
+/**
+ * @brief Write the page in RAM as new record and start an empty one.
+ *
+ * @details Caller has to hold the mutex. Drops the oldest page if
+ * kMaxPages are written or flash is full.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::writePage()
+{
+    if (openPage.isEmpty()) {
+        return Error::None;
+    }
+    if (pages.isFull()) {
+        RETURN_ON_ERROR(dropOldest());
+    }
+
+    uint32_t recordId = 0;
+    auto     write    = [this, &recordId]() -> Error::Code {
+        Buffer data {};
+        RETURN_ON_ERROR(allocBuffer(data, openPage.getLenBytes()));
+        openPage.store(data.get());
+        return createRecord(kRecordKeyPage,
+                            std::move(data),
+                            openPage.getLenBytes(),
+                            &recordId);
+    };
+
+    auto result = write();
+    if (result == Error::OutOfResources && !pages.empty()) {
+        // flash is full, make room at the old end of the log
+        RETURN_ON_ERROR(dropOldest());
+        result = write();
+    }
+    RETURN_ON_ERROR(result);
+
+    pages.push_back(PageInfo {openPage.getStartTime(), recordId});
+    openPage.clear();
+    return Error::None;
+}
+
+/**
+ * @brief Delete the oldest page from flash.
+ *
+ * @details Caller has to hold the mutex. A page that is not in flash any
+ * more is only dropped from the index, so a lost record can not block
+ * writing new pages.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::dropOldest()
+{
+    fds_record_desc_t descriptor = {0};
+    if (fds_descriptor_from_rec_id(&descriptor, pages.front().recordId) !=
+        FDS_SUCCESS) {
+        pages.erase(pages.begin());
+        return Error::None;
+    }
+
+    auto result = removeRecord(descriptor);
+    if (result != Error::None && result != Error::NotFound) {
+        return result;
+    }
+    pages.erase(pages.begin());
+    return Error::None;
+}
+
+/**
+ * @brief Copy the page following recordId, used by Iterator.
+ *
+ * @param recordId Record id of the last page read, 0 to start with the
+ * oldest. Set to the record id of the copied page.
+ * @param page Output, copy of the page.
+ * @return Error::Code NotFound after the page in RAM.
+ */
+template<class T, size_t kMaxPages>
+Error::Code
+    IO::Flash::TimeSeries<T, kMaxPages>::loadPageAfter(uint32_t&   recordId,
+                                                       SamplePage& page)
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    RETURN_ON_ERROR(buildIndex());
+    if (recordId == kRecordIdOpen) {
+        return Error::NotFound;
+    }
+
+    for (auto& info : pages) {
+        if (info.recordId > recordId &&
+            readPage(info.recordId, page) == Error::None) {
+            recordId = info.recordId;
+            return Error::None;
+        }
+    }
+
+    if (openPage.isEmpty()) {
+        return Error::NotFound;
+    }
+    page     = openPage;
+    recordId = kRecordIdOpen;
+    return Error::None;
+}
+
+/**
+ * @brief Record id to pass to loadPageAfter(), so the first page copied is
+ * the last one starting before time.
+ *
+ * @details Strictly before, as samples with the same time can continue
+ * over a page boundary and the page before holds the first of them.
+ */
+template<class T, size_t kMaxPages>
+uint32_t IO::Flash::TimeSeries<T, kMaxPages>::getRecordIdBefore(uint32_t time)
+{
+    CHECK_ERROR(mutex.tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, mutex);
+
+    uint32_t recordId = 0;
+    if (buildIndex() != Error::None) {
+        return recordId;
+    }
+
+    for (size_t i = 1; i < pages.size() && pages[i].startTime < time; ++i) {
+        recordId = pages[i - 1].recordId;
+    }
+    if (!pages.empty() && !openPage.isEmpty() &&
+        openPage.getStartTime() < time) {
+        recordId = pages.back().recordId;
+    }
+    return recordId;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Copy a page from flash.
+ *
+ * @param recordId FDS record id of the page.
+ * @param page Output, copy of the page.
+ * @return Error::Code Might not find the record.
+ */
+template<class T, size_t kMaxPages>
+Error::Code IO::Flash::TimeSeries<T, kMaxPages>::readPage(uint32_t    recordId,
+                                                          SamplePage& page)
+{
+    fds_record_desc_t  descriptor = {0};
+    fds_flash_record_t record     = {0};
+    RETURN_ON_ERROR(
+        Utility::getError(fds_descriptor_from_rec_id(&descriptor, recordId)));
+
+    RETURN_ON_ERROR(Utility::openRecord(descriptor, record));
+    // closes record when scope is left
+    auto recordCloser = Patterns::make_scopeExit(
+        [&descriptor]() { Utility::closeRecord(descriptor); });
+
+    RETURN_ON_ERROR(page.load(record.p_data,
+                              record.p_header->length_words *
+                                  Utility::kWordSize));
+
+    recordCloser.deactivate();
+    return Utility::closeRecord(descriptor);
+}
@@ -0,0 +1,143 @@
+/**
+ * @file AL_FlashTimeSeriesIterator.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief iterates the samples of a time series in flash
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "AL_FlashTimeSeries.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct end iterator.
+ *
+ */
+template<class T, size_t kMaxPages>
+IO::Flash::TimeSeries<T, kMaxPages>::Iterator::Iterator()
+        : series(nullptr), from(0), to(0), recordId(0), page(), cursor(),
+          current {0, 0}
+{}
+
+/**
+ * @brief Construct iterator at the first sample with from <= time <= to.
+ *
+ * @param series Series to iterate.
+ * @param from First time included.
+ * @param to Last time included.
+ */
+template<class T, size_t kMaxPages>
+IO::Flash::TimeSeries<T, kMaxPages>::Iterator::Iterator(TimeSeries& series,
+                                                        uint32_t    from,
+                                                        uint32_t    to)
+        : series(&series), from(from), to(to),
+          recordId(series.getRecordIdBefore(from)), page(), cursor(),
+          current {0, 0}
+{
+    if (series.loadPageAfter(recordId, page) != Error::None) {
+        this->series = nullptr;
+        return;
+    }
+    // dereference first sample
+    next();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Equality operator
+ *
+ */
+template<class T, size_t kMaxPages>
+bool IO::Flash::TimeSeries<T, kMaxPages>::Iterator::operator==(
+    const Iterator& other)
+{
+    if (series == nullptr || other.series == nullptr) {
+        return series == other.series;
+    }
+    return series == other.series && recordId == other.recordId &&
+           cursor.index == other.cursor.index;
+}
+
+/**
+ * @brief Inequality operator
+ *
+ */
+template<class T, size_t kMaxPages>
+bool IO::Flash::TimeSeries<T, kMaxPages>::Iterator::operator!=(
+    const Iterator& other)
+{
+    return !(*this == other);
+}
+
+/**
+ * @brief Dereference operator
+ *
+ * @return Sample Current sample.
+ */
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Sample
+    IO::Flash::TimeSeries<T, kMaxPages>::Iterator::operator*() const
+{
+    return current;
+}
+
+/**
+ * @brief Advance to the next sample in range.
+ *
+ */
+template<class T, size_t kMaxPages>
+typename IO::Flash::TimeSeries<T, kMaxPages>::Iterator&
+    IO::Flash::TimeSeries<T, kMaxPages>::Iterator::operator++()
+{
+    next();
+    return *this;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Decode samples until one is in range, loading following pages.
+ * Turns into the end iterator after to.
+ *
+ */
+template<class T, size_t kMaxPages>
+void IO::Flash::TimeSeries<T, kMaxPages>::Iterator::next()
+{
+    while (series != nullptr) {
+        uint32_t time  = 0;
+        int64_t  value = 0;
+        if (!page.read(cursor, time, value)) {
+            cursor = SamplePage::Cursor {};
+            if (series->loadPageAfter(recordId, page) != Error::None) {
+                series = nullptr;
+            }
+            continue;
+        }
+
+        if (time < from) {
+            continue;
+        }
+        if (time > to) {
+            // samples are sorted, none left in range
+            series = nullptr;
+            return;
+        }
+        current = Sample {time, static_cast<T>(value)};
+        return;
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,311 @@
+/**
+ * @file FlashDirectory.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RAM index of the files stored in flash
+ * @version 1.0
+ * @date 2020-11-20
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashDirectory.h"
+
+#include "FlashUtility.h"
+#include "fds.h"
+
+#include <AL_Log.h>
+#include <ScopeExit.h>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+IO::Flash::Directory::State IO::Flash::Directory::state =
+    IO::Flash::Directory::State::Unknown;
+uint8_t IO::Flash::Directory::usedIds[kTrackedIds / 8] = {0};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Scan flash for the first time.
+ *
+ * @warning Does not lock, only call before the scheduler is started.
+ *
+ * @details On a fresh install FDS finishes initializing asynchronously, in
+ * that case the scan is repeated on first use.
+ */
+void IO::Flash::Directory::init()
+{
+    if (build() != Error::None) {
+        LOG_I("flash directory is built on first use");
+    }
+}
+
+/**
+ * @brief Look up the file id of a file name.
+ *
+ * @param name Name of the file.
+ * @param fileId Output, set if found.
+ * @param timeout Maximum time to wait for the directory.
+ * @return Error::Code NotFound if there is no such file, Unknown if the
+ * directory can not tell or is busy and flash has to be searched.
+ */
+Error::Code IO::Flash::Directory::find(const char*        name,
+                                       uint16_t&          fileId,
+                                       RTOS::milliseconds timeout)
+{
+    if (getMutex().tryObtain(timeout) != Error::None) {
+        return Error::Unknown;
+    }
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    if (state == State::Unknown && build() != Error::None) {
+        return Error::Unknown;
+    }
+
+    auto entry = getTable().find(getHash(name));
+    if (entry == nullptr) {
+        return (state == State::Complete) ? Error::NotFound : Error::Unknown;
+    }
+
+    // hashes of different names might match, confirm with the descriptor
+    fds_record_desc_t  descriptor = {0};
+    fds_flash_record_t record     = {0};
+    fds_descriptor_from_rec_id(&descriptor, entry->descriptorId);
+    if (Utility::openRecord(descriptor, record) != Error::None) {
+        return Error::Unknown;
+    }
+    bool isSame = strcmp(name, static_cast<const char*>(record.p_data)) == 0;
+    RETURN_ON_ERROR(Utility::closeRecord(descriptor));
+
+    if (!isSame) {
+        return Error::Unknown;
+    }
+    fileId = entry->fileId;
+    return Error::None;
+}
+
+/**
+ * @brief Reserve the lowest unused file id.
+ *
+ * @param fileId Output, set to the reserved id.
+ * @return Error::Code OutOfResources if all tracked ids are used,
+ * NotInitialized if flash could not be scanned.
+ */
+Error::Code IO::Flash::Directory::allocateId(uint16_t& fileId)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    if (state == State::Unknown && build() != Error::None) {
+        return Error::NotInitialized;
+    }
+
+    for (uint16_t id = Utility::kFileIdMin; id < kTrackedIds; ++id) {
+        if (!isUsed(id)) {
+            markUsed(id, true);
+            fileId = id;
+            return Error::None;
+        }
+    }
+    return Error::OutOfResources;
+}
+
+/**
+ * @brief Give back an id from allocateId() that was not written.
+ *
+ */
+void IO::Flash::Directory::releaseId(uint16_t fileId)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    markUsed(fileId, false);
+}
+
+/**
+ * @brief Enter a file whose descriptor was just written.
+ *
+ * @param name Name of the file.
+ * @param fileId FDS file id of the file.
+ * @param descriptorId FDS record id of the descriptor record.
+ */
+void IO::Flash::Directory::add(const char* name,
+                               uint16_t    fileId,
+                               uint32_t    descriptorId)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    if (state == State::Unknown) {
+        // the scan will find it in flash
+        return;
+    }
+
+    markUsed(fileId, true);
+    if (getTable().emplace(getHash(name), Entry {fileId, descriptorId}) ==
+        nullptr) {
+        // table full or hash taken, this name has to be searched in flash
+        state = State::Partial;
+    }
+}
+
+/**
+ * @brief Forget a file that was deleted from flash.
+ *
+ */
+void IO::Flash::Directory::remove(uint16_t fileId)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    if (state == State::Unknown) {
+        return;
+    }
+
+    markUsed(fileId, false);
+    auto& table = getTable();
+    for (auto& entry : table) {
+        if (entry.value.fileId == fileId) {
+            auto key = entry.key;
+            table.erase(key);
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Scan all records in flash and fill table and bitmap.
+ *
+ * @details Caller has to hold the mutex, or call before the scheduler runs.
+ * Records that can not be read, e.g. failing their checksum, are skipped
+ * and leave the directory Partial.
+ *
+ * @return Error::Code NotInitialized while FDS is not ready yet.
+ */
+Error::Code IO::Flash::Directory::build()
+{
+    auto& table = getTable();
+    table.clear();
+    std::memset(usedIds, 0, sizeof(usedIds));
+    state = State::Unknown;
+
+    State             result     = State::Complete;
+    fds_record_desc_t descriptor = {0};
+    fds_find_token_t  token      = {0};
+    ret_code_t        nordicCode;
+    while ((nordicCode = fds_record_iterate(&descriptor, &token)) ==
+           FDS_SUCCESS) {
+        fds_flash_record_t record = {0};
+        if (Utility::openRecord(descriptor, record) != Error::None) {
+            // corrupted record, its file has to be searched in flash. The
+            // header is not checked by FDS, keep its id from being reused
+            auto header = reinterpret_cast<const fds_header_t*>(
+                descriptor.p_record);
+            if (header != nullptr) {
+                markUsed(header->file_id, true);
+            }
+            result = State::Partial;
+            continue;
+        }
+        // closes record when scope is left
+        auto recordCloser = Patterns::make_scopeExit(
+            [&descriptor]() { Utility::closeRecord(descriptor); });
+
+        uint16_t fileId = record.p_header->file_id;
+        markUsed(fileId, true);
+        if (record.p_header->record_key == Utility::kRecordKeyDescriptor) {
+            auto name = static_cast<const char*>(record.p_data);
+            if (table.emplace(getHash(name),
+                              Entry {fileId, record.p_header->record_id}) ==
+                nullptr) {
+                result = State::Partial;
+            }
+        }
+
+        recordCloser.deactivate();
+        RETURN_ON_ERROR(Utility::closeRecord(descriptor));
+    }
+
+    if (nordicCode != FDS_ERR_NOT_FOUND) {
+        return Utility::getError(nordicCode);
+    }
+    state = result;
+    return Error::None;
+}
+
+/**
+ * @brief Whether fileId has records in flash or is reserved.
+ * Untracked ids are never reported as used.
+ *
+ */
+bool IO::Flash::Directory::isUsed(uint16_t fileId)
+{
+    if (fileId >= kTrackedIds) {
+        return false;
+    }
+    return (usedIds[fileId / 8] & (1u << (fileId % 8))) != 0;
+}
+
+void IO::Flash::Directory::markUsed(uint16_t fileId, bool used)
+{
+    if (fileId >= kTrackedIds) {
+        return;
+    }
+    if (used) {
+        usedIds[fileId / 8] |= (1u << (fileId % 8));
+    } else {
+        usedIds[fileId / 8] &= ~(1u << (fileId % 8));
+    }
+}
+
+/**
+ * @brief FNV-1a hash of a file name.
+ *
+ */
+uint32_t IO::Flash::Directory::getHash(const char* name)
+{
+    uint32_t hash = 0x811C9DC5u;
+    while (*name != '\0') {
+        hash ^= static_cast<uint8_t>(*name++);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Mutex guarding table, bitmap and state.
+ *
+ */
+RTOS::Mutex& IO::Flash::Directory::getMutex()
+{
+    static RTOS::Mutex mutex {};
+    return mutex;
+}
+
+/**
+ * @brief Indexed files, constructed on first use.
+ *
+ */
+IO::Flash::Directory::Table& IO::Flash::Directory::getTable()
+{
+    static Table table {};
+    return table;
+}
@@ -0,0 +1,227 @@
+/**
+ * @file FlashRecordCache.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief RAM cache of record values for IO::Flash::CachedRecord
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashRecordCache.h"
+
+#include <ScopeExit.h>
+#include <StaticVector.h>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+uint32_t IO::Flash::RecordCache::hits   = 0;
+uint32_t IO::Flash::RecordCache::misses = 0;
+uint32_t IO::Flash::RecordCache::generation = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+IO::Flash::RecordCache::Value::Value(const void* value, size_t size)
+        : size(static_cast<uint8_t>(size))
+{
+    std::memcpy(data, value, size);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Reads served from RAM.
+ *
+ */
+uint32_t IO::Flash::RecordCache::getHits()
+{
+    return hits;
+}
+
+/**
+ * @brief Reads that had to go to flash.
+ *
+ */
+uint32_t IO::Flash::RecordCache::getMisses()
+{
+    return misses;
+}
+
+/**
+ * @brief Values dropped to make room for others.
+ * Rising numbers hint at too few slots.
+ *
+ */
+uint32_t IO::Flash::RecordCache::getEvictions()
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+    return getTable().getEvictions();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+bool IO::Flash::RecordCache::Key::operator==(const Key& other) const
+{
+    // names are usually the same literal, compare the pointer first
+    return (file == other.file) && (recordKey == other.recordKey) &&
+           ((name == other.name) || (std::strcmp(name, other.name) == 0));
+}
+
+uint32_t IO::Flash::RecordCache::KeyHash::operator()(const Key& key) const
+{
+    // record key is a CRC of the name already, mix in the file
+    uint32_t value = key.recordKey ^ reinterpret_cast<uintptr_t>(key.file);
+    return value * 0x9E3779B1u;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Copy a cached value.
+ *
+ * @param key Identifies the value.
+ * @param value Output, written only on a hit.
+ * @param size Bytes of value.
+ * @return true value was in RAM.
+ */
+bool IO::Flash::RecordCache::load(const Key& key, void* value, size_t size)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    auto cached = getTable().find(key);
+    if (cached == nullptr || cached->size != size) {
+        misses++;
+        return false;
+    }
+    std::memcpy(value, cached->data, size);
+    hits++;
+    return true;
+}
+
+/**
+ * @brief Put a value into the cache, replacing an older copy.
+ *
+ * @details Values larger than kMaxValueBytes are not cached. Neither are
+ * values of a generation that passed, flash might have been written since
+ * they were read.
+ *
+ * @param key Identifies the value.
+ * @param value Value as in flash.
+ * @param size Bytes of value.
+ * @param generation getGeneration() from before value was read, or after
+ * it was written.
+ */
+void IO::Flash::RecordCache::store(const Key&  key,
+                                   const void* value,
+                                   size_t      size,
+                                   uint32_t    generation)
+{
+    if (size > kMaxValueBytes) {
+        return;
+    }
+
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    if (generation != RecordCache::generation) {
+        // dropped in the meantime, value might be older than flash
+        return;
+    }
+
+    auto& table  = getTable();
+    auto  cached = table.find(key);
+    if (cached != nullptr) {
+        *cached = Value {value, size};
+    } else {
+        table.emplace(key, value, size);
+    }
+}
+
+/**
+ * @brief Drop the copy of a value.
+ *
+ * @param key Identifies the value.
+ * @param timeout Maximum time to wait for the cache.
+ * @return true value is not in RAM anymore, false if the cache was busy.
+ */
+bool IO::Flash::RecordCache::erase(const Key& key, RTOS::milliseconds timeout)
+{
+    if (getMutex().tryObtain(timeout) != Error::None) {
+        return false;
+    }
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    getTable().erase(key);
+    generation++;
+    return true;
+}
+
+/**
+ * @brief Current generation, to pass to store() later.
+ *
+ */
+uint32_t IO::Flash::RecordCache::getGeneration()
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+    return generation;
+}
+
+/**
+ * @brief Drop the copies of all values in file.
+ *
+ */
+void IO::Flash::RecordCache::eraseFile(const File& file)
+{
+    CHECK_ERROR(getMutex().tryObtain());
+    auto mutexReleaser =
+        Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, getMutex());
+
+    auto& table = getTable();
+    // table can not be changed while iterating it
+    Collections::StaticVector<Key, kSlots> keys {};
+    for (auto entry = table.begin(); entry != table.end(); ++entry) {
+        keys.push_back(entry.getKey());
+    }
+    for (auto& key : keys) {
+        if (key.file == &file) {
+            table.erase(key);
+        }
+    }
+    generation++;
+}
+
+/**
+ * @brief Mutex guarding the table, the counters and the generation.
+ *
+ */
+RTOS::Mutex& IO::Flash::RecordCache::getMutex()
+{
+    static RTOS::Mutex mutex {};
+    return mutex;
+}
+
+/**
+ * @brief Cached values, constructed on first use.
+ *
+ */
+IO::Flash::RecordCache::Table& IO::Flash::RecordCache::getTable()
+{
+    static Table table {};
+    return table;
+}
@@ -0,0 +1,274 @@
+/**
+ * @file FlashSamplePage.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief compressed page of time stamped samples
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashSamplePage.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Cursor in front of the first sample.
+ *
+ */
+IO::Flash::SamplePage::Cursor::Cursor()
+        : offset(0), index(0), time(0), delta(0), value(0)
+{}
+
+/**
+ * @brief Create an empty page.
+ *
+ */
+IO::Flash::SamplePage::SamplePage()
+        : header {0, 0, 0}, payload {0}, lastTime(0), lastDelta(0),
+          lastValue(0)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Remove all samples.
+ *
+ */
+void IO::Flash::SamplePage::clear()
+{
+    header    = {0, 0, 0};
+    lastTime  = 0;
+    lastDelta = 0;
+    lastValue = 0;
+}
+
+/**
+ * @brief Append a sample.
+ *
+ * @warning Only for pages built in RAM, a loaded page can not be extended.
+ *
+ * @param time Time of the sample, not before the last one.
+ * @param value Value of the sample.
+ * @return true if added, false if the page is full.
+ */
+bool IO::Flash::SamplePage::add(uint32_t time, int64_t value)
+{
+    uint8_t encoded[2 * kMaxVarintBytes];
+    size_t  lenBytes = 0;
+    int64_t delta    = 0;
+
+    if (header.count == 0) {
+        lenBytes = putVarint(zigzag(value), encoded);
+    } else {
+        delta = static_cast<int64_t>(time) - static_cast<int64_t>(lastTime);
+        lenBytes = putVarint(zigzag(delta - lastDelta), encoded);
+        lenBytes += putVarint(zigzag(value - lastValue), encoded + lenBytes);
+    }
+
+    if (header.lenBytes + lenBytes > kMaxPayloadBytes) {
+        return false;
+    }
+
+    std::memcpy(payload + header.lenBytes, encoded, lenBytes);
+    if (header.count == 0) {
+        header.startTime = time;
+    }
+    header.count++;
+    header.lenBytes += lenBytes;
+    lastTime  = time;
+    lastDelta = delta;
+    lastValue = value;
+    return true;
+}
+
+/**
+ * @brief Decode the sample following cursor.
+ *
+ * @param cursor Position, start with a new Cursor.
+ * @param time Output, time of the sample.
+ * @param value Output, value of the sample.
+ * @return true if a sample was read, false at the end of the page or on
+ * corrupted data.
+ */
+bool IO::Flash::SamplePage::read(Cursor&   cursor,
+                                 uint32_t& time,
+                                 int64_t&  value) const
+{
+    if (cursor.index >= header.count) {
+        return false;
+    }
+
+    uint64_t encoded  = 0;
+    size_t   lenBytes = 0;
+    if (cursor.index == 0) {
+        lenBytes = getVarint(payload, header.lenBytes, encoded);
+        if (lenBytes == 0) {
+            return false;
+        }
+        cursor.time  = header.startTime;
+        cursor.value = unzigzag(encoded);
+    } else {
+        lenBytes = getVarint(payload + cursor.offset,
+                             header.lenBytes - cursor.offset,
+                             encoded);
+        if (lenBytes == 0) {
+            return false;
+        }
+        cursor.offset += lenBytes;
+        cursor.delta += unzigzag(encoded);
+        cursor.time += static_cast<uint32_t>(cursor.delta);
+
+        lenBytes = getVarint(payload + cursor.offset,
+                             header.lenBytes - cursor.offset,
+                             encoded);
+        if (lenBytes == 0) {
+            return false;
+        }
+        cursor.value += unzigzag(encoded);
+    }
+
+    cursor.offset += lenBytes;
+    cursor.index++;
+    time  = cursor.time;
+    value = cursor.value;
+    return true;
+}
+
+/**
+ * @brief Copy a page read from flash.
+ *
+ * @param data Start of the record data.
+ * @param lenBytes Length of the record data, including word padding.
+ * @return Error::Code SizeMissmatch if the data is no page.
+ */
+Error::Code IO::Flash::SamplePage::load(const void* data, size_t lenBytes)
+{
+    if (lenBytes < sizeof(Header)) {
+        return Error::SizeMissmatch;
+    }
+
+    Header loaded {};
+    std::memcpy(&loaded, data, sizeof(Header));
+    if (loaded.lenBytes > kMaxPayloadBytes ||
+        sizeof(Header) + loaded.lenBytes > lenBytes) {
+        return Error::SizeMissmatch;
+    }
+
+    clear();
+    header = loaded;
+    std::memcpy(payload,
+                static_cast<const uint8_t*>(data) + sizeof(Header),
+                header.lenBytes);
+    return Error::None;
+}
+
+/**
+ * @brief Copy the page for writing it to flash.
+ *
+ * @param data Destination of getLenBytes() bytes.
+ */
+void IO::Flash::SamplePage::store(uint8_t* data) const
+{
+    std::memcpy(data, &header, sizeof(Header));
+    std::memcpy(data + sizeof(Header), payload, header.lenBytes);
+}
+
+bool IO::Flash::SamplePage::isEmpty() const
+{
+    return header.count == 0;
+}
+
+uint16_t IO::Flash::SamplePage::getCount() const
+{
+    return header.count;
+}
+
+uint32_t IO::Flash::SamplePage::getStartTime() const
+{
+    return header.startTime;
+}
+
+/**
+ * @brief Time of the last sample added, only valid for pages built in RAM.
+ *
+ */
+uint32_t IO::Flash::SamplePage::getLastTime() const
+{
+    return lastTime;
+}
+
+/**
+ * @brief Bytes needed to store the page, header included.
+ *
+ */
+size_t IO::Flash::SamplePage::getLenBytes() const
+{
+    return sizeof(Header) + header.lenBytes;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Map signed to unsigned, so small negative values stay small.
+ *
+ */
+uint64_t IO::Flash::SamplePage::zigzag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+int64_t IO::Flash::SamplePage::unzigzag(uint64_t value)
+{
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+/**
+ * @brief Write value in 7 bit groups, least significant first.
+ *
+ * @param data Destination of up to kMaxVarintBytes.
+ * @return size_t Bytes written.
+ */
+size_t IO::Flash::SamplePage::putVarint(uint64_t value, uint8_t* data)
+{
+    size_t lenBytes = 0;
+    while (value >= 0x80) {
+        data[lenBytes++] = static_cast<uint8_t>(value) | 0x80;
+        value >>= 7;
+    }
+    data[lenBytes++] = static_cast<uint8_t>(value);
+    return lenBytes;
+}
+
+/**
+ * @brief Read a varint written by putVarint().
+ *
+ * @return size_t Bytes read, 0 if data ends before the varint.
+ */
+size_t IO::Flash::SamplePage::getVarint(const uint8_t* data,
+                                        size_t         lenBytes,
+                                        uint64_t&      value)
+{
+    value = 0;
+    for (size_t i = 0; i < lenBytes && i < kMaxVarintBytes; i++) {
+        value |= static_cast<uint64_t>(data[i] & 0x7F) << (7 * i);
+        if ((data[i] & 0x80) == 0) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
@@ -14,6 +14,7 @@
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "FlashUtility.h"
+#include "FlashDirectory.h"
 #include "PortUtility.h"
 
 #include "fds.h"
@@ -45,6 +46,9 @@ void IO::Flash::Utility::init()
         // escalate, could not init
         CHECK_ERROR(Error::NotInitialized);
     }
+
+    // index files once, instead of searching flash for every file
+    Directory::init();
 }
 
 /**
@@ -0,0 +1,77 @@
+/**
+ * @file CrashReport.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief keeps the Diagnostics::CrashLog in flash
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __CRASHREPORT_H__
+#define __CRASHREPORT_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Log
+{
+class CrashReport;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_CrashLog.h>
+#include <AL_FlashFile.h>
+#include <AL_FlashRecord.h>
+#include <Error.h>
+
+namespace Log
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Stores the ring of the Diagnostics::CrashLog in a flash record.
+ * Implemented as eager loading singleton.
+ *
+ * @details The whole ring is a single record, so a commit is one flash
+ * write.
+ *
+ * @example Logging the reset cause after boot, from any task
+ * ```cpp
+ * if (Log::CrashReport::commit() == Error::None) {
+ *     Diagnostics::CrashLog::Record last {};
+ *     CHECK_ERROR(Log::CrashReport::read(0, last));
+ *     // report last.site to the backend
+ * }
+ * ```
+ *
+ * @warning Blocks until flash is written, do not call before the scheduler
+ * runs.
+ */
+class CrashReport : private Diagnostics::CrashLog::Store {
+    // delete default constructors
+    CrashReport(const CrashReport& other) = delete;
+    CrashReport& operator=(const CrashReport& other) = delete;
+
+public:
+    static CrashReport& getInstance();
+    static Error::Code  commit();
+    static Error::Code  read(size_t age, Diagnostics::CrashLog::Record& record);
+    static Error::Code  clear();
+
+private:
+    CrashReport();
+    static CrashReport instance;
+
+    // Diagnostics::CrashLog::Store
+    virtual Error::Code load(Diagnostics::CrashLog::Ring& ring) final;
+    virtual Error::Code store(const Diagnostics::CrashLog::Ring& ring) final;
+
+    IO::Flash::File                               file; /**< crash log file */
+    IO::Flash::Record<Diagnostics::CrashLog::Ring> ring; /**< newest first */
+};
+}  // namespace Log
+#endif  //__CRASHREPORT_H__
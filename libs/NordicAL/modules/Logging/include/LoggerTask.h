@@ -1,7 +1,7 @@
 /**
  * @file LoggerTask.h
  * @author Joshua Lauterbach (joshua@aconno.de)
- * @brief singleton task that runs logging
+ * @brief singleton CoTask that runs logging
  * @version 1.0
  * @date 2020-04-14
  * 
@@ -25,10 +25,9 @@ class Task;
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include <AL_CoTask.h>
 #include <AL_Event.h>
-#include <AL_EventGroup.h>
 #include <AL_RTOS.h>
-#include <AL_Task.h>
 
 namespace Log
 {
@@ -39,15 +38,11 @@ namespace Log
 /**
  * @brief singleton task that runs logging.
  * Implemented as eager loading singleton so it will always start.
+ *
+ * @details Runs as CoTask on Port::getExecutor(), the executor stack is
+ * sized for flushing the logs.
  */
-class Task {
-    static constexpr RTOS::milliseconds kLogTasKPriority =
-        1; /**< Priority of the log task */
-    static constexpr size_t kStackSize =
-        512; /**< Stack size of the logging task in sizeof(StackType_t) bytes*/
-
-    friend RTOS::Task<kStackSize, ::Log::Task>;
-
+class Task : private RTOS::CoTask {
     // delete default constructors
     Task(const Task& other) = delete;
     Task& operator=(const Task& other) = delete;
@@ -61,15 +56,11 @@ private:
     Task();
     static Task instance;
 
-    /** task implementation */
-    void onStart();
-    void onRun();
+    // RTOS::CoTask
+    virtual RTOS::Await onResume(Error::Code result) final;
 
-    RTOS::EventGroup eventGroup; /** Holds all logging related events */
     RTOS::Event
         logQueued; /**< gets triggered every time a log message is queued */
-    RTOS::Task<kStackSize, ::Log::Task>
-        rtosTask; /**< actual RTOS task that runs this context */
 };
 }  // namespace Log
 #endif  //__LOGGERTASK_H__
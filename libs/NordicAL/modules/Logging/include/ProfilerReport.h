@@ -0,0 +1,87 @@
+/**
+ * @file ProfilerReport.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief periodic report of the RTOS::Profiler
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __PROFILERREPORT_H__
+#define __PROFILERREPORT_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Log
+{
+class ProfilerReport;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Profiler.h>
+#include <AL_RTOS.h>
+#include <AL_Timer.h>
+#include <Error.h>
+#include <Observable.h>
+
+namespace Log
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Samples the RTOS::Profiler periodically, logs the result with LOG_I
+ * and hands the packed snapshot to its observers.
+ * Implemented as eager loading singleton, does nothing until started.
+ *
+ * @details Runs in the timer task. Observers must not block.
+ *
+ * @example Serving the snapshot over GATT
+ * ```cpp
+ * using Packed = RTOS::Profiler::PackedSnapshot;
+ *
+ * class ProfilerCharacteristic : Patterns::Observer<const Packed&> {
+ *     IO::BLE::Characteristic<Packed> characteristic;
+ *
+ *     void handle(Patterns::Observable<const Packed&>& observable,
+ *                 const Packed&                        packed)
+ *     {
+ *         characteristic.updateValue(packed);
+ *     }
+ *     ...
+ * };
+ *
+ * Log::ProfilerReport::start(10000);
+ * ```
+ */
+class ProfilerReport :
+    public Patterns::Observable<const RTOS::Profiler::PackedSnapshot&>,
+    private RTOS::Timer {
+    /** report interval if none is given */
+    static constexpr RTOS::milliseconds kDefaultPeriod = 10000;
+
+    // delete default constructors
+    ProfilerReport(const ProfilerReport& other) = delete;
+    ProfilerReport& operator=(const ProfilerReport& other) = delete;
+
+public:
+    static ProfilerReport& getInstance();
+    static Error::Code     start(RTOS::milliseconds period = kDefaultPeriod);
+    static Error::Code     stop();
+
+private:
+    ProfilerReport();
+    static ProfilerReport instance;
+
+    // RTOS::Timer
+    virtual void onTimer() final;
+
+    /** last snapshot as bytes, handed to observers */
+    RTOS::Profiler::PackedSnapshot packed;
+};
+}  // namespace Log
+#endif  //__PROFILERREPORT_H__
@@ -0,0 +1,124 @@
+/**
+ * @file TraceDump.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief dumps the RTOS::Trace over RTT or to observers
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TRACEDUMP_H__
+#define __TRACEDUMP_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Log
+{
+class TraceDump;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_RTOS.h>
+#include <AL_Trace.h>
+#include <Error.h>
+#include <Observable.h>
+#include <array>
+#include <cstddef>
+
+namespace Log
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** payload of a notification with the default ATT MTU */
+constexpr size_t kTraceChunkSize = 20;
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Writes a dump of RTOS::Trace either to RTT channel kRttChannel or
+ * in chunks to its observers.
+ * Implemented as eager loading singleton.
+ *
+ * @details The RTT channel is binary, NRF_LOG keeps using channel 0. Record
+ * it on the PC with e.g.
+ * `JLinkRTTLogger -Device NRF52832_XXAA -If SWD -Speed 4000 -RTTChannel 1
+ * trace.bin` and convert it with tools/TraceConverter.
+ *
+ * Observers get the dump in chunks of kChunkSize bytes, the last one padded
+ * with zeros. The converter ignores anything behind the last record.
+ *
+ * @warning Not thread safe, dump from one task only. Observers are called
+ * from the dumping task and must not drop chunks.
+ *
+ * @example Serving the dump over GATT
+ * ```cpp
+ * using Chunk = Log::TraceDump::Chunk;
+ *
+ * class TraceCharacteristic : Patterns::Observer<const Chunk&> {
+ *     IO::BLE::Characteristic<Chunk> characteristic;
+ *
+ *     void handle(Patterns::Observable<const Chunk&>& observable,
+ *                 const Chunk&                        chunk)
+ *     {
+ *         // indications wait for the acknowledgement of the central
+ *         characteristic.updateValue(chunk);
+ *     }
+ *     ...
+ * };
+ *
+ * Log::TraceDump::toObservers();
+ * ```
+ */
+class TraceDump :
+    public Patterns::Observable<const std::array<uint8_t, kTraceChunkSize>&>,
+    private RTOS::Trace::Sink {
+public:
+    /** RTT up channel of the dump */
+    static constexpr unsigned kRttChannel = 1;
+    /** bytes handed to the observers at once */
+    static constexpr size_t kChunkSize = kTraceChunkSize;
+    /** piece of the dump handed to the observers */
+    using Chunk = std::array<uint8_t, kChunkSize>;
+
+    // delete default constructors
+    TraceDump(const TraceDump& other) = delete;
+    TraceDump& operator=(const TraceDump& other) = delete;
+
+    static TraceDump&  getInstance();
+    static Error::Code toRtt();
+    static Error::Code toObservers();
+
+private:
+    /** RTT buffer, the PC empties it while the dump gets written */
+    static constexpr size_t kRttBufferSize = 1024;
+    /** time to give up on RTT if no PC reads it */
+    static constexpr RTOS::milliseconds kRttTimeout = 1000;
+
+    /** where write() puts the dump */
+    enum class Target { Rtt, Observers };
+
+    TraceDump();
+    static TraceDump instance;
+
+    // RTOS::Trace::Sink
+    virtual Error::Code write(const uint8_t* data, size_t length) final;
+
+    Error::Code writeRtt(const uint8_t* data, size_t length);
+    void        writeChunks(const uint8_t* data, size_t length);
+
+    /** target of the running dump */
+    Target target;
+    /** chunk being filled for the observers */
+    Chunk chunk;
+    /** bytes in chunk */
+    size_t chunkFill;
+    /** whether the RTT channel is configured */
+    bool rttConfigured;
+    /** buffer of the RTT channel */
+    uint8_t rttBuffer[kRttBufferSize];
+};
+}  // namespace Log
+#endif  //__TRACEDUMP_H__
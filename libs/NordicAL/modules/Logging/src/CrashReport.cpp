@@ -0,0 +1,107 @@
+/**
+ * @file CrashReport.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief keeps the Diagnostics::CrashLog in flash
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "CrashReport.h"
+
+#include <AL_Log.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief Eager loading singleton instance.
+ *
+ */
+Log::CrashReport Log::CrashReport::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Singleton constructor, nothing is read from flash yet.
+ *
+ */
+Log::CrashReport::CrashReport() : file("crashLog"), ring("ring", file) {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the singleton instance
+ *
+ * @return CrashReport& Single crash report
+ */
+Log::CrashReport& Log::CrashReport::getInstance()
+{
+    return instance;
+}
+
+/**
+ * @brief Writes the failed error check from before the restart to flash
+ * and logs it. Call once after boot.
+ *
+ * @return Error::Code NotFound if the last restart was no crash.
+ */
+Error::Code Log::CrashReport::commit()
+{
+    RETURN_ON_ERROR(Diagnostics::CrashLog::commit(instance));
+
+    Diagnostics::CrashLog::Record record {};
+    RETURN_ON_ERROR(read(0, record));
+    LOG_E("crash #%u: site 0x%08X (line %u), error %u, task %u, after %u ms",
+          record.sequence,
+          record.site,
+          Error::getSiteLine(record.site),
+          record.code,
+          record.task,
+          record.uptimeMs);
+    return Error::None;
+}
+
+/**
+ * @brief Read a record from flash.
+ *
+ * @param age 0 for the newest record.
+ * @param record Read record.
+ * @return Error::Code NotFound if there are not that many records.
+ */
+Error::Code Log::CrashReport::read(size_t age,
+                                   Diagnostics::CrashLog::Record& record)
+{
+    return Diagnostics::CrashLog::read(instance, age, record);
+}
+
+/**
+ * @brief Deletes all records, e.g. after they got reported.
+ *
+ * @return Error::Code
+ */
+Error::Code Log::CrashReport::clear()
+{
+    return instance.file.clear();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+Error::Code Log::CrashReport::load(Diagnostics::CrashLog::Ring& ring)
+{
+    return this->ring.tryGet(ring);
+}
+
+Error::Code Log::CrashReport::store(const Diagnostics::CrashLog::Ring& ring)
+{
+    return this->ring.trySet(ring);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
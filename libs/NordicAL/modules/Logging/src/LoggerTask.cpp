@@ -16,6 +16,7 @@
 //--------------------------------- INCLUDES ----------------------------------
 
 #include "LoggerTask.h"
+#include "AL_Port.h"
 #include "PortUtility.h"
 #include "nrf_log.h"
 #include "nrf_log_ctrl.h"
@@ -42,9 +43,8 @@ Log::Task Log::Task::instance {};
  * 
  */
 Log::Task::Task()
-        : eventGroup {}, logQueued {eventGroup}, rtosTask {*this,
-                                                           "Logger",
-                                                           kLogTasKPriority}
+        : RTOS::CoTask(Port::getExecutor()),
+          logQueued {Port::getExecutor().getEventGroup()}
 {}
 
 //--------------------------- EXPOSED FUNCTIONS -------------------------------
@@ -81,25 +81,20 @@ void Log::Task::triggerLog()
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 /**
- * @brief Implementation of task context
+ * @brief Implementation of CoTask.
  * 
- */
-void Log::Task::onStart()
-{
-    // do nothing
-}
-
-/**
- * @brief Implementation of task context.
- * 
- * @details Wait's for logs and flushes logs when needed.
+ * @details Flushes logs and waits for the next ones to be queued.
+ * NRF_LOG_FLUSH() processes all queued logs at once.
  * 
+ * @param result Result of waiting for logQueued.
+ * @return RTOS::Await Wait for next log.
  */
-void Log::Task::onRun()
+RTOS::Await Log::Task::onResume(Error::Code result)
 {
-    LOG_E_ON_ERROR(logQueued.await(), "Logging Task error");
+    LOG_E_ON_ERROR(result, "Logging Task error");
     logQueued.reset();
     NRF_LOG_FLUSH();
+    return RTOS::Await::event(logQueued);
 }
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
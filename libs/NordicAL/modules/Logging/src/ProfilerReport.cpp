@@ -0,0 +1,110 @@
+/**
+ * @file ProfilerReport.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief periodic report of the RTOS::Profiler
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "ProfilerReport.h"
+
+#include <AL_Log.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief Eager loading singleton instance.
+ *
+ */
+Log::ProfilerReport Log::ProfilerReport::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Singleton constructor, timer is not started yet.
+ *
+ */
+Log::ProfilerReport::ProfilerReport()
+        : RTOS::Timer("ProfilerReport", kDefaultPeriod, true), packed {}
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the singleton instance
+ *
+ * @return ProfilerReport& Single profiler report
+ */
+Log::ProfilerReport& Log::ProfilerReport::getInstance()
+{
+    return instance;
+}
+
+/**
+ * @brief Starts reporting periodically.
+ *
+ * @details The first report covers the time since scheduler start.
+ *
+ * @param period Time between two reports.
+ * @return Error::Code
+ */
+Error::Code Log::ProfilerReport::start(RTOS::milliseconds period)
+{
+    RETURN_ON_ERROR(instance.setTotalTimeMs(period));
+    return instance.RTOS::Timer::start();
+}
+
+/**
+ * @brief Stops reporting.
+ *
+ * @return Error::Code
+ */
+Error::Code Log::ProfilerReport::stop()
+{
+    return instance.RTOS::Timer::stop();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Samples the profiler, logs and notifies observers.
+ *
+ */
+void Log::ProfilerReport::onTimer()
+{
+    auto result = RTOS::Profiler::sample();
+    if (result != Error::None) {
+        LOG_E("Profiler could not sample: %u", result);
+        return;
+    }
+
+    const auto& snapshot = RTOS::Profiler::getSnapshot();
+    LOG_I("Profiler: %u ms, %u.%u%% CPU load, %u context switches",
+          snapshot.intervalMs,
+          snapshot.cpuLoadPermille / 10,
+          snapshot.cpuLoadPermille % 10,
+          snapshot.switches);
+    for (size_t i = 0; i < snapshot.taskCount; ++i) {
+        const auto& task = snapshot.tasks[i];
+        LOG_I("  %s: %u.%u%% CPU, %u switches, %u words stack left",
+              RTOS::Profiler::getTaskName(i),
+              task.cpuPermille / 10,
+              task.cpuPermille % 10,
+              task.switches,
+              task.stackHighWaterMark);
+    }
+
+    RTOS::Profiler::getPackedSnapshot(packed);
+    trigger(packed);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,160 @@
+/**
+ * @file TraceDump.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief dumps the RTOS::Trace over RTT or to observers
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TraceDump.h"
+
+#include <AL_ITask.h>
+#include <SEGGER_RTT.h>
+#include <algorithm>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/**
+ * @brief Eager loading singleton instance.
+ *
+ */
+Log::TraceDump Log::TraceDump::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+static_assert(SEGGER_RTT_MAX_NUM_UP_BUFFERS > Log::TraceDump::kRttChannel,
+              "increase SEGGER_RTT_CONFIG_MAX_NUM_UP_BUFFERS in sdk_config.h");
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Singleton constructor, RTT gets configured on first use.
+ *
+ */
+Log::TraceDump::TraceDump()
+        : target(Target::Rtt), chunk {}, chunkFill(0), rttConfigured(false),
+          rttBuffer {}
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Get the singleton instance
+ *
+ * @return TraceDump& Single trace dump
+ */
+Log::TraceDump& Log::TraceDump::getInstance()
+{
+    return instance;
+}
+
+/**
+ * @brief Writes a dump to RTT channel kRttChannel.
+ *
+ * @details Blocks until the PC read everything.
+ *
+ * @return Error::Code Timeout if nobody reads the channel.
+ */
+Error::Code Log::TraceDump::toRtt()
+{
+    if (!instance.rttConfigured) {
+        SEGGER_RTT_ConfigUpBuffer(kRttChannel,
+                                  "Trace",
+                                  instance.rttBuffer,
+                                  sizeof(instance.rttBuffer),
+                                  SEGGER_RTT_MODE_NO_BLOCK_TRIM);
+        instance.rttConfigured = true;
+    }
+
+    instance.target = Target::Rtt;
+    return RTOS::Trace::dump(instance);
+}
+
+/**
+ * @brief Hands a dump to the observers, chunk by chunk.
+ *
+ * @return Error::Code
+ */
+Error::Code Log::TraceDump::toObservers()
+{
+    instance.target    = Target::Observers;
+    instance.chunkFill = 0;
+    RETURN_ON_ERROR(RTOS::Trace::dump(instance));
+
+    if (instance.chunkFill > 0) {
+        std::fill(instance.chunk.begin() + instance.chunkFill,
+                  instance.chunk.end(),
+                  0);
+        instance.trigger(instance.chunk);
+        instance.chunkFill = 0;
+    }
+    return Error::None;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Forwards a piece of the dump to the current target.
+ *
+ */
+Error::Code Log::TraceDump::write(const uint8_t* data, size_t length)
+{
+    if (target == Target::Rtt) {
+        return writeRtt(data, length);
+    }
+    writeChunks(data, length);
+    return Error::None;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Writes to RTT, waits whenever the buffer is full.
+ *
+ */
+Error::Code Log::TraceDump::writeRtt(const uint8_t* data, size_t length)
+{
+    RTOS::milliseconds waited = 0;
+    while (length > 0) {
+        size_t written = SEGGER_RTT_Write(kRttChannel, data, length);
+        data += written;
+        length -= written;
+
+        if (written > 0) {
+            waited = 0;
+        } else if (waited++ < kRttTimeout) {
+            RTOS::ITask::delayCurrentTask(1);
+        } else {
+            return Error::Timeout;
+        }
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Fills chunk and hands every full one to the observers.
+ *
+ */
+void Log::TraceDump::writeChunks(const uint8_t* data, size_t length)
+{
+    while (length > 0) {
+        size_t part = std::min(length, kChunkSize - chunkFill);
+        std::memcpy(chunk.data() + chunkFill, data, part);
+        chunkFill += part;
+        data += part;
+        length -= part;
+
+        if (chunkFill == kChunkSize) {
+            trigger(chunk);
+            chunkFill = 0;
+        }
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -33,6 +33,7 @@
 #include <memory>
 #include <ScopeExit.h>
 #include <AL_Log.h>
+#include <Pool.h>
 
 namespace IO::I2C
 {
@@ -75,6 +76,9 @@ class Bus {
     Bus& operator=(const Bus& other) = delete;
 
 public:
+    /** Largest transfer in bytes, register address included. */
+    static constexpr size_t kMaxTransferSize = 64;
+
     Bus(uint32_t scl,
         uint32_t sda,
         uint8_t  interruptPriority = NRFX_TWIM_DEFAULT_CONFIG_IRQ_PRIORITY);
@@ -109,7 +113,17 @@ private:
         nrfx_twim_config_t config; /**< configuration of the I2C instance. */
     };
 
+    /**
+     * @brief DMA buffers of the transfers, one per bus as transfers on a
+     * bus are mutually exclusive.
+     *
+     */
+    using TransferPool = Patterns::BlockPool<
+        kMaxTransferSize,
+        static_cast<size_t>(BusInstance::NUM_OF_TWIM_INSTANCES)>;
+
     static nrfxInstanceData* allocInstance();
+    static TransferPool&     getTransferPool();
     static void              onTransferComplete(nrfx_twim_evt_t const* p_event,
                                                 void*                  p_context);
 
@@ -17,6 +17,7 @@
 
 #include <AL_I2CBus.h>
 #include <PortUtility.h>
+#include <AL_Trace.h>
 #include <FunctionScopeTimer.h>
 
 //--------------------------------- ARRAYS ------------------------------------
@@ -61,7 +62,7 @@ IO::I2C::Bus::Bus(uint32_t scl, uint32_t sda, uint8_t interruptPriority)
 /**
  * @brief Sets size number of registers in device.
  * 
- * @warning This method uses dynamic allocation.
+ * @details Transfers go through a DMA buffer taken from a pool.
  * 
  * @warning I2C transfers are blocking on RTOS events and
  * can therefor only be executed in task context.
@@ -73,7 +74,8 @@ IO::I2C::Bus::Bus(uint32_t scl, uint32_t sda, uint8_t interruptPriority)
  * @param data Data to put into the registers
  * @param size Date size in bytes
  * @param timeout Maximum time to wait for transfert to finish
- * @return Error::Code Can return error on failure or timeout.
+ * @return Error::Code Can return error on failure or timeout, TooLarge above
+ * kMaxTransferSize.
  */
 Error::Code IO::I2C::Bus::setRegisters(Frequency          frequency,
                                        uint8_t            deviceAddress,
@@ -85,11 +87,22 @@ Error::Code IO::I2C::Bus::setRegisters(Frequency          frequency,
 {
     RTOS::FunctionScopeTimer timeoutTimer {timeout};
 
+    size_t bufferSize = registerAddressSize + size;
+    if (bufferSize > kMaxTransferSize) {
+        return Error::TooLarge;
+    }
+
     RETURN_ON_ERROR(transferLock.tryObtain(timeout));
     // automatically release mutex when the function returns
     auto mutexRelease =
         Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, transferLock);
 
+    // one block per bus, can not fail while holding the transfer lock
+    auto setupBuffer = getTransferPool().allocateBuffer(bufferSize);
+    if (!setupBuffer) {
+        return Error::OutOfResources;
+    }
+
     // Reconfiguring TWI master instance
 
     // Setting up device frequency
@@ -109,9 +122,6 @@ Error::Code IO::I2C::Bus::setRegisters(Frequency          frequency,
         transferComplete.reset();
     });
 
-    size_t                     bufferSize = registerAddressSize + size;
-    std::unique_ptr<uint8_t[]> setupBuffer {new uint8_t[bufferSize]};
-
     // Setting up transfer buffer
     memcpy(setupBuffer.get(), registerAddress, registerAddressSize);
     memcpy(setupBuffer.get() + registerAddressSize, data, size);
@@ -131,7 +141,7 @@ Error::Code IO::I2C::Bus::setRegisters(Frequency          frequency,
 /**
  * @brief Gets the size number of registers from device address.
  * 
- * @warning This method uses dynamic allocation.
+ * @details Transfers go through a DMA buffer taken from a pool.
  * 
  * @warning I2C transfers are blocking on RTOS events and
  * can therefor only be executed in task context.
@@ -143,7 +153,8 @@ Error::Code IO::I2C::Bus::setRegisters(Frequency          frequency,
  * @param data Data to put into the registers
  * @param size Date size in bytes
  * @param timeout Maximum time to wait for transfert to finish
- * @return Error::Code Can return error on failure or timeout.
+ * @return Error::Code Can return error on failure or timeout, TooLarge above
+ * kMaxTransferSize.
  */
 Error::Code IO::I2C::Bus::getRegisters(Frequency          frequency,
                                        uint8_t            deviceAddress,
@@ -153,12 +164,22 @@ Error::Code IO::I2C::Bus::getRegisters(Frequency          frequency,
                                        size_t             size,
                                        RTOS::milliseconds timeout)
 {
+    if ((registerAddressSize > kMaxTransferSize) || (size > kMaxTransferSize)) {
+        return Error::TooLarge;
+    }
+
     RTOS::FunctionScopeTimer timeoutTimer {timeout};
     RETURN_ON_ERROR(transferLock.tryObtain(timeout));
     // automatically release mutex when the function returns
     auto mutexRelease =
         Patterns::make_scopeExit(&RTOS::Mutex::tryRelease, transferLock);
 
+    // one block per bus, can not fail while holding the transfer lock
+    auto setupBuffer = getTransferPool().allocateBuffer();
+    if (!setupBuffer) {
+        return Error::OutOfResources;
+    }
+
     // Setting up device frequency
     nrfxInstance.config.frequency =
         static_cast<nrf_twim_frequency_t>(frequency);
@@ -176,7 +197,6 @@ Error::Code IO::I2C::Bus::getRegisters(Frequency          frequency,
         transferComplete.reset();
     });
 
-    std::unique_ptr<uint8_t[]> setupBuffer {new uint8_t[registerAddressSize]};
     memcpy(setupBuffer.get(), registerAddress, registerAddressSize);
 
     // Select the starting address for reading
@@ -190,8 +210,7 @@ Error::Code IO::I2C::Bus::getRegisters(Frequency          frequency,
     RETURN_ON_ERROR(transferComplete.await(timeoutTimer.timeLeft()));
     transferComplete.reset();
 
-    // Reading from the selected address
-    setupBuffer.reset(new uint8_t[size]);
+    // Reading from the selected address, reusing the buffer
     RETURN_ON_ERROR(
         Port::Utility::getError(nrfx_twim_rx(&nrfxInstance.twimInstance,
                                              deviceAddress,
@@ -252,6 +271,19 @@ IO::I2C::Bus::nrfxInstanceData* IO::I2C::Bus::allocInstance()
     return nullptr;
 }
 
+/**
+ * @brief Pool of the DMA buffers used for transfers.
+ * 
+ * @details Function local static for proper order of initialization.
+ * 
+ * @return TransferPool& Pool with one buffer per bus instance.
+ */
+IO::I2C::Bus::TransferPool& IO::I2C::Bus::getTransferPool()
+{
+    static TransferPool pool {};
+    return pool;
+}
+
 /**
  * @brief Interrupt service routine called each time data transfer
  * is finished.
@@ -262,10 +294,13 @@ IO::I2C::Bus::nrfxInstanceData* IO::I2C::Bus::allocInstance()
 void IO::I2C::Bus::onTransferComplete(nrfx_twim_evt_t const* p_event,
                                       void*                  p_context)
 {
+    TRACE_ISR_ENTER();
+
     // Retrieve event from context
     RTOS::Event* event = static_cast<RTOS::Event*>(p_context);
     if (!event) {
         // could not parse event, let event timeout
+        TRACE_ISR_EXIT();
         return;
     }
 
@@ -273,6 +308,7 @@ void IO::I2C::Bus::onTransferComplete(nrfx_twim_evt_t const* p_event,
     bool contextSwitchNeeded = false;
     event->triggerFromISR(&contextSwitchNeeded);
 
+    TRACE_ISR_EXIT();
     if (contextSwitchNeeded) {
         // if event unblocked the task waiting for it, do not wait for next tick to run
         RTOS::yieldToSchedulerFromISR();
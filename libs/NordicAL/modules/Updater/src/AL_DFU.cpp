@@ -30,6 +30,7 @@
 
 //--------------------------------- INCLUDES ----------------------------------
 #include "AL_DFU.h"
+#include "AL_FlashDeferredRecord.h"
 #include "AL_Log.h"
 #include "BLE_Utility.h"
 #include "Error.h"
@@ -149,6 +150,13 @@ bool SYS::DFU::shutdownHandler(nrf_pwr_mgmt_evt_t event)
             	If you aren't finished with any ongoing tasks, return "false" to
             	signal to the system that reset is impossible at this stage. */
 
+            // values held back in RAM would be lost, flash needs the
+            // softdevice, so write them first
+            if (!IO::Flash::DeferredRecordBase::tryFlushAll()) {
+                // Wait another second and retry.
+                return false;
+            }
+
             // Device ready to enter DFU
             auto errCode = nrf_sdh_disable_request();
             CHECK_ERROR(Port::Utility::getError(errCode));
@@ -91,6 +91,21 @@ void Port::init()
     nrf_sdh_freertos_init(NULL, NULL);
 }
 
+/**
+ * @brief Get the executor shared by the NordicAL modules
+ *
+ * @details Logger and Advertiser spend nearly all of their time waiting,
+ * running them as CoTasks saves a task stack and TCB each. Function local
+ * static, so modules can use it from their eager singletons.
+ *
+ * @return Port::Executor& Executor for CoTasks
+ */
+Port::Executor& Port::getExecutor()
+{
+    static Executor executor {"Executor", kExecutorPriority};
+    return executor;
+}
+
 /**
  * @brief overwrite default implementation, because log flush is at wrong
  * position in original implementation.
@@ -129,16 +144,18 @@ extern "C" void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info)
             assert_info_t* p_info = (assert_info_t*)info;
             Error::internalCheck(
                 Error::InvalidUse,
-                p_info->line_num,
-                reinterpret_cast<const char*>(p_info->p_file_name));
+                Error::makeSite(
+                    reinterpret_cast<const char*>(p_info->p_file_name),
+                    p_info->line_num));
             break;
         }
         case NRF_FAULT_ID_SDK_ERROR: {
             error_info_t* p_info = (error_info_t*)info;
             Error::internalCheck(
                 Error::Unknown,
-                p_info->line_num,
-                reinterpret_cast<const char*>(p_info->p_file_name));
+                Error::makeSite(
+                    reinterpret_cast<const char*>(p_info->p_file_name),
+                    p_info->line_num));
             break;
         }
 #endif
@@ -13,6 +13,10 @@
 
 #include "PatternsPort.h"
 
+#include <AL_CrashLog.h>
+#include <AL_Trace.h>
+#include <Error.h>
+
 #include "nrf_log.h"
 #include "nrf_log_ctrl.h"
 #include "nrf_sdh.h"
@@ -37,19 +41,46 @@ void Port::logInfo(const char* const str)
     NRF_LOG_FLUSH();
 }
 
-void Port::logError(const char* const fileName,
-                    uint32_t          lineNumber,
-                    const char* const errorDescription)
+void Port::logError(uint32_t site, const char* const errorDescription)
 {
-    NRF_LOG_ERROR("%s:%u:\t%s", fileName, lineNumber, errorDescription);
+    NRF_LOG_ERROR("site 0x%08X (line %u):\t%s",
+                  site,
+                  Error::getSiteLine(site),
+                  errorDescription);
     NRF_LOG_FINAL_FLUSH();
 }
 
+void Port::traceError(uint32_t code, uint32_t site)
+{
+    TRACE_EVENT(RTOS::Trace::ErrorCheck,
+                (code << 16) | (Error::getSiteLine(site) & 0xFFFF));
+}
+
+void Port::saveCrash(uint32_t code, uint32_t site)
+{
+    Diagnostics::CrashLog::save(static_cast<Error::Code>(code), site);
+}
+
 void Port::disableInterrupts()
 {
     __disable_irq();
 }
 
+uint32_t Port::getCycleCount()
+{
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0) {
+        // enabled on first use
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    return DWT->CYCCNT;
+}
+
+uint32_t Port::getCycleCountHz()
+{
+    return SystemCoreClock;
+}
+
 void Port::faultBreakpoint()
 {
     NRF_BREAKPOINT_COND;
@@ -0,0 +1,92 @@
+/**
+ * @file RunTimeCounter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief run time counter for FreeRTOS run time stats on nRF52
+ *
+ * @details RTC2 runs on the low frequency clock, which is running anyway for
+ * the SoftDevice and the FreeRTOS tick (RTC0 and RTC1). So profiling does not
+ * keep the high frequency clock alive the way a TIMER would.
+ * The 24bit counter is extended to 32bit in software. The overflow event is
+ * checked every time the counter is read, which happens at least on every
+ * context switch. Only if no context switch happens for more than 512 s an
+ * overflow gets lost.
+ *
+ * @version 1.0
+ * @date 2020-10-26
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <FreeRTOS.h>
+#include <nrf_rtc.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** RTC instance not used by SoftDevice (RTC0) and FreeRTOS (RTC1) */
+static NRF_RTC_Type* const kRunTimeRtc = NRF_RTC2;
+
+/** width of the RTC counter */
+static constexpr uint32_t kCounterBits = 24;
+
+static_assert(configRUN_TIME_COUNTER_HZ == 32768,
+              "RTC2 runs without prescaler");
+
+//------------------------------- PROTOTYPES ----------------------------------
+
+//---------------------------- STATIC VARIABLES -------------------------------
+
+/** upper 8bit of the run time counter */
+static uint32_t overflows = 0;
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Starts RTC2 without prescaler.
+ * Called by FreeRTOS when the scheduler gets started.
+ *
+ */
+extern "C" void rtosRunTimeCounterInit(void)
+{
+    nrf_rtc_prescaler_set(kRunTimeRtc, 0);
+    nrf_rtc_event_enable(kRunTimeRtc, RTC_EVTEN_OVRFLW_Msk);
+    nrf_rtc_event_clear(kRunTimeRtc, NRF_RTC_EVENT_OVERFLOW);
+    nrf_rtc_task_trigger(kRunTimeRtc, NRF_RTC_TASK_CLEAR);
+    nrf_rtc_task_trigger(kRunTimeRtc, NRF_RTC_TASK_START);
+}
+
+/**
+ * @brief Get the current run time counter value.
+ * Called by FreeRTOS on every context switch, from task and ISR context.
+ *
+ * @return uint32_t 32768 Hz counter, wraps after roughly 36 hours.
+ */
+extern "C" uint32_t rtosRunTimeCounterGet(void)
+{
+    auto mask = portSET_INTERRUPT_MASK_FROM_ISR();
+
+    if (nrf_rtc_event_pending(kRunTimeRtc, NRF_RTC_EVENT_OVERFLOW)) {
+        nrf_rtc_event_clear(kRunTimeRtc, NRF_RTC_EVENT_OVERFLOW);
+        ++overflows;
+    }
+    uint32_t counter = nrf_rtc_counter_get(kRunTimeRtc);
+    // overflow might have happened right after the check
+    if (nrf_rtc_event_pending(kRunTimeRtc, NRF_RTC_EVENT_OVERFLOW)) {
+        nrf_rtc_event_clear(kRunTimeRtc, NRF_RTC_EVENT_OVERFLOW);
+        ++overflows;
+        counter = nrf_rtc_counter_get(kRunTimeRtc);
+    }
+
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(mask);
+    return (overflows << kCounterBits) | counter;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
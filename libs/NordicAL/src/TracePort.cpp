@@ -0,0 +1,86 @@
+/**
+ * @file TracePort.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief timestamps of RTOS::Trace on nRF52
+ *
+ * @details TIMER4 counts at 1 MHz with 32 bit. Other than the DWT cycle
+ * counter it keeps running while the CPU sleeps in WFE or tickless idle, so
+ * idle gaps show up with their real length. It wraps after 71 minutes, the
+ * converter unwraps as long as no two consecutive records are further apart
+ * than half of that. While tracing is enabled the timer keeps the 1 MHz
+ * peripheral clock running during sleep.
+ *
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_Trace.h>
+#include <nrf.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** timer of the timestamps, not used by the SoftDevice */
+#define TRACE_TIMER NRF_TIMER4
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Starts TIMER4 at 1 MHz.
+ * Called whenever tracing gets enabled, the timer keeps running.
+ *
+ */
+extern "C" void rtosTraceTimestampInit(void)
+{
+    static bool isStarted = false;
+    if (isStarted) {
+        return;
+    }
+    TRACE_TIMER->MODE        = TIMER_MODE_MODE_Timer;
+    TRACE_TIMER->BITMODE     = TIMER_BITMODE_BITMODE_32Bit;
+    TRACE_TIMER->PRESCALER   = 4;  // 16 MHz / 2^4
+    TRACE_TIMER->TASKS_CLEAR = 1;
+    TRACE_TIMER->TASKS_START = 1;
+    isStarted                = true;
+}
+
+/**
+ * @brief Get the microseconds since tracing was enabled first.
+ *
+ * @details Capture and read are not interrupted, so a nested ISR capturing
+ * in between does not hand an earlier caller its later time. Interrupts are
+ * only masked for the two register accesses.
+ *
+ * @return uint32_t configTRACE_TIMESTAMP_HZ counter
+ */
+extern "C" uint32_t rtosTraceTimestampGet(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    TRACE_TIMER->TASKS_CAPTURE[0] = 1;
+    uint32_t timestamp            = TRACE_TIMER->CC[0];
+    __set_PRIMASK(primask);
+    return timestamp;
+}
+
+/**
+ * @brief Get the number of the active exception.
+ *
+ * @return uint32_t IRQn + 16, 0 in thread mode
+ */
+extern "C" uint32_t rtosTraceIsrNumber(void)
+{
+    return __get_IPSR();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,56 @@
+/**
+ * @file BenchParsedAdvData.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmark of the advertisement parser
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHPARSEDADVDATA_H__
+#define __BENCHPARSEDADVDATA_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Bench
+{
+class ParsedAdvData;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <BenchCase.h>
+#include <ParsedAdvData.h>
+#include <array>
+
+namespace Bench
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief parsing a full advertisement with flags, manufacturer data and
+ * name, as done by the scanner for every report
+ */
+class ParsedAdvData : public Case {
+public:
+    // delete default constructors
+    ParsedAdvData(const ParsedAdvData& other) = delete;
+    ParsedAdvData& operator=(const ParsedAdvData& other) = delete;
+
+    static ParsedAdvData& getInstance();
+
+private:
+    ParsedAdvData();
+    virtual void runBatch(uint16_t batch) final;
+
+    /** raw advertisement of 31 bytes */
+    static const std::array<uint8_t, 31> kRawData;
+
+    static ParsedAdvData instance;
+};
+}  // namespace Bench
+#endif  //__BENCHPARSEDADVDATA_H__
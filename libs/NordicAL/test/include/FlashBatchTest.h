@@ -0,0 +1,59 @@
+/**
+ * @file FlashBatchTest.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief tests queued flash writes with IO::Flash::Batch
+ * @version 1.0
+ * @date 2020-11-21
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHBATCHTEST_H__
+#define __FLASHBATCHTEST_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test::IOFlash
+{
+class Batch;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_FlashBatch.h>
+#include <AL_FlashCollection.h>
+#include <TestBase.h>
+
+namespace Test::IOFlash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief tests queued flash writes with IO::Flash::Batch
+ */
+class Batch : public Test::Base {
+public:
+    // delete default constructors
+    Batch(const Batch& other) = delete;
+    Batch& operator=(const Batch& other) = delete;
+
+    static Batch& getInstance();
+
+private:
+    Batch();
+
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+
+    static void onWritten(Error::Code result, void* context);
+
+    IO::Flash::Collection<uint32_t> collection;
+
+    /** singleton instance */
+    static Batch instance;
+};
+}  // namespace Test::IOFlash
+#endif  //__FLASHBATCHTEST_H__
@@ -0,0 +1,59 @@
+/**
+ * @file FlashCachedRecordTest.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for a flash record with RAM cache
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHCACHEDRECORDTEST_H__
+#define __FLASHCACHEDRECORDTEST_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test::IOFlash
+{
+class CachedRecord;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_FlashCachedRecord.h>
+#include <TestBase.h>
+
+namespace Test::IOFlash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for a flash record with RAM cache
+ */
+class CachedRecord : public Test::Base {
+public:
+    // delete default constructors
+    CachedRecord(const CachedRecord& other) = delete;
+    CachedRecord& operator=(const CachedRecord& other) = delete;
+
+    static CachedRecord& getInstance();
+
+private:
+    CachedRecord();
+
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+
+    IO::Flash::File                   file;
+    IO::Flash::CachedRecord<uint32_t> cached;
+    /** same record without cache, writes past the cache */
+    IO::Flash::Record<uint32_t> uncached;
+
+    /** singleton instance */
+    static CachedRecord instance;
+};
+}  // namespace Test::IOFlash
+#endif  //__FLASHCACHEDRECORDTEST_H__
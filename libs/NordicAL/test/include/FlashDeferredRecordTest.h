@@ -0,0 +1,59 @@
+/**
+ * @file FlashDeferredRecordTest.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for a flash record that holds back writes
+ * @version 1.0
+ * @date 2020-11-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHDEFERREDRECORDTEST_H__
+#define __FLASHDEFERREDRECORDTEST_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test::IOFlash
+{
+class DeferredRecord;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_FlashDeferredRecord.h>
+#include <TestBase.h>
+
+namespace Test::IOFlash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for a flash record that holds back writes
+ */
+class DeferredRecord : public Test::Base {
+public:
+    // delete default constructors
+    DeferredRecord(const DeferredRecord& other) = delete;
+    DeferredRecord& operator=(const DeferredRecord& other) = delete;
+
+    static DeferredRecord& getInstance();
+
+private:
+    DeferredRecord();
+
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+
+    IO::Flash::File                     file;
+    IO::Flash::DeferredRecord<uint32_t> deferred;
+    /** same record without deferring, reads what is in flash */
+    IO::Flash::Record<uint32_t> direct;
+
+    /** singleton instance */
+    static DeferredRecord instance;
+};
+}  // namespace Test::IOFlash
+#endif  //__FLASHDEFERREDRECORDTEST_H__
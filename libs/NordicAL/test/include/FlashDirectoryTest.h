@@ -0,0 +1,78 @@
+/**
+ * @file FlashDirectoryTest.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the RAM index of flash files
+ * @version 1.0
+ * @date 2020-11-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHDIRECTORYTEST_H__
+#define __FLASHDIRECTORYTEST_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test::IOFlash
+{
+class Directory;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_FlashRecord.h>
+#include <FlashDirectory.h>
+#include <TestBase.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace Test::IOFlash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the RAM index of flash files
+ */
+class Directory : public Test::Base {
+public:
+    // delete default constructors
+    Directory(const Directory& other) = delete;
+    Directory& operator=(const Directory& other) = delete;
+
+    static Directory& getInstance();
+
+private:
+    Directory();
+
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+
+    void testCreate();
+    void testCollision();
+    void testOverflow();
+    void testCorrupted();
+
+    static Error::Code rebuild();
+    static uint16_t    getLowestFreeId();
+    static size_t      getFreeEntries();
+    static Error::Code corrupt(uint16_t fileId);
+
+    IO::Flash::File             fileA;
+    IO::Flash::File             fileB;
+    IO::Flash::File             collisionA;
+    IO::Flash::File             collisionB;
+    IO::Flash::File             corrupted;
+    IO::Flash::Record<uint32_t> valueA;
+    IO::Flash::Record<uint32_t> valueB;
+    IO::Flash::Record<uint32_t> collisionValueA;
+    IO::Flash::Record<uint32_t> collisionValueB;
+    IO::Flash::Record<uint32_t> corruptedValue;
+
+    /** singleton instance */
+    static Directory instance;
+};
+}  // namespace Test::IOFlash
+#endif  //__FLASHDIRECTORYTEST_H__
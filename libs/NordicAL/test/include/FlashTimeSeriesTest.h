@@ -0,0 +1,60 @@
+/**
+ * @file FlashTimeSeriesTest.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the compressed sample log in flash
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FLASHTIMESERIESTEST_H__
+#define __FLASHTIMESERIESTEST_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test::IOFlash
+{
+class TimeSeries;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <AL_FlashTimeSeries.h>
+#include <TestBase.h>
+
+namespace Test::IOFlash
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the compressed sample log in flash
+ */
+class TimeSeries : public Test::Base {
+public:
+    // delete default constructors
+    TimeSeries(const TimeSeries& other) = delete;
+    TimeSeries& operator=(const TimeSeries& other) = delete;
+
+    static TimeSeries& getInstance();
+
+private:
+    TimeSeries();
+
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+
+    void testEqualTimes();
+
+    static int16_t getValue(uint32_t index);
+
+    IO::Flash::TimeSeries<int16_t, 4> series;
+
+    /** singleton instance */
+    static TimeSeries instance;
+};
+}  // namespace Test::IOFlash
+#endif  //__FLASHTIMESERIESTEST_H__
@@ -0,0 +1,65 @@
+/**
+ * @file BenchParsedAdvData.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmark of the advertisement parser
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchParsedAdvData.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Bench::ParsedAdvData Bench::ParsedAdvData::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+const std::array<uint8_t, 31> Bench::ParsedAdvData::kRawData = {
+    // flags
+    0x02, 0x01, 0x06,
+    // manufacturer specific data, aconno company ID and 14 bytes
+    0x11, 0xFF, 0x59, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    // complete local name
+    0x08, 0x09, 'S', 'e', 'n', 's', 'o', 'r', '1'};
+
+/** keeps the compiler from dropping results */
+static volatile size_t sink = 0;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Bench::ParsedAdvData::ParsedAdvData() : Case("BLE", "ParsedAdvData.parse", 8)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+Bench::ParsedAdvData& Bench::ParsedAdvData::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Bench::ParsedAdvData::runBatch(uint16_t batch)
+{
+    size_t parsed = 0;
+    for (uint16_t i = 0; i < batch; i++) {
+        IO::BLE::ParsedAdvData data {};
+        if (IO::BLE::ParsedAdvData::parseRawData(data,
+                                                 kRawData.data(),
+                                                 kRawData.size()) ==
+            Error::None) {
+            parsed += data.manufacturerData.size() + data.name.size();
+        }
+    }
+    sink = parsed;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
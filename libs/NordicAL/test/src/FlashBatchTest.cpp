@@ -0,0 +1,102 @@
+/**
+ * @file FlashBatchTest.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief tests queued flash writes with IO::Flash::Batch
+ * @version 1.0
+ * @date 2020-11-21
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashBatchTest.h"
+
+#include "FlashCollectionTest.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::IOFlash::Batch Test::IOFlash::Batch::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::IOFlash::Batch::Batch()
+        : Test::Base("IO::Flash", "Batch"), collection("testBatch")
+{}
+
+Test::IOFlash::Batch& Test::IOFlash::Batch::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief execution of test
+ *
+ */
+void Test::IOFlash::Batch::runInternal()
+{
+    constexpr uint32_t kSamples = 10;
+
+    assert(Error::None == collection.clear(), "failed to flush collection");
+
+    // burst longer than the queue
+    IO::Flash::Batch batch {};
+    for (uint32_t i = 0; i < kSamples; i++) {
+        assert(Error::None == collection.add(i, batch.next()),
+               "failed to queue sample %u",
+               i);
+    }
+    assert(Error::None == batch.await(), "queued write failed");
+    assert(Error::None == batch.await(), "await of empty batch failed");
+    assert(collection.size() == kSamples,
+           "%u samples instead of %u",
+           static_cast<unsigned>(collection.size()),
+           kSamples);
+
+    // completion callback and reuse of a pending
+    uint32_t           written = 0;
+    IO::Flash::Pending pending {};
+    assert(Error::None == pending.setCallback(&onWritten, &written),
+           "failed to set callback");
+    for (uint32_t i = 0; i < 2; i++) {
+        assert(Error::None == collection.add(kSamples + i, pending),
+               "failed to queue write");
+    }
+    assert(Error::None == pending.await(), "queued write failed");
+    assert(pending.isDone() && !pending.isQueued(), "pending not finished");
+    assert(written == 2, "callback called %u times instead of 2", written);
+    assert(pending.getRecordId() != 0, "no record id of written record");
+
+    assert(Error::None == collection.clear(), "failed to flush collection");
+}
+
+/**
+ * @brief batches are built on collections
+ *
+ */
+const std::list<Test::Base*> Test::IOFlash::Batch::getPrerequisits()
+{
+    return std::list<Base*>({&Collection::getInstance()});
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief counts finished writes, runs in the flash event handler.
+ *
+ */
+void Test::IOFlash::Batch::onWritten(Error::Code result, void* context)
+{
+    if (result == Error::None) {
+        (*static_cast<uint32_t*>(context))++;
+    }
+}
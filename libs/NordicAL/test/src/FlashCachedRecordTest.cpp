@@ -0,0 +1,91 @@
+/**
+ * @file FlashCachedRecordTest.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for a flash record with RAM cache
+ * @version 1.0
+ * @date 2020-11-19
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashCachedRecordTest.h"
+
+#include "FlashRecordTest.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::IOFlash::CachedRecord Test::IOFlash::CachedRecord::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::IOFlash::CachedRecord::CachedRecord()
+        : Test::Base("IO::Flash", "CachedRecord"),
+          file("CachedTest"), cached {"interval", file},
+          uncached {"interval", file}
+{}
+
+Test::IOFlash::CachedRecord& Test::IOFlash::CachedRecord::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief execution of test
+ *
+ */
+void Test::IOFlash::CachedRecord::runInternal()
+{
+    using Cache = IO::Flash::RecordCache;
+
+    assert(Error::None == file.clear(), "failed to flush flash file");
+
+    uint32_t value = 0;
+    assert(Error::NotFound == cached.tryGet(value),
+           "found record in empty file");
+
+    assert(Error::None == cached.trySet(500), "failed to set value");
+    uint32_t hits   = Cache::getHits();
+    uint32_t misses = Cache::getMisses();
+    assert(Error::None == cached.tryGet(value) && value == 500,
+           "got %u instead of 500",
+           value);
+    assert(Cache::getHits() == hits + 1 && Cache::getMisses() == misses,
+           "written value not served from RAM");
+
+    // writing past the cache drops the cached copy
+    assert(Error::None == uncached.trySet(750), "failed to set uncached");
+    assert(Error::None == cached.tryGet(value) && value == 750,
+           "stale value %u after uncached write",
+           value);
+    assert(Cache::getMisses() == misses + 1, "stale value not read again");
+    assert(Error::None == cached.tryGet(value) && value == 750 &&
+               Cache::getHits() == hits + 2,
+           "value not cached after miss");
+
+    // clearing the file drops its values
+    assert(Error::None == file.clear(), "failed to flush flash file");
+    assert(Error::NotFound == cached.tryGet(value),
+           "cleared value still cached");
+}
+
+/**
+ * @brief cached records are built on plain ones
+ *
+ */
+const std::list<Test::Base*> Test::IOFlash::CachedRecord::getPrerequisits()
+{
+    return std::list<Base*>({&Record::getInstance()});
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
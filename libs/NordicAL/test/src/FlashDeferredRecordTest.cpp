@@ -0,0 +1,119 @@
+/**
+ * @file FlashDeferredRecordTest.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for a flash record that holds back writes
+ * @version 1.0
+ * @date 2020-11-22
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashDeferredRecordTest.h"
+
+#include "FlashRecordTest.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::IOFlash::DeferredRecord Test::IOFlash::DeferredRecord::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** values held back before writing */
+static constexpr uint32_t kMaxUpdates = 3;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::IOFlash::DeferredRecord::DeferredRecord()
+        : Test::Base("IO::Flash", "DeferredRecord"), file("DeferredTest"),
+          deferred {"counter", file, 60 * 1000, kMaxUpdates},
+          direct {"counter", file}
+{}
+
+Test::IOFlash::DeferredRecord& Test::IOFlash::DeferredRecord::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief execution of test
+ *
+ */
+void Test::IOFlash::DeferredRecord::runInternal()
+{
+    using Base = IO::Flash::DeferredRecordBase;
+
+    assert(Error::None == file.clear(), "failed to flush flash file");
+    assert(Error::None == direct.trySet(1), "failed to set start value");
+
+    // equal value is not written
+    uint32_t avoided = Base::getWritesAvoided();
+    uint32_t writes  = Base::getWrites();
+    assert(Error::None == deferred.trySet(1), "failed to set equal value");
+    assert(!deferred.isDirty() && Base::getWritesAvoided() == avoided + 1,
+           "equal value not skipped");
+
+    // held back until kMaxUpdates values were set
+    uint32_t value = 0;
+    for (uint32_t i = 2; i < 1 + kMaxUpdates; i++) {
+        assert(Error::None == deferred.trySet(i), "failed to set %u", i);
+    }
+    assert(deferred.isDirty(), "value not held back");
+    assert(Error::None == deferred.tryGet(value) && value == kMaxUpdates,
+           "held back value %u not returned",
+           value);
+    assert(Error::None == direct.tryGet(value) && value == 1,
+           "held back value already in flash");
+
+    assert(Error::None == deferred.trySet(1 + kMaxUpdates),
+           "failed to set last value");
+    assert(!deferred.isDirty() && Base::getWrites() == writes + 1,
+           "values not written after %u updates",
+           kMaxUpdates);
+    assert(Error::None == direct.tryGet(value) && value == 1 + kMaxUpdates,
+           "flash holds %u",
+           value);
+
+    // flushing all writes the last one
+    assert(Error::None == deferred.trySet(100), "failed to set value");
+    assert(Error::None == Base::flushAll(), "failed to flush");
+    assert(Error::None == direct.tryGet(value) && value == 100,
+           "flushed value not in flash");
+    assert(Base::getWritesAvoided() == avoided + kMaxUpdates,
+           "%u writes avoided instead of %u",
+           Base::getWritesAvoided() - avoided,
+           kMaxUpdates);
+
+    // without a file, tryFlushAll() does not wait but leaves it to a task
+    assert(Error::None == file.clear(), "failed to flush flash file");
+    assert(Error::None == deferred.trySet(200), "failed to set value");
+    bool isFlushed = Base::tryFlushAll();
+    assert(!isFlushed, "file created without waiting");
+    for (size_t i = 0; i < 100 && !isFlushed; i++) {
+        RTOS::ITask::delayCurrentTask(10);
+        isFlushed = Base::tryFlushAll();
+    }
+    assert(isFlushed && Error::None == direct.tryGet(value) && value == 200,
+           "flush task did not write the value");
+
+    assert(Error::None == file.clear(), "failed to flush flash file");
+}
+
+/**
+ * @brief deferred records are built on plain ones
+ *
+ */
+const std::list<Test::Base*> Test::IOFlash::DeferredRecord::getPrerequisits()
+{
+    return std::list<Base*>({&Record::getInstance()});
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
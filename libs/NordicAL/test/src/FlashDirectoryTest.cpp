@@ -0,0 +1,328 @@
+/**
+ * @file FlashDirectoryTest.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the RAM index of flash files
+ * @version 1.0
+ * @date 2020-11-24
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashDirectoryTest.h"
+
+#include "FlashRecordTest.h"
+#include "fds.h"
+#include "nrf_fstorage.h"
+#include "nrf_fstorage_sd.h"
+
+#include <AL_ITask.h>
+#include <ScopeExit.h>
+#include <cstdint>
+#include <cstdio>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::IOFlash::Directory Test::IOFlash::Directory::instance {};
+
+/** directory under test, the test class shadows its name */
+using FlashDirectory = IO::Flash::Directory;
+
+/** writes to flash behind the back of FDS, to corrupt a record */
+NRF_FSTORAGE_DEF(nrf_fstorage_t corrupter) = {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** names with the same FNV-1a hash */
+static constexpr const char* kCollidingNameA = "dir0528ab";
+static constexpr const char* kCollidingNameB = "dir099978";
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::IOFlash::Directory::Directory()
+        : Test::Base("IO::Flash", "Directory"), fileA("dirTestA"),
+          fileB("dirTestB"), collisionA(kCollidingNameA),
+          collisionB(kCollidingNameB), corrupted("dirTestC"),
+          valueA("value", fileA), valueB("value", fileB),
+          collisionValueA("value", collisionA),
+          collisionValueB("value", collisionB),
+          corruptedValue("value", corrupted)
+{}
+
+Test::IOFlash::Directory& Test::IOFlash::Directory::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief execution of test
+ *
+ */
+void Test::IOFlash::Directory::runInternal()
+{
+    assert(Error::None == fileA.clear() && Error::None == fileB.clear() &&
+               Error::None == collisionA.clear() &&
+               Error::None == collisionB.clear() &&
+               Error::None == corrupted.clear(),
+           "failed to clear test files");
+
+    // start from a fresh scan, earlier tests may have left it partial
+    assert(Error::None == rebuild(), "failed to scan flash");
+    assert(FlashDirectory::State::Complete == FlashDirectory::state,
+           "flash holds files the directory can not index");
+
+    testCreate();
+    testCollision();
+    testOverflow();
+    testCorrupted();
+
+    assert(Error::None == fileA.clear() && Error::None == fileB.clear() &&
+               Error::None == collisionA.clear() &&
+               Error::None == collisionB.clear() &&
+               Error::None == corrupted.clear(),
+           "failed to clear test files");
+    assert(Error::None == rebuild(), "failed to scan flash");
+}
+
+/**
+ * @brief directory is filled by records
+ *
+ */
+const std::list<Test::Base*> Test::IOFlash::Directory::getPrerequisits()
+{
+    return std::list<Base*>({&Record::getInstance()});
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief files are indexed on create, forgotten on clear and a new file
+ * gets the lowest free id.
+ *
+ */
+void Test::IOFlash::Directory::testCreate()
+{
+    assert(Error::None == valueA.trySet(1), "failed to create file A");
+    assert(Error::None == valueB.trySet(2), "failed to create file B");
+
+    uint16_t idA = 0;
+    uint16_t idB = 0;
+    assert(Error::None == FlashDirectory::find(fileA.getName(), idA),
+           "file A not indexed");
+    assert(Error::None == FlashDirectory::find(fileB.getName(), idB),
+           "file B not indexed");
+    assert(idA != idB, "files A and B share id %u", idA);
+
+    assert(Error::None == fileA.clear(), "failed to clear file A");
+    uint16_t id = 0;
+    assert(Error::NotFound == FlashDirectory::find(fileA.getName(), id),
+           "cleared file still indexed");
+
+    uint16_t lowest = getLowestFreeId();
+    assert(lowest <= idA, "id %u of cleared file not free", idA);
+    assert(Error::None == valueA.trySet(1), "failed to re-create file A");
+    assert(Error::None == FlashDirectory::find(fileA.getName(), idA),
+           "re-created file A not indexed");
+    assert(idA == lowest, "file got id %u instead of %u", idA, lowest);
+}
+
+/**
+ * @brief a name whose hash is taken is not in the table, it is searched in
+ * flash instead.
+ *
+ */
+void Test::IOFlash::Directory::testCollision()
+{
+    assert(FlashDirectory::getHash(kCollidingNameA) ==
+               FlashDirectory::getHash(kCollidingNameB),
+           "names do not collide");
+
+    assert(Error::None == collisionValueA.trySet(3),
+           "failed to create first colliding file");
+    assert(Error::None == collisionValueB.trySet(4),
+           "failed to create second colliding file");
+    assert(FlashDirectory::State::Partial == FlashDirectory::state,
+           "collision not noticed");
+
+    uint16_t id = 0;
+    assert(Error::None == FlashDirectory::find(kCollidingNameA, id),
+           "first colliding file not indexed");
+    assert(Error::Unknown == FlashDirectory::find(kCollidingNameB, id),
+           "second colliding file resolved to the first");
+
+    // fresh objects, so the id is not known already
+    IO::Flash::File             lookup {kCollidingNameB};
+    IO::Flash::Record<uint32_t> lookupValue {"value", lookup};
+    uint32_t                    value = 0;
+    assert(Error::None == lookupValue.tryGet(value) && value == 4,
+           "second colliding file not found in flash");
+
+    assert(Error::None == rebuild(), "failed to scan flash");
+}
+
+/**
+ * @brief once more than kMaxFiles are known, missing names have to be
+ * searched in flash.
+ *
+ */
+void Test::IOFlash::Directory::testOverflow()
+{
+    size_t freeEntries = getFreeEntries();
+
+    // untracked ids and no descriptor, nothing is written to flash
+    char name[16];
+    for (size_t i = 0; i <= freeEntries; ++i) {
+        snprintf(name, sizeof(name), "dirFill%02u", static_cast<unsigned>(i));
+        FlashDirectory::add(name, FlashDirectory::kTrackedIds + i, 0);
+        if (i < freeEntries) {
+            assert(FlashDirectory::State::Complete == FlashDirectory::state,
+                   "partial after %u of %u files",
+                   static_cast<unsigned>(i + 1),
+                   static_cast<unsigned>(freeEntries));
+        }
+    }
+    assert(FlashDirectory::State::Partial == FlashDirectory::state,
+           "not partial past %u files",
+           static_cast<unsigned>(FlashDirectory::kMaxFiles));
+
+    uint16_t id = 0;
+    assert(Error::Unknown == FlashDirectory::find("dirMissing", id),
+           "missing file reported as not existing");
+
+    // forget the fake entries
+    assert(Error::None == rebuild(), "failed to scan flash");
+    assert(Error::NotFound == FlashDirectory::find("dirMissing", id),
+           "missing file not reported after scan");
+}
+
+/**
+ * @brief a record failing its checksum does not stop the scan, its file
+ * is searched in flash instead.
+ *
+ */
+void Test::IOFlash::Directory::testCorrupted()
+{
+    assert(Error::None == corruptedValue.trySet(5),
+           "failed to create corrupted file");
+    uint16_t fileId = 0;
+    assert(Error::None == FlashDirectory::find(corrupted.getName(), fileId),
+           "corrupted file not indexed");
+    assert(Error::None == corrupt(fileId), "failed to corrupt a record");
+
+    assert(Error::None == rebuild(), "scan stopped at corrupted record");
+    assert(FlashDirectory::State::Partial == FlashDirectory::state,
+           "corrupted record not noticed");
+    assert(FlashDirectory::isUsed(fileId), "id of corrupted record free");
+
+    uint16_t id = 0;
+    assert(Error::None == FlashDirectory::find(fileA.getName(), id),
+           "other files not indexed");
+    assert(Error::None == FlashDirectory::find(corrupted.getName(), id) &&
+               id == fileId,
+           "descriptor of corrupted file not indexed");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Zero the first word of a record of the file, but not of its
+ * descriptor. The checksum does not match afterwards.
+ *
+ */
+Error::Code Test::IOFlash::Directory::corrupt(uint16_t fileId)
+{
+    uint32_t descriptorId = 0;
+    {
+        CHECK_ERROR(FlashDirectory::getMutex().tryObtain());
+        auto mutexReleaser =
+            Patterns::make_scopeExit(&RTOS::Mutex::tryRelease,
+                                     FlashDirectory::getMutex());
+        for (auto& entry : FlashDirectory::getTable()) {
+            if (entry.value.fileId == fileId) {
+                descriptorId = entry.value.descriptorId;
+            }
+        }
+    }
+
+    fds_record_desc_t descriptor = {0};
+    fds_find_token_t  token      = {0};
+    do {
+        if (fds_record_find_in_file(fileId, &descriptor, &token) !=
+            FDS_SUCCESS) {
+            return Error::NotFound;
+        }
+    } while (descriptor.record_id == descriptorId);
+
+    fds_flash_record_t record = {0};
+    if (fds_record_open(&descriptor, &record) != FDS_SUCCESS) {
+        return Error::ChecksumFailed;
+    }
+    auto word    = static_cast<const volatile uint32_t*>(record.p_data);
+    auto address = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(word));
+    fds_record_close(&descriptor);
+
+    // flash bits can always be cleared, no erase needed
+    static uint32_t zero = 0;
+    corrupter.start_addr = address;
+    corrupter.end_addr   = address + sizeof(zero);
+    if (nrf_fstorage_init(&corrupter, &nrf_fstorage_sd, nullptr) !=
+            NRF_SUCCESS ||
+        nrf_fstorage_write(&corrupter, address, &zero, sizeof(zero), nullptr) !=
+            NRF_SUCCESS) {
+        return Error::Internal;
+    }
+    while (nrf_fstorage_is_busy(&corrupter)) {
+        RTOS::ITask::delayCurrentTask(10);
+    }
+
+    return (*word == 0) ? Error::None : Error::Internal;
+}
+
+/**
+ * @brief Scan flash again, dropping what the test entered.
+ *
+ */
+Error::Code Test::IOFlash::Directory::rebuild()
+{
+    CHECK_ERROR(FlashDirectory::getMutex().tryObtain());
+    auto mutexReleaser = Patterns::make_scopeExit(&RTOS::Mutex::tryRelease,
+                                                  FlashDirectory::getMutex());
+
+    return FlashDirectory::build();
+}
+
+/**
+ * @brief Lowest id the next new file will get.
+ *
+ */
+uint16_t Test::IOFlash::Directory::getLowestFreeId()
+{
+    CHECK_ERROR(FlashDirectory::getMutex().tryObtain());
+    auto mutexReleaser = Patterns::make_scopeExit(&RTOS::Mutex::tryRelease,
+                                                  FlashDirectory::getMutex());
+
+    uint16_t id = 0;
+    while (id < FlashDirectory::kTrackedIds && FlashDirectory::isUsed(id)) {
+        ++id;
+    }
+    return id;
+}
+
+/**
+ * @brief Files that can be added before the table is full.
+ *
+ */
+size_t Test::IOFlash::Directory::getFreeEntries()
+{
+    CHECK_ERROR(FlashDirectory::getMutex().tryObtain());
+    auto mutexReleaser = Patterns::make_scopeExit(&RTOS::Mutex::tryRelease,
+                                                  FlashDirectory::getMutex());
+
+    return FlashDirectory::kMaxFiles - FlashDirectory::getTable().size();
+}
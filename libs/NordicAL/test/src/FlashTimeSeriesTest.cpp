@@ -0,0 +1,168 @@
+/**
+ * @file FlashTimeSeriesTest.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the compressed sample log in flash
+ * @version 1.0
+ * @date 2020-11-23
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "FlashTimeSeriesTest.h"
+
+#include "FlashCollectionTest.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::IOFlash::TimeSeries Test::IOFlash::TimeSeries::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** samples fitting into three pages */
+static constexpr uint32_t kSamples = 150;
+/** time of the first sample */
+static constexpr uint32_t kStart = 1000;
+/** time between samples */
+static constexpr uint32_t kInterval = 60;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::IOFlash::TimeSeries::TimeSeries()
+        : Test::Base("IO::Flash", "TimeSeries"), series("testSeries")
+{}
+
+Test::IOFlash::TimeSeries& Test::IOFlash::TimeSeries::getInstance()
+{
+    return instance;
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief execution of test
+ *
+ */
+void Test::IOFlash::TimeSeries::runInternal()
+{
+    assert(Error::None == series.clear(), "failed to clear series");
+
+    for (uint32_t i = 0; i < kSamples; i++) {
+        assert(Error::None ==
+                   series.append(kStart + i * kInterval, getValue(i)),
+               "failed to append sample %u",
+               i);
+    }
+    assert(Error::InvalidParameter == series.append(kStart, 0),
+           "older sample appended");
+
+    // unflushed samples are read from RAM
+    uint32_t count = 0;
+    for (auto sample : series.all()) {
+        assert(sample.time == kStart + count * kInterval &&
+                   sample.value == getValue(count),
+               "sample %u read wrong",
+               count);
+        count++;
+    }
+    assert(count == kSamples, "read %u samples instead of %u", count, kSamples);
+
+    // a Collection would need a record per sample
+    assert(Error::None == series.flush(), "failed to flush series");
+    assert(series.getPageCount() <= 3,
+           "%u pages for %u samples",
+           static_cast<unsigned>(series.getPageCount()),
+           kSamples);
+
+    // range
+    count = 0;
+    for (auto sample : series.range(kStart + 50 * kInterval,
+                                    kStart + 59 * kInterval)) {
+        assert(sample.time == kStart + (50 + count) * kInterval,
+               "sample out of range");
+        count++;
+    }
+    assert(count == 10, "%u samples in range instead of 10", count);
+
+    // oldest pages are dropped
+    for (uint32_t i = kSamples; i < 3 * kSamples; i++) {
+        assert(Error::None ==
+                   series.append(kStart + i * kInterval, getValue(i)),
+               "failed to append sample %u",
+               i);
+    }
+    assert(Error::None == series.flush(), "failed to flush series");
+    assert(series.getPageCount() == 4,
+           "%u pages instead of 4",
+           static_cast<unsigned>(series.getPageCount()));
+    auto oldest = series.all().begin();
+    assert(oldest != series.all().end() && (*oldest).time > kStart,
+           "oldest samples not dropped");
+
+    assert(Error::None == series.clear(), "failed to clear series");
+    assert(!(series.all().begin() != series.all().end()),
+           "samples left after clear");
+
+    testEqualTimes();
+}
+
+/**
+ * @brief time series are files like collections
+ *
+ */
+const std::list<Test::Base*> Test::IOFlash::TimeSeries::getPrerequisits()
+{
+    return std::list<Base*>({&Collection::getInstance()});
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief samples with the same time spanning a page boundary are all found.
+ *
+ */
+void Test::IOFlash::TimeSeries::testEqualTimes()
+{
+    static constexpr uint32_t kTime = kStart + kInterval;
+
+    assert(Error::None == series.clear(), "failed to clear series");
+    assert(Error::None == series.append(kStart, getValue(0)),
+           "failed to append first sample");
+    for (uint32_t i = 0; i < kSamples; i++) {
+        assert(Error::None == series.append(kTime, getValue(i)),
+               "failed to append sample %u at equal time",
+               i);
+    }
+    assert(Error::None == series.flush(), "failed to flush series");
+    assert(series.getPageCount() >= 2,
+           "equal times did not span a page boundary");
+
+    uint32_t count = 0;
+    for (auto sample : series.range(kTime, kTime)) {
+        assert(sample.time == kTime && sample.value == getValue(count),
+               "sample %u at equal time read wrong",
+               count);
+        count++;
+    }
+    assert(count == kSamples,
+           "%u samples at equal time instead of %u",
+           count,
+           kSamples);
+
+    assert(Error::None == series.clear(), "failed to clear series");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief slowly changing value like a temperature in centi degree.
+ *
+ */
+int16_t Test::IOFlash::TimeSeries::getValue(uint32_t index)
+{
+    return static_cast<int16_t>(2150 + (index % 7) - 3);
+}
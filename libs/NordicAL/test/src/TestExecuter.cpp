@@ -14,6 +14,7 @@
 #include "TestExecuter.h"
 
 #include "AL_Log.h"
+#include "BenchCase.h"
 #include "TestBase.h"
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
@@ -52,6 +53,7 @@ void Test::TestExecuter::onStart()
 void Test::TestExecuter::onRun()
 {
     Test::Base::runAllTests();
+    Bench::Case::runAll();
     task.suspend();
 }
 
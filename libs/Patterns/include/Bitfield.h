@@ -16,7 +16,13 @@
 
 #include <Endians.h>
 #include <Error.h>
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace Endians
 {
@@ -27,21 +33,106 @@ namespace Endians
 namespace
 {
 /**
-     * @brief Copies the source bit from source byte to destination bit in destination byte
-     * 
-     * @param dest Reference to destination byte to write to
-     * @param destPosition Bit in destination byte to write to
-     * @param src Source byte to read from
-     * @param srcPosition Bit in SourceByte to read from
-     */
-void copyBit(uint8_t& dest, size_t destPosition, uint8_t src, size_t srcPosition)
+ * @brief Mask of the lowest size bits.
+ * 
+ */
+constexpr uint64_t lowMask(size_t size)
+{
+    return (size >= 64) ? ~uint64_t(0) : ((uint64_t(1) << size) - 1);
+}
+
+/**
+ * @brief Reverse the order of the lowest size bits, all others are dropped.
+ * 
+ */
+constexpr uint64_t reverseBits(uint64_t value, size_t size)
+{
+    value = ((value >> 1) & 0x5555555555555555ull) |
+            ((value & 0x5555555555555555ull) << 1);
+    value = ((value >> 2) & 0x3333333333333333ull) |
+            ((value & 0x3333333333333333ull) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0Full) |
+            ((value & 0x0F0F0F0F0F0F0F0Full) << 4);
+    return __builtin_bswap64(value) >> (64 - size);
+}
+
+/**
+ * @brief Reverse the order of the lowest bytes bytes, all others are dropped.
+ * 
+ */
+template<size_t bytes>
+constexpr uint64_t swapBytes(uint64_t value)
 {
-    if ((src & (1u << srcPosition)) != 0) {
-        // bit set in src, set in dest
-        dest |= (1u << destPosition);
+    if constexpr (bytes == 8) {
+        return __builtin_bswap64(value);
+    } else if constexpr (bytes == 4) {
+        return __builtin_bswap32(static_cast<uint32_t>(value));
+    } else if constexpr (bytes == 2) {
+        return __builtin_bswap16(static_cast<uint16_t>(value));
     } else {
-        // bit not set in src, unset in dest
-        dest &= ~(1u << destPosition);
+        return value & 0xFF;
+    }
+}
+
+/**
+ * @brief Read bytes bytes as one word, data[0] is the least significant.
+ * 
+ */
+template<size_t bytes>
+constexpr uint64_t loadLittle(const uint8_t* data)
+{
+    uint64_t word = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        word |= uint64_t(data[i]) << (8 * i);
+    }
+    return word;
+}
+
+/**
+ * @brief Read bytes bytes as one word, data[0] is the most significant.
+ * 
+ */
+template<size_t bytes>
+constexpr uint64_t loadBig(const uint8_t* data)
+{
+    uint64_t word = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+        word = (word << 8) | data[i];
+    }
+    return word;
+}
+
+/**
+ * @brief Replace the bits in mask of a single byte.
+ * 
+ */
+constexpr void storeByte(uint8_t& data, uint64_t word, uint64_t mask)
+{
+    data = static_cast<uint8_t>((data & ~mask) | (word & mask));
+}
+
+/**
+ * @brief Write the bits in mask of word, data[0] is the least significant.
+ * 
+ */
+template<size_t bytes>
+constexpr void storeLittle(uint8_t* data, uint64_t word, uint64_t mask)
+{
+    for (size_t i = 0; i < bytes; ++i) {
+        storeByte(data[i], word >> (8 * i), mask >> (8 * i));
+    }
+}
+
+/**
+ * @brief Write the bits in mask of word, data[0] is the most significant.
+ * 
+ */
+template<size_t bytes>
+constexpr void storeBig(uint8_t* data, uint64_t word, uint64_t mask)
+{
+    for (size_t i = 0; i < bytes; ++i) {
+        auto shift = 8 * (bytes - 1 - i);
+        storeByte(data[i], word >> shift, mask >> shift);
     }
 }
 }  // namespace
@@ -124,66 +215,70 @@ template<class T,
                                        std::is_enum<T>::value,
                                    int> = 0>
 struct Bitfield {
+    static_assert(sizeof(T) <= sizeof(uint64_t),
+                  "Bitfields are handled in a 64 bit word");
+
+    /** type of the value in the Bitfield */
+    using Type = T;
+
+    /** bytes from the start of the data up to the end of the Bitfield */
+    static constexpr size_t kBytes = (position + size + 7) / 8;
+
     /**
      * @brief Get the value of a bitfield out of a byte array
      * 
+     * @details All bytes covering the field are read as one word, in the
+     * order given by peripheralOrder. The field then is a single shift and
+     * mask away. Only a fieldOrder differing from peripheralOrder needs the
+     * field bits reversed.
+     * 
      * @tparam arraySize size of the data array
      * @tparam byteOffset=0 offset in bytes to read the Bitfield from. (So it can also be read out of a stream or bigger array).
      * @param data data array received from peripheral. Must be at least arraySize long.
      * @return T Value of the Bitfield in data.
      */
     template<size_t arraySize, size_t byteOffset = 0>
-    static T get(const uint8_t* data)
+    static constexpr T get(const uint8_t* data)
     {
         static_assert(position + size + (8 * byteOffset) <= 8 * arraySize,
                       "Bitfield getter out of boundries");
         static_assert(sizeof(T) * 8 >= size,
                       "Bitfield size too big for chosen data type");
 
-        T              result {};
-        auto           ref         = reinterpret_cast<uint8_t*>(&result);
-        constexpr auto startBitSrc = position + (8 * byteOffset);
-        constexpr auto endBitSrc   = startBitSrc + size;
-        for (size_t desBit = 0; desBit < size; ++desBit) {
-            size_t srcBit;
-            // srcBit counts left to right when fieldOrder is inversed
-            if (fieldOrder == BitOrder::LSBAtZero) {
-                srcBit = desBit + startBitSrc;
-            } else {
-                srcBit = endBitSrc - desBit - 1;
+        const uint8_t* src  = data + byteOffset + kFirstByte;
+        uint64_t       bits = 0;
+        if constexpr (peripheralOrder == BitOrder::LSBAtZero) {
+            bits = loadLittle<kWordBytes>(src) >> kStart;
+            if constexpr (kSpanBytes > 8) {
+                bits |= uint64_t(src[8]) << (64 - kStart);
             }
-
-            auto srcByte = srcBit / 8;
-            srcBit %= 8;
-
-            // read the other way around from data array if peripheral order is inversed
-            if (peripheralOrder == BitOrder::MSBAtZero) {
-                srcBit = 7 - srcBit;
-            }
-            copyBit(ref[desBit / 8], desBit % 8, data[srcByte], srcBit);
+        } else if constexpr (kSpanBytes > 8) {
+            bits = (loadBig<kWordBytes>(src) << (8 - kTail)) |
+                   (src[8] >> kTail);
+        } else {
+            bits = loadBig<kWordBytes>(src) >> kTail;
+        }
+        bits &= lowMask(size);
+        if constexpr (fieldOrder != peripheralOrder) {
+            bits = reverseBits(bits, size);
         }
 
         // compensate for 2's complement
-        if (std::is_signed<T>::value &&
-            (ref[(size - 1) / 8] & (1u << ((size - 1) % 8)))) {
-            // highest bit is set, inverse all bits above it
-            for (size_t desBit = size; desBit < (8 * sizeof(T)); ++desBit) {
-                ref[desBit / 8] |= (1u << (desBit % 8));
-            }
+        if (std::is_signed<T>::value && (bits & (uint64_t(1) << (size - 1)))) {
+            bits |= ~lowMask(size);
         }
 
-        if (endianess == Endians::ByteOrder::big) {
-            Endians::bigToMachine(result);
-        } else {
-            Endians::littleToMachine(result);
+        if constexpr (endianess == Endians::ByteOrder::big) {
+            bits = swapBytes<sizeof(T)>(bits);
         }
-
-        return result;
+        return fromWord(bits);
     }
 
     /**
      * @brief Set the bitfield value within the data array.
      * 
+     * @details Mirrors get(), only the bits of the field are changed in data.
+     * 
      * @tparam arraySize Size of the data array.
      * @tparam byteOffset=0 Offset in data to write to. In Bytes.
      * @param data Data array to write to. Must be at least arraySize long.
@@ -192,40 +287,39 @@ struct Bitfield {
      * @return Error::Code Can return Error::TooLarge when biggest bit of value is higher than size of the Bitfield.
      */
     template<size_t arraySize, size_t byteOffset = 0>
-    static Error::Code set(uint8_t* data, T value)
+    static constexpr Error::Code set(uint8_t* data, T value)
     {
         static_assert(position + size + (8 * byteOffset) <= 8 * arraySize,
                       "Bitfield getter out of boundries");
         static_assert(sizeof(T) * 8 >= size,
                       "Bitfield size too big for chosen data type");
 
-        if (endianess == Endians::ByteOrder::big) {
-            Endians::machineToBig(value);
-        } else {
-            Endians::machineToLittle(value);
+        uint64_t bits = toWord(value);
+        if constexpr (endianess == Endians::ByteOrder::big) {
+            bits = swapBytes<sizeof(T)>(bits);
+        }
+        bits &= lowMask(size);
+        if constexpr (fieldOrder != peripheralOrder) {
+            bits = reverseBits(bits, size);
         }
-        auto ref = reinterpret_cast<const uint8_t*>(&value);
-
-        // copy bitwise
-        constexpr auto startBitDes = position + (8 * byteOffset);
-        constexpr auto endBitDes   = startBitDes + size;
-        for (size_t srcBit = 0; srcBit < size; ++srcBit) {
-            size_t desBit;
-            // srcBit counts left to right when fieldOrder is inversed
-            if (fieldOrder == BitOrder::LSBAtZero) {
-                desBit = srcBit + startBitDes;
-            } else {
-                desBit = endBitDes - srcBit - 1;
-            }
-
-            auto desByte = desBit / 8;
-            desBit %= 8;
 
-            if (peripheralOrder == BitOrder::MSBAtZero) {
-                desBit = 7 - desBit;
+        uint8_t* des = data + byteOffset + kFirstByte;
+        if constexpr (peripheralOrder == BitOrder::LSBAtZero) {
+            storeLittle<kWordBytes>(des,
+                                    bits << kStart,
+                                    lowMask(size) << kStart);
+            if constexpr (kSpanBytes > 8) {
+                storeByte(des[8],
+                          bits >> (64 - kStart),
+                          lowMask(size) >> (64 - kStart));
             }
-
-            copyBit(data[desByte], desBit, ref[srcBit / 8], srcBit % 8);
+        } else if constexpr (kSpanBytes > 8) {
+            storeBig<kWordBytes>(des,
+                                 bits >> (8 - kTail),
+                                 lowMask(size) >> (8 - kTail));
+            storeByte(des[8], bits << kTail, lowMask(size) << kTail);
+        } else {
+            storeBig<kWordBytes>(des, bits << kTail, lowMask(size) << kTail);
         }
 
         return Error::None;
@@ -239,7 +333,7 @@ struct Bitfield {
      * @param data data byte containing the Bitfield
      * @return T value of the Bitfield in given data
      */
-    static T get(uint8_t data) { return get<1, 0>(&data); }
+    static constexpr T get(uint8_t data) { return get<1, 0>(&data); }
 
     /**
      * @brief Get the value of a bitfield out of a byte array
@@ -250,7 +344,7 @@ struct Bitfield {
      * @return T Value of the Bitfield in data.
      */
     template<size_t arraySize, size_t byteOffset = 0>
-    static T get(const std::array<uint8_t, arraySize>& data)
+    static constexpr T get(const std::array<uint8_t, arraySize>& data)
     {
         return get<arraySize, byteOffset>(data.data());
     }
@@ -263,7 +357,7 @@ struct Bitfield {
      * 
      * @return Error::Code Can return Error::TooLarge when biggest bit of value is higher than size of the Bitfield.
      */
-    static Error::Code set(uint8_t& data, T value)
+    static constexpr Error::Code set(uint8_t& data, T value)
     {
         return set<1, 0>(&data, value);
     }
@@ -279,10 +373,143 @@ struct Bitfield {
      * @return Error::Code Can return Error::TooLarge when biggest bit of value is higher than size of the Bitfield.
      */
     template<size_t arraySize, size_t byteOffset = 0>
-    static Error::Code set(std::array<uint8_t, arraySize>& data, T value)
+    static constexpr Error::Code set(std::array<uint8_t, arraySize>& data,
+                                     T                               value)
     {
         return set<arraySize, byteOffset>(data.data(), value);
     }
+
+private:
+    /** first byte touched by the field, relative to byteOffset */
+    static constexpr size_t kFirstByte = position / 8;
+    /** first bit of the field within the first byte */
+    static constexpr size_t kStart = position % 8;
+    /** bytes touched by the field, up to 9 for an unaligned 64 bit field */
+    static constexpr size_t kSpanBytes = (kStart + size + 7) / 8;
+    /** bytes loaded as one word, the 9th byte is handled on its own */
+    static constexpr size_t kWordBytes = (kSpanBytes > 8) ? 8 : kSpanBytes;
+    /** unused bits behind the field in the last byte */
+    static constexpr size_t kTail = 8 * kSpanBytes - kStart - size;
+
+    /**
+     * @brief value of the Bitfield from its machine independent bit pattern
+     * 
+     */
+    static constexpr T fromWord(uint64_t word)
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            using Raw = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            auto raw  = static_cast<Raw>(word);
+            T    result {};
+            std::memcpy(&result, &raw, sizeof(T));
+            return result;
+        } else if constexpr (std::is_enum<T>::value) {
+            return static_cast<T>(
+                static_cast<std::underlying_type_t<T>>(word));
+        } else {
+            return static_cast<T>(word);
+        }
+    }
+
+    /**
+     * @brief machine independent bit pattern of a value
+     * 
+     */
+    static constexpr uint64_t toWord(T value)
+    {
+        if constexpr (std::is_floating_point<T>::value) {
+            using Raw = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            Raw raw {};
+            std::memcpy(&raw, &value, sizeof(T));
+            return raw;
+        } else if constexpr (std::is_enum<T>::value) {
+            return static_cast<uint64_t>(
+                static_cast<std::underlying_type_t<T>>(value));
+        } else {
+            return static_cast<uint64_t>(value);
+        }
+    }
+};
+
+/**
+ * @brief Decodes or encodes a whole register block of a peripheral.
+ * 
+ * @details A sensor is usually read with a single burst over I2C, this
+ * helper then splits the block into all its Bitfields at once and builds
+ * the block for a burst write the other way around.
+ * 
+ * @example Status and 12 bit temperature of a sensor in two bytes:
+ * using Ready = Endians::Bitfield<bool, 7, 1>;
+ * using Temperature = Endians::Bitfield<int16_t,
+ *                                        8,
+ *                                        12,
+ *                                        Endians::BitOrder::MSBAtZero,
+ *                                        Endians::BitOrder::MSBAtZero>;
+ * using Registers = Endians::RegisterMap<Ready, Temperature>;
+ * 
+ * Registers::Block block {};
+ * CHECK_ERROR(i2c.read(kStatusRegister, block));
+ * auto [ready, temperature] = Registers::decode(block);
+ * 
+ * @tparam Fields Bitfields in the block, positions relative to its start.
+ */
+template<class... Fields>
+struct RegisterMap {
+    static_assert(sizeof...(Fields) > 0, "register block without fields");
+
+    /** bytes of the register block */
+    static constexpr size_t kSize = std::max({Fields::kBytes...});
+
+    using Block  = std::array<uint8_t, kSize>;
+    using Values = std::tuple<typename Fields::Type...>;
+
+    /**
+     * @brief Get the values of all Bitfields.
+     * 
+     * @param block Register block as read from the peripheral.
+     * @return Values One value per Bitfield, in order of Fields.
+     */
+    static constexpr Values decode(const Block& block)
+    {
+        return Values {Fields::template get<kSize>(block.data())...};
+    }
+
+    /**
+     * @brief Set all Bitfields, bits of the block not covered stay unchanged.
+     * 
+     * @param block Register block to write to.
+     * @param values One value per Bitfield, in order of Fields.
+     */
+    static constexpr void encode(Block& block, const Values& values)
+    {
+        encode(block, values, std::index_sequence_for<Fields...> {});
+    }
+
+    /**
+     * @brief Build a register block, bits not covered by Fields are zero.
+     * 
+     * @param values One value per Bitfield, in order of Fields.
+     * @return Block Register block to write to the peripheral.
+     */
+    static constexpr Block encode(const Values& values)
+    {
+        Block block {};
+        encode(block, values);
+        return block;
+    }
+
+private:
+    template<size_t... indices>
+    static constexpr void encode(Block&        block,
+                                 const Values& values,
+                                 std::index_sequence<indices...>)
+    {
+        // Bitfield::set() can not fail
+        (static_cast<void>(Fields::template set<kSize>(
+             block.data(),
+             std::get<indices>(values))),
+         ...);
+    }
 };
 }  // namespace Endians
 #endif  //__BITFIELD_H__
\ No newline at end of file
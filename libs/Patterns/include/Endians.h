@@ -31,6 +31,8 @@
 
 //--------------------------------- INCLUDES ----------------------------------
 
+#include <cstddef>
+
 namespace Endians
 {
 //-------------------------------- CONSTANTS ----------------------------------
@@ -58,6 +60,9 @@ constexpr void bigToMachine(T& val);
 
 template <class T>
 constexpr void littleToMachine(T& val);
+
+template <class T>
+void swapArray(T* data, size_t count);
 }  // namespace Endians
 
 #include "../src/Endians.cpp"
@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <type_traits>
 
 //-------------------------------- CONSTANTS ----------------------------------
 
@@ -25,13 +26,16 @@
 
 #include <string.h>
 
-#define __FILENAME__ \
-    (strrchr(__FILE__, '/') ? strrchr(__FILE__, '/') + 1 : __FILE__)
+/**
+ * @brief File and line of the current source position as 32 bit site ID.
+ * Evaluated at compile time, no file name ends up in the binary.
+ *
+ */
+#define ERROR_SITE                    \
+    (std::integral_constant<uint32_t, \
+                            Error::makeSite(__FILE__, __LINE__)>::value)
 
-#define CHECK_ERROR(err)                                  \
-    Error::internalCheck(err,                             \
-                         static_cast<uint32_t>(__LINE__), \
-                         static_cast<const char* const>(__FILENAME__))
+#define CHECK_ERROR(err) Error::internalCheck(err, ERROR_SITE)
 
 /**
  * @brief Macro that checks an error code and returns the current function if an error occured.
@@ -96,6 +100,11 @@ public:
         Count
     };
 
+    /** bits of a site ID holding the line, the file hash is above */
+    static constexpr uint32_t kSiteLineBits = 12;
+    /** mask of the line in a site ID, longer files share the last line */
+    static constexpr uint32_t kSiteLineMask = (1u << kSiteLineBits) - 1;
+
     /**
      * @brief tests an error code.
      * If code is anything else than success, restarts.
@@ -103,9 +112,55 @@ public:
      * @warning do not directly use. Use CHECK_ERROR() instead.
      * 
      * @param code 
+     * @param site where the check failed, see makeSite()
+     */
+    static void internalCheck(Code code, uint32_t site);
+
+    /**
+     * @brief Hash of the file name of a path, without the directories.
+     * FNV-1a, folded to the bits left over by the line.
+     *
+     * @param path usually __FILE__
+     * @return constexpr uint32_t hash in the lower 32 - kSiteLineBits bits
+     */
+    static constexpr uint32_t hashFileName(const char* path)
+    {
+        const char* name = path;
+        for (const char* c = path; *c != '\0'; c++) {
+            if (*c == '/' || *c == '\\') {
+                name = c + 1;
+            }
+        }
+
+        uint32_t hash = 2166136261u;
+        for (; *name != '\0'; name++) {
+            hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;
+        }
+        return (hash ^ (hash >> (32 - kSiteLineBits))) >> kSiteLineBits;
+    }
+
+    /**
+     * @brief Packs file and line into a 32 bit site ID.
+     * tools/ErrorSites maps IDs back to file:line.
+     *
+     * @param path usually __FILE__
+     * @param line usually __LINE__
      */
-    static void
-        internalCheck(Code code, uint32_t lineNumber, const char* fileName);
+    static constexpr uint32_t makeSite(const char* path, uint32_t line)
+    {
+        if (line > kSiteLineMask) {
+            line = kSiteLineMask;
+        }
+        return (hashFileName(path) << kSiteLineBits) | line;
+    }
+
+    /**
+     * @brief line of a site ID, see makeSite()
+     */
+    static constexpr uint32_t getSiteLine(uint32_t site)
+    {
+        return site & kSiteLineMask;
+    }
 
     /**
      * @brief Get the Description string for the given error code.
@@ -0,0 +1,247 @@
+/**
+ * @file Fsm.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief table driven hierarchical state machine
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __FSM_H__
+#define __FSM_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Patterns
+{
+/**
+ * @brief entry, exit or transition action, executed within the context.
+ *
+ */
+template<class Context>
+using FsmAction = void (Context::*)();
+
+template<class Definition>
+class Fsm;
+}  // namespace Patterns
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace Patterns
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+/**
+ * @brief row of the state table of a Fsm.
+ *
+ * @details State::Count as parent marks a top level state, as initial a
+ * leaf state.
+ *
+ */
+template<class Context, class State>
+struct FsmState {
+    State              state; /**< row number, states are listed in order */
+    State              parent; /**< enclosing state */
+    State              initial; /**< sub state entered after this one */
+    FsmAction<Context> entry; /**< called when entering, may be nullptr */
+    FsmAction<Context> exit; /**< called when leaving, may be nullptr */
+};
+
+/**
+ * @brief row of the transition table of a Fsm.
+ *
+ * @details State::Count as target marks an internal transition, it only
+ * calls the action without leaving the current state.
+ *
+ */
+template<class Context, class State, class Event>
+struct FsmTransition {
+    State              from; /**< state, or enclosing state, handling event */
+    Event              event; /**< event triggering the transition */
+    State              to; /**< target state */
+    FsmAction<Context> action; /**< called between exit and entry */
+};
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Hierarchical state machine, declared by constexpr tables.
+ *
+ * @details Definition describes the machine:
+ * @code
+ * struct SensorMachine {
+ *     using Context = Sensor;
+ *     enum class State : uint8_t { Idle, Active, Measuring, Reading, Count };
+ *     enum class Event : uint8_t { Start, Stop, Timeout, DataReady, Count };
+ *
+ *     static constexpr State kInitial = State::Idle;
+ *     static constexpr Patterns::FsmState<Sensor, State> states[] = {
+ *         {State::Idle, State::Count, State::Count, nullptr, nullptr},
+ *         {State::Active, State::Count, State::Measuring,
+ *          &Sensor::powerUp, &Sensor::powerDown},
+ *         {State::Measuring, State::Active, State::Count,
+ *          &Sensor::trigger, nullptr},
+ *         {State::Reading, State::Active, State::Count,
+ *          &Sensor::read, nullptr}};
+ *     static constexpr Patterns::FsmTransition<Sensor, State, Event>
+ *         transitions[] = {
+ *             {State::Idle, Event::Start, State::Active, nullptr},
+ *             {State::Active, Event::Stop, State::Idle, nullptr},
+ *             {State::Measuring, Event::DataReady, State::Reading, nullptr},
+ *             {State::Reading, Event::Timeout, State::Measuring, nullptr}};
+ * };
+ * @endcode
+ *
+ * A state without a transition for an event passes it on to its enclosing
+ * state, so Stop leaves Measuring as well as Reading. This is resolved at
+ * compile time into a table of State::Count x Event::Count, dispatch() is a
+ * single lookup.
+ *
+ * Transitions are external: all states up to the closest state enclosing
+ * both source and target are left and entered again. Entering a state with
+ * an initial sub state continues into that one.
+ *
+ * @warning Not thread safe and not reentrant, actions must not call
+ * dispatch(). Use RTOS::FsmTask to queue events from other tasks and ISRs.
+ *
+ * @tparam Definition see above. States are listed in order of their value.
+ */
+template<class Definition>
+class Fsm {
+public:
+    using Context = typename Definition::Context;
+    using State   = typename Definition::State;
+    using Event   = typename Definition::Event;
+
+private:
+    static constexpr size_t kStates = static_cast<size_t>(State::Count);
+    static constexpr size_t kEvents = static_cast<size_t>(Event::Count);
+    static constexpr size_t kTransitions = std::size(Definition::transitions);
+
+    /** State::Count, no state at all */
+    static constexpr State kNone = State::Count;
+    /** entry in kDispatch of unhandled events */
+    static constexpr uint8_t kUnhandled = 0xFF;
+
+    static_assert(std::size(Definition::states) == kStates,
+                  "every state needs a row in the state table");
+    static_assert(kTransitions < kUnhandled, "too many transitions");
+
+    /** enclosing state per state */
+    static constexpr auto kParent = []() {
+        std::array<State, kStates> parents {};
+        for (size_t i = 0; i < kStates; i++) {
+            parents[i] = Definition::states[i].parent;
+        }
+        return parents;
+    }();
+
+    static constexpr bool kIsTree = []() {
+        for (size_t i = 0; i < kStates; i++) {
+            const auto& row = Definition::states[i];
+            if (row.state != static_cast<State>(i)) {
+                return false;
+            }
+            if (row.initial != kNone &&
+                kParent[static_cast<size_t>(row.initial)] != row.state) {
+                return false;
+            }
+            // a loop in the parents never reaches the top
+            size_t depth = 0;
+            for (State state = row.state; state != kNone;
+                 state       = kParent[static_cast<size_t>(state)]) {
+                if (++depth > kStates) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }();
+
+    static_assert(kIsTree, "state table is not in order or not a tree");
+
+    /** transition handling an event per state, kUnhandled for none */
+    static constexpr auto kDispatch = []() {
+        std::array<std::array<uint8_t, kEvents>, kStates> table {};
+        for (size_t state = 0; state < kStates; state++) {
+            for (size_t event = 0; event < kEvents; event++) {
+                table[state][event] = kUnhandled;
+                // innermost state handling the event wins
+                for (State owner = static_cast<State>(state);
+                     owner != kNone && table[state][event] == kUnhandled;
+                     owner = kParent[static_cast<size_t>(owner)]) {
+                    for (size_t i = 0; i < kTransitions; i++) {
+                        const auto& transition = Definition::transitions[i];
+                        if (transition.from == owner &&
+                            transition.event == static_cast<Event>(event)) {
+                            table[state][event] = static_cast<uint8_t>(i);
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        return table;
+    }();
+
+    /**
+     * closest state enclosing both source and target per transition,
+     * kNone if that is the top or for internal transitions
+     */
+    static constexpr auto kCommonParent = []() {
+        std::array<State, kTransitions> parents {};
+        for (size_t i = 0; i < kTransitions; i++) {
+            const auto& transition = Definition::transitions[i];
+            State       common     = kNone;
+            if (transition.to != kNone) {
+                common = kParent[static_cast<size_t>(transition.from)];
+                while (common != kNone) {
+                    State outer = kParent[static_cast<size_t>(transition.to)];
+                    while (outer != kNone && outer != common) {
+                        outer = kParent[static_cast<size_t>(outer)];
+                    }
+                    if (outer == common) {
+                        break;
+                    }
+                    common = kParent[static_cast<size_t>(common)];
+                }
+            }
+            parents[i] = common;
+        }
+        return parents;
+    }();
+
+public:
+    // delete default constructors
+    Fsm()                 = delete;
+    Fsm(const Fsm& other) = delete;
+    Fsm& operator=(const Fsm& other) = delete;
+
+    Fsm(Context& context);
+
+    Error::Code start();
+    Error::Code dispatch(Event event);
+    State       getState() const;
+    bool        isIn(State state) const;
+
+private:
+    void call(FsmAction<Context> action);
+    void enter(State from, State to);
+
+    Context& context; /**< passed to all actions */
+    State    current; /**< innermost active state, kNone before start() */
+};
+}  // namespace Patterns
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/Fsm.cpp"
+#endif  //__FSM_H__
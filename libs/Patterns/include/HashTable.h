@@ -0,0 +1,166 @@
+/**
+ * @file HashTable.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed capacity hash table with in place values and LRU eviction
+ * @version 1.0
+ * @date 2020-11-09
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __HASHTABLE_H__
+#define __HASHTABLE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace Collections
+{
+template<class Key, class T, size_t capacity, class HashT>
+class HashTable;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace Collections
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Hash table of up to capacity values, allocated in place.
+ *
+ * @details Values live in a fixed array of slots and never move, so they may
+ * be linked intrusively elsewhere (timers, lists). An open addressing index
+ * of twice the capacity maps keys to slots with linear probing. Lookup,
+ * insert and erase are O(1) on average, erase shifts the following index
+ * entries back instead of leaving tombstones.
+ *
+ * All values are kept in a list ordered by last use. Once the table is full,
+ * emplace() evicts the least recently used value instead of failing.
+ * Iteration visits the values from most to least recently used.
+ *
+ * @warning Not thread safe, the owner has to lock around all calls.
+ *
+ * @tparam Key default constructible, copyable and comparable with ==.
+ * @tparam T type of the values.
+ * @tparam capacity maximum number of values, less than 0xFFFF.
+ * @tparam HashT functor returning a well mixed uint32_t for a key.
+ */
+template<class Key, class T, size_t capacity, class HashT>
+class HashTable {
+    // delete default constructors
+    HashTable(const HashTable& other) = delete;
+    HashTable& operator=(const HashTable& other) = delete;
+
+    /** slot number, kNone marks empty index entries and list ends */
+    using Index = uint16_t;
+
+    static constexpr Index kNone = 0xFFFF;
+
+    static_assert(capacity > 0 && capacity < kNone,
+                  "capacity has to fit into 16 bit slot numbers");
+
+    /** index entries, the next power of two of at least twice capacity */
+    static constexpr size_t kBuckets = []() {
+        size_t buckets = 1;
+        while (buckets < 2 * capacity) {
+            buckets <<= 1;
+        }
+        return buckets;
+    }();
+
+public:
+    /**
+     * @brief iterates over all values, most recently used first.
+     *
+     */
+    class Iterator {
+        friend HashTable;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = T*;
+        using reference         = T&;
+
+        Iterator(const Iterator& other) = default;
+        Iterator& operator=(const Iterator& other) = default;
+
+        bool       operator==(const Iterator& other) const;
+        bool       operator!=(const Iterator& other) const;
+        T&         operator*() const;
+        Iterator&  operator++();
+        const Key& getKey() const;
+
+    private:
+        Iterator(HashTable& table, Index slot);
+
+        HashTable* table; /**< table iterated over */
+        Index      slot; /**< slot at the current position */
+    };
+
+    HashTable();
+    ~HashTable();
+
+    template<class... ArgsT>
+    T*          emplace(const Key& key, ArgsT&&... args);
+    T*          find(const Key& key);
+    T*          peek(const Key& key);
+    Error::Code erase(const Key& key);
+    void        clear();
+
+    size_t   size() const;
+    uint32_t getEvictions() const;
+
+    Iterator begin();
+    Iterator end();
+
+    static constexpr size_t getCapacity() { return capacity; }
+
+private:
+    /**
+     * @brief storage of a single value.
+     * While the slot is free, older links the free slots.
+     *
+     */
+    struct Slot {
+        Key   key; /**< key of the value */
+        Index newer; /**< next more recently used slot */
+        Index older; /**< next less recently used slot */
+        alignas(T) uint8_t storage[sizeof(T)]; /**< the value */
+
+        T* get();
+    };
+
+    static size_t home(const Key& key);
+
+    bool lookup(const Key& key, size_t& bucket) const;
+    void removeBucket(size_t bucket);
+    void destroy(size_t bucket);
+    void unlink(Index slot);
+    void linkNewest(Index slot);
+
+    Slot     slots[capacity]; /**< values, never move */
+    Index    buckets[kBuckets]; /**< open addressing index into slots */
+    Index    newest; /**< most recently used slot */
+    Index    oldest; /**< least recently used slot, evicted first */
+    Index    freeSlots; /**< first free slot */
+    size_t   count; /**< used slots */
+    uint32_t evictions; /**< values evicted by emplace() on a full table */
+};
+}  // namespace Collections
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/HashTable.cpp"
+#endif  //__HASHTABLE_H__
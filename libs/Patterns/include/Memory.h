@@ -0,0 +1,60 @@
+/**
+ * @file Memory.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief statistics of the heap malloc and new allocate from
+ * @version 1.0
+ * @date 2020-11-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __MEMORY_H__
+#define __MEMORY_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Tlsf.h"
+
+#include <cstddef>
+
+/**
+ * @brief access to the heap behind malloc and new.
+ *
+ * @warning Only the header file is in the Patterns library.
+ * The platform that installs the Tlsf heap implements these.
+ *
+ */
+namespace Memory
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//-------------------------------- FUNCTIONS ----------------------------------
+
+/**
+ * @brief Current usage and fragmentation of the heap.
+ *
+ * @return Stats Snapshot, taken under the heap lock.
+ */
+Stats stats();
+
+/**
+ * @brief Switch counting allocations per call site on or off.
+ *
+ * @param active true to count, see Tlsf::trackCallSites()
+ */
+void trackCallSites(bool active);
+
+/**
+ * @brief Copy out the counted call sites.
+ *
+ * @param sites Array to copy into.
+ * @param maxSites Size of sites.
+ * @return size_t Number of entries copied.
+ */
+size_t getCallSites(CallSite* sites, size_t maxSites);
+
+}  // namespace Memory
+#endif  //__MEMORY_H__
@@ -17,6 +17,8 @@ namespace Patterns
 {
 template<class... ObservableParamTypes>
 class Observable;
+template<class... Observers>
+class StaticObservable;
 }
 
 //--------------------------------- INCLUDES ----------------------------------
@@ -24,7 +26,7 @@ class Observable;
 #include "Error.h"
 #include "Observer.h"
 
-#include <forward_list>
+#include <utility>
 
 namespace Patterns
 {
@@ -35,11 +37,15 @@ namespace Patterns
 /**
  * @brief Inherit this class, to supply an observable hook.
  *
+ * @details Observers are linked intrusively, the link lives inside each
+ * Observer. Registering and unregistering is O(1) and never allocates.
+ * trigger() calls the observers in reverse order of registration, an
+ * observer may unregister itself from within handle().
+ *
  * @warning Does not implement inter process commmunication or conntext
  * switches. You can use RTOS synchronisation features in combination with this
- * to achieve that. Keep in mind, the Observable keeps a dynamic list
- * of Observers, so complexity is O(n) and also scales with Observer function
- * complexity.
+ * to achieve that. trigger() is O(n) with a virtual call per Observer, see
+ * StaticObservable for a fixed set of observers without virtual calls.
  * 
  * @tparam ObservableParamTypes type of the parameter the event observer gets
  * called with.
@@ -51,17 +57,21 @@ public:
     // constructors
 protected:
     /**
-     * @brief creates the linked list for holding handlers.
-     * It is heap alloc, to be able to dynamicly add and remove element.
+     * @brief creates an Observable without observers.
      *
      */
-    constexpr Observable() noexcept : observers() {};
+    constexpr Observable() noexcept : first(nullptr) {};
+
+    // observers point back to the Observable, it must not be copied
+    Observable(const Observable& other) = delete;
+    Observable& operator=(const Observable& other) = delete;
 
     // exposed functions
 public:
     /**
      * @brief registers a new observer that gets called, whenever this
      * Observable is triggered. Observer<> objects register themself.
+     * Already registered observers are ignored.
      *
      * @param observer
      */
@@ -84,7 +94,7 @@ private:
      * @brief start point of linked list of all observers.
      *
      */
-    std::forward_list<Observer<ObservableParamTypes...>*> observers;
+    Observer<ObservableParamTypes...>* first;
 
     // static functions
 private:
@@ -97,6 +107,39 @@ protected:
      */
     void trigger(ObservableParamTypes...);
 };
+
+/**
+ * @brief Observable with a set of observers fixed at compile time.
+ *
+ * @details trigger() calls the static function handle() of every type in
+ * Observers, in the given order. All calls are direct and can be inlined,
+ * there is no list to walk and no registration at runtime.
+ *
+ * @code
+ * struct LedBlinker {
+ *     static void handle(const IO::BLE::Device& device, int8_t rssi);
+ * };
+ * class Scanner : public Patterns::StaticObservable<LedBlinker, Uplink> {
+ *     void onAdv() { trigger(device, rssi); }
+ * };
+ * @endcode
+ *
+ * @tparam Observers types with a static handle() accepting the arguments
+ * of trigger().
+ */
+template<class... Observers>
+class StaticObservable {
+protected:
+    constexpr StaticObservable() noexcept = default;
+
+    /**
+     * @brief trigger this Observable by calling handle() of all Observers.
+     *
+     * @param params passed by reference to every observer.
+     */
+    template<class... ParamTypes>
+    static void trigger(ParamTypes&&... params);
+};
 }  // namespace Patterns
 
 // template classes need this
@@ -35,14 +35,15 @@ namespace Patterns
  *
  * @warning Does not implement inter process commmunication or conntext
  * switches. You can use RTOS synchronisation features in combination with this
- * to achieve that. Keep in mind, the Observable keeps a dynamic list
- * of Observers, so complexity is O(n) and also scales with Observer function
- * complexity.
+ * to achieve that. The Observer carries its own link in the list of the
+ * Observable, registering needs no memory.
  * 
  * @tparam ObservableParamTypes type of emitted arguments.
  */
 template<class... ObservableParamTypes>
 class Observer {
+    friend Observable<ObservableParamTypes...>;
+
     // structs and enums
 public:
     // constructors
@@ -59,6 +60,10 @@ protected:
      */
     ~Observer();
 
+    // the link must not be shared
+    Observer(const Observer& other) = delete;
+    Observer& operator=(const Observer& other) = delete;
+
     // exposed functions
 public:
     // interface
@@ -75,6 +80,10 @@ public:
     // private variables
 private:
     Observable<ObservableParamTypes...>& observable;
+    /** next observer of the same Observable */
+    Observer* next;
+    /** pointer that points here, nullptr if not registered */
+    Observer** prevNext;
 
     // private functions
 private:
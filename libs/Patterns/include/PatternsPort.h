@@ -48,13 +48,28 @@ void logInfo(const char* const str);
 /**
  * @brief forwards logging to actual implementation
  * 
- * @param line 
- * @param fileName 
+ * @param site Error site ID, see Error::makeSite()
  * @param errorDescription
  */
-void logError(const char* const fileName,
-              uint32_t          lineNumber,
-              const char* const errorDescription);
+void logError(uint32_t site, const char* const errorDescription);
+
+/**
+ * @brief records a failed error check in the trace of the platform, if any.
+ * Called before anything else happens in error handling.
+ * 
+ * @param code Error::Code that failed the check
+ * @param site Error site ID, see Error::makeSite()
+ */
+void traceError(uint32_t code, uint32_t site);
+
+/**
+ * @brief keeps a failed error check for after the restart, if the platform
+ * is able to. Called with interrupts disabled, must not block.
+ *
+ * @param code Error::Code that failed the check
+ * @param site Error site ID, see Error::makeSite()
+ */
+void saveCrash(uint32_t code, uint32_t site);
 
 /**
  * @brief disables all interrupts so error handling does not get interrupted.
@@ -62,6 +77,19 @@ void logError(const char* const fileName,
  */
 void disableInterrupts();
 
+/**
+ * @brief free running counter for benchmarks, wraps around.
+ * Counts CPU cycles where the platform is able to.
+ *
+ */
+uint32_t getCycleCount();
+
+/**
+ * @brief frequency of getCycleCount() in Hz.
+ *
+ */
+uint32_t getCycleCountHz();
+
 /**
  * @brief	Use to forcibly stop execution at a certain point.
  * 
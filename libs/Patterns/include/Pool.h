@@ -0,0 +1,183 @@
+/**
+ * @file Pool.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed block memory pools with a lock-free free list
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __POOL_H__
+#define __POOL_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace Patterns
+{
+template<size_t blockSize, size_t blockCount, size_t alignment>
+class BlockPool;
+
+template<class T, size_t count>
+class Pool;
+}  // namespace Patterns
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace Patterns
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Pool of blockCount equally sized raw memory blocks.
+ *
+ * @details Free blocks are kept in a lock-free stack (compare and swap on a
+ * tagged head index), so allocate() and free() never block, never enter a
+ * critical section and can be called from any task or ISR. Both run in
+ * constant time, the pool can not fragment.
+ *
+ * The pool counts blocks in use, the high water mark and the number of
+ * allocations that failed because the pool was exhausted. Use these to size
+ * blockCount.
+ *
+ * @warning Freeing a block twice is not detected and corrupts the pool.
+ *
+ * @tparam blockSize size of a single block in bytes
+ * @tparam blockCount number of blocks in the pool
+ * @tparam alignment alignment of every block
+ */
+template<size_t blockSize,
+         size_t blockCount,
+         size_t alignment = alignof(std::max_align_t)>
+class BlockPool {
+    static_assert(blockSize > 0, "blocks of a BlockPool can not be empty");
+    static_assert(blockCount > 0 && blockCount < 0xFFFF,
+                  "BlockPool supports 1 to 65534 blocks");
+
+public:
+    /**
+     * @brief Deleter returning a buffer to its pool, see Buffer.
+     *
+     */
+    struct Deleter {
+        BlockPool* pool;
+
+        void operator()(const void* block) const;
+    };
+
+    /**
+     * @brief Owning handle of a block, returns it to the pool when destroyed.
+     * Converts to std::unique_ptr<const uint8_t[], Deleter>.
+     *
+     */
+    using Buffer = std::unique_ptr<uint8_t[], Deleter>;
+
+    static constexpr size_t kBlockSize =
+        blockSize; /**< usable bytes of a block */
+    static constexpr size_t kBlockCount =
+        blockCount; /**< number of blocks in the pool */
+
+    // delete default constructors
+    BlockPool(const BlockPool& other) = delete;
+    BlockPool& operator=(const BlockPool& other) = delete;
+
+    BlockPool();
+
+    void*       allocate();
+    Buffer      allocateBuffer(size_t size = blockSize);
+    Error::Code free(const void* block);
+    bool        owns(const void* block) const;
+
+    size_t getUsed() const;
+    size_t getPeakUsed() const;
+    size_t getFailures() const;
+
+private:
+    /**
+     * @brief marks the end of the free list
+     *
+     */
+    static constexpr uint16_t kEnd = 0xFFFF;
+    /**
+     * @brief distance of two blocks in storage
+     *
+     */
+    static constexpr size_t kStride =
+        (blockSize + alignment - 1) / alignment * alignment;
+
+    static constexpr uint32_t pack(uint32_t tag, uint16_t index);
+
+    void countAllocation();
+
+    /**
+     * @brief the blocks handed out by the pool
+     *
+     */
+    alignas(alignment) uint8_t storage[kStride * blockCount];
+    /**
+     * @brief successor of every free block in the free list
+     *
+     */
+    std::atomic<uint16_t> next[blockCount];
+    /**
+     * @brief first free block in the lower, ABA tag in the upper 16 bits.
+     * The tag changes on every operation, so a stale compare and swap fails.
+     *
+     */
+    std::atomic<uint32_t> head;
+    std::atomic<size_t>   used; /**< blocks currently handed out */
+    std::atomic<size_t>   peakUsed; /**< highest value used ever had */
+    std::atomic<size_t>   failures; /**< allocations on an exhausted pool */
+};
+
+/**
+ * @brief Pool of count objects of type T.
+ *
+ * @details Typed front end of BlockPool. Objects are constructed in place by
+ * create() and destructed by destroy(), so the same rules for ISR usage
+ * apply as long as the constructor and destructor of T allow it.
+ *
+ * @tparam T type of the pooled objects
+ * @tparam count maximum number of objects alive at a time
+ */
+template<class T, size_t count>
+class Pool {
+public:
+    static constexpr size_t kCount =
+        count; /**< maximum number of objects alive at a time */
+
+    // delete default constructors
+    Pool(const Pool& other) = delete;
+    Pool& operator=(const Pool& other) = delete;
+
+    Pool() = default;
+
+    template<class... ArgsT>
+    T*          create(ArgsT&&... args);
+    Error::Code destroy(T* object);
+    bool        owns(const T* object) const;
+
+    size_t getUsed() const;
+    size_t getPeakUsed() const;
+    size_t getFailures() const;
+
+private:
+    BlockPool<sizeof(T), count, alignof(T)>
+        blocks; /**< raw memory of the objects */
+};
+}  // namespace Patterns
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/Pool.cpp"
+#endif  //__POOL_H__
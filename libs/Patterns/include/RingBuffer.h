@@ -0,0 +1,147 @@
+/**
+ * @file RingBuffer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief first in first out buffer with a fixed capacity
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __RINGBUFFER_H__
+#define __RINGBUFFER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace Collections
+{
+template<class T, size_t capacity>
+class RingBuffer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+namespace Collections
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Ring of up to capacity elements, stored inside the object.
+ *
+ * @details Elements are appended at the back and taken from the front.
+ * Once full, either the new element is refused (emplace_back()) or the
+ * oldest one makes room for it (emplaceOverwrite()), the latter keeps the
+ * latest capacity samples of a measurement.
+ *
+ * Iteration and operator[] go from the oldest to the newest element.
+ *
+ * @warning Not thread safe. RTOS::SpscRing and RTOS::Queue are the ones to
+ * use between tasks or with ISRs.
+ *
+ * @tparam T type of the elements.
+ * @tparam capacity maximum number of elements.
+ */
+template<class T, size_t capacity>
+class RingBuffer {
+    static_assert(capacity > 0, "empty RingBuffer is useless");
+
+    /**
+     * @brief iterates from the oldest to the newest element.
+     *
+     * @tparam ValueT T or const T.
+     */
+    template<class ValueT>
+    class BasicIterator {
+        friend RingBuffer;
+        using Owner = typename std::conditional<std::is_const<ValueT>::value,
+                                                const RingBuffer,
+                                                RingBuffer>::type;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename std::remove_const<ValueT>::type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = ValueT*;
+        using reference         = ValueT&;
+
+        BasicIterator(const BasicIterator& other) = default;
+        BasicIterator& operator=(const BasicIterator& other) = default;
+
+        bool           operator==(const BasicIterator& other) const;
+        bool           operator!=(const BasicIterator& other) const;
+        ValueT&        operator*() const;
+        ValueT*        operator->() const;
+        BasicIterator& operator++();
+
+    private:
+        BasicIterator(Owner& ring, size_t age);
+
+        Owner* ring; /**< ring iterated over */
+        size_t age; /**< position counted from the oldest element */
+    };
+
+public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using iterator        = BasicIterator<T>;
+    using const_iterator  = BasicIterator<const T>;
+
+    RingBuffer();
+    RingBuffer(const RingBuffer& other);
+    RingBuffer& operator=(const RingBuffer& other);
+    ~RingBuffer();
+
+    Error::Code push_back(const T& value);
+    template<class... ArgsT>
+    T*          emplace_back(ArgsT&&... args);
+    template<class... ArgsT>
+    T*          emplaceOverwrite(ArgsT&&... args);
+    Error::Code pop_front();
+    Error::Code popInto(T& value);
+    void        clear();
+
+    T&       operator[](size_t age);
+    const T& operator[](size_t age) const;
+    T&       front();
+    const T& front() const;
+    T&       back();
+    const T& back() const;
+
+    size_t size() const;
+    bool   empty() const;
+    bool   isFull() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    static constexpr size_t getCapacity() { return capacity; }
+
+private:
+    T*       slot(size_t age);
+    const T* slot(size_t age) const;
+
+    alignas(T) uint8_t storage[sizeof(T) * capacity]; /**< the elements */
+    size_t oldest; /**< slot of the front element */
+    size_t count; /**< elements in the ring */
+};
+}  // namespace Collections
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/RingBuffer.cpp"
+#endif  //__RINGBUFFER_H__
@@ -0,0 +1,108 @@
+/**
+ * @file StaticMap.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief sorted map with a fixed capacity and in place storage
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STATICMAP_H__
+#define __STATICMAP_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+#include <functional>
+
+namespace Collections
+{
+template<class Key, class T, size_t capacity, class CompareT = std::less<Key>>
+class StaticMap;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+#include "StaticVector.h"
+
+namespace Collections
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Map of up to capacity values, kept sorted by key in a
+ * StaticVector.
+ *
+ * @details Lookup is a binary search, O(log n). Insert and erase move the
+ * following entries, O(n), which is cheap for the small maps of settings
+ * and ids this is meant for. Iteration is in key order.
+ *
+ * Use Collections::HashTable for hundreds of entries or if values must
+ * not move.
+ *
+ * @warning Not thread safe. Pointers to values are invalidated by emplace()
+ * and erase().
+ *
+ * @tparam Key copyable and ordered by CompareT.
+ * @tparam T type of the values.
+ * @tparam capacity maximum number of values.
+ * @tparam CompareT strict weak order of the keys.
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+class StaticMap {
+public:
+    /**
+     * @brief key and value, element type of the iterators.
+     *
+     */
+    struct Entry {
+        Key key;
+        T   value;
+
+        template<class... ArgsT>
+        Entry(const Key& key, ArgsT&&... args);
+    };
+
+    using Entries         = StaticVector<Entry, capacity>;
+    using value_type      = Entry;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator        = typename Entries::iterator;
+    using const_iterator  = typename Entries::const_iterator;
+
+    template<class... ArgsT>
+    T*          emplace(const Key& key, ArgsT&&... args);
+    Error::Code insertOrAssign(const Key& key, const T& value);
+    T*          find(const Key& key);
+    const T*    find(const Key& key) const;
+    bool        contains(const Key& key) const;
+    Error::Code erase(const Key& key);
+    void        clear();
+
+    size_t size() const;
+    bool   empty() const;
+    bool   isFull() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    static constexpr size_t getCapacity() { return capacity; }
+
+private:
+    const_iterator lowerBound(const Key& key) const;
+    bool           matches(const_iterator entry, const Key& key) const;
+
+    Entries entries; /**< sorted by key */
+};
+}  // namespace Collections
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/StaticMap.cpp"
+#endif  //__STATICMAP_H__
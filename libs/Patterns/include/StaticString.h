@@ -0,0 +1,114 @@
+/**
+ * @file StaticString.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief null terminated string with a fixed capacity
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STATICSTRING_H__
+#define __STATICSTRING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace Collections
+{
+template<size_t capacity>
+class StaticString;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <cstdint>
+
+namespace Collections
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief String of up to capacity characters, stored inside the object.
+ *
+ * @details Always null terminated, c_str() can be passed to printf and
+ * logging directly. Text that does not fit is cut off at the capacity, the
+ * call returns TooLarge in that case so the caller can decide whether a
+ * shortened name is good enough.
+ *
+ * Embedded null characters are kept, size() counts them, c_str() ends at
+ * the first one.
+ *
+ * @warning Not thread safe.
+ *
+ * @tparam capacity maximum number of characters, without the terminator.
+ */
+template<size_t capacity>
+class StaticString {
+    static_assert(capacity > 0, "empty StaticString is useless");
+
+public:
+    using value_type      = char;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = char&;
+    using const_reference = const char&;
+    using iterator        = char*;
+    using const_iterator  = const char*;
+
+    StaticString();
+    StaticString(const char* text);
+
+    Error::Code assign(const char* text);
+    Error::Code assign(const char* text, size_t textLength);
+    Error::Code append(const char* text);
+    Error::Code append(const char* text, size_t textLength);
+    Error::Code push_back(char character);
+    void        clear();
+
+    char&       operator[](size_t index);
+    const char& operator[](size_t index) const;
+    const char* c_str() const;
+    char*       data();
+    const char* data() const;
+
+    size_t size() const;
+    size_t length() const;
+    bool   empty() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    static constexpr size_t getCapacity() { return capacity; }
+
+private:
+    char   characters[capacity + 1]; /**< text plus terminator */
+    size_t count; /**< characters used, without terminator */
+};
+
+template<size_t capacityA, size_t capacityB>
+bool operator==(const StaticString<capacityA>& a,
+                const StaticString<capacityB>& b);
+
+template<size_t capacity>
+bool operator==(const StaticString<capacity>& a, const char* b);
+
+template<size_t capacityA, size_t capacityB>
+bool operator!=(const StaticString<capacityA>& a,
+                const StaticString<capacityB>& b);
+
+template<size_t capacity>
+bool operator!=(const StaticString<capacity>& a, const char* b);
+}  // namespace Collections
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/StaticString.cpp"
+#endif  //__STATICSTRING_H__
@@ -0,0 +1,130 @@
+/**
+ * @file StaticVector.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief vector with a fixed capacity and in place storage
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __STATICVECTOR_H__
+#define __STATICVECTOR_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <cstddef>
+
+namespace Collections
+{
+template<class T, size_t capacity>
+class StaticVector;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <cstdint>
+#include <initializer_list>
+
+namespace Collections
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Vector of up to capacity elements, stored inside the object.
+ *
+ * @details Behaves like std::vector, but never allocates. The size of the
+ * object is known at compile time, so it can be a member, live on the
+ * stack or in a queue and RAM use shows up in the map file.
+ *
+ * Iterators are plain pointers, all algorithms of the STL work on it.
+ * Operations that would exceed the capacity fail and leave the vector
+ * untouched instead of throwing.
+ *
+ * @code
+ * Collections::StaticVector<uint8_t, 29> data {};
+ * RETURN_ON_ERROR(data.assign(raw, rawSize));
+ * std::sort(data.begin(), data.end());
+ * @endcode
+ *
+ * @warning Not thread safe.
+ *
+ * @tparam T type of the elements.
+ * @tparam capacity maximum number of elements.
+ */
+template<class T, size_t capacity>
+class StaticVector {
+    static_assert(capacity > 0, "empty StaticVector is useless");
+
+public:
+    using value_type      = T;
+    using size_type       = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using iterator        = T*;
+    using const_iterator  = const T*;
+
+    StaticVector();
+    StaticVector(std::initializer_list<T> values);
+    StaticVector(const StaticVector& other);
+    StaticVector& operator=(const StaticVector& other);
+    ~StaticVector();
+
+    Error::Code push_back(const T& value);
+    template<class... ArgsT>
+    T*          emplace_back(ArgsT&&... args);
+    template<class... ArgsT>
+    T*          emplace(const_iterator position, ArgsT&&... args);
+    Error::Code pop_back();
+    iterator    erase(const_iterator position);
+    Error::Code resize(size_t newSize);
+    Error::Code assign(const T* values, size_t valueCount);
+    void        clear();
+
+    T&       operator[](size_t index);
+    const T& operator[](size_t index) const;
+    T&       front();
+    const T& front() const;
+    T&       back();
+    const T& back() const;
+    T*       data();
+    const T* data() const;
+
+    size_t size() const;
+    bool   empty() const;
+    bool   isFull() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+
+    static constexpr size_t getCapacity() { return capacity; }
+
+private:
+    alignas(T) uint8_t storage[sizeof(T) * capacity]; /**< the elements */
+    size_t count; /**< constructed elements at the front of storage */
+};
+
+template<class T, size_t capacityA, size_t capacityB>
+bool operator==(const StaticVector<T, capacityA>& a,
+                const StaticVector<T, capacityB>& b);
+
+template<class T, size_t capacityA, size_t capacityB>
+bool operator!=(const StaticVector<T, capacityA>& a,
+                const StaticVector<T, capacityB>& b);
+}  // namespace Collections
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/StaticVector.cpp"
+#endif  //__STATICVECTOR_H__
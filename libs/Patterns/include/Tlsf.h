@@ -0,0 +1,175 @@
+/**
+ * @file Tlsf.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief two level segregated fit allocator with constant time malloc/free
+ * @version 1.0
+ * @date 2020-11-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TLSF_H__
+#define __TLSF_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Memory
+{
+class Tlsf;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Error.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Memory
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Snapshot of the state of a heap.
+ *
+ */
+struct Stats {
+    size_t   totalBytes; /**< usable bytes of the arena */
+    size_t   liveBytes; /**< bytes handed out right now */
+    size_t   peakBytes; /**< highest liveBytes ever reached */
+    size_t   freeBytes; /**< bytes in free blocks */
+    size_t   largestFreeBlock; /**< largest allocation that can succeed now */
+    uint8_t  fragmentationPercent; /**< free memory not in the largest block */
+    uint32_t liveAllocations; /**< allocations not yet freed */
+    uint32_t failedAllocations; /**< allocations that returned nullptr */
+};
+
+/**
+ * @brief Allocation counts of one call site, see Tlsf::trackCallSites().
+ *
+ */
+struct CallSite {
+    const void* address; /**< return address of the allocating call */
+    uint32_t    allocations; /**< allocations made from here */
+    uint32_t    bytes; /**< bytes requested from here in total */
+};
+
+/**
+ * @brief Two level segregated fit allocator on a fixed memory arena.
+ *
+ * @details Free blocks are sorted into size classes. The first level splits
+ * by power of two, the second level linearly into kSecondLevelCount ranges.
+ * A bitmap per level finds the smallest non empty class that fits in
+ * constant time (count leading / trailing zeros), so allocate() and free()
+ * never walk lists. Neighbouring free blocks are merged on free().
+ *
+ * Every block carries a header of two pointers, payloads are aligned to
+ * kAlignment.
+ *
+ * @warning Not thread safe, the owner has to lock around all calls.
+ */
+class Tlsf {
+public:
+    /** payload alignment and header size */
+    static constexpr size_t kAlignment = 2 * sizeof(void*);
+    /** call sites that are counted when tracking is on */
+    static constexpr size_t kMaxCallSites = 16;
+
+    // delete default constructors
+    Tlsf()                  = delete;
+    Tlsf(const Tlsf& other) = delete;
+    Tlsf& operator=(const Tlsf& other) = delete;
+
+    Tlsf(void* arena, size_t arenaBytes);
+
+    void*       allocate(size_t bytes, const void* callSite = nullptr);
+    void*       reallocate(void*       pointer,
+                           size_t      bytes,
+                           const void* callSite = nullptr);
+    Error::Code free(void* pointer);
+    size_t      usableSize(const void* pointer) const;
+    bool        owns(const void* pointer) const;
+
+    Stats  getStats() const;
+    void   trackCallSites(bool active);
+    size_t getCallSites(CallSite* sites, size_t maxSites) const;
+
+private:
+    /**
+     * @brief Header in front of every payload.
+     * nextFree and prevFree overlay the payload and are only valid while the
+     * block is free.
+     *
+     */
+    struct Block {
+        Block* prevPhys; /**< physically previous block, nullptr for first */
+        size_t sizeAndFlags; /**< payload size, lower bits hold the flags */
+        Block* nextFree; /**< next block in the same size class */
+        Block* prevFree; /**< previous block in the same size class */
+
+        size_t getSize() const;
+        void   setSize(size_t size);
+        bool   isFree() const;
+        void   setFree(bool free);
+        void*  payload();
+        Block* nextPhys();
+
+        static Block* fromPayload(const void* payload);
+    };
+
+    static constexpr size_t kHeaderSize = 2 * sizeof(void*);
+    static constexpr size_t kMinBlockSize = 2 * sizeof(void*);
+    static constexpr size_t kFreeFlag     = 1;
+
+    static constexpr unsigned kSecondLevelLog2  = 4;
+    static constexpr unsigned kSecondLevelCount = 1 << kSecondLevelLog2;
+    static constexpr unsigned kAlignmentLog2    = (sizeof(void*) == 8) ? 4 : 3;
+    static constexpr unsigned kFirstLevelShift =
+        kSecondLevelLog2 + kAlignmentLog2;
+    /** blocks below are all sorted into the first first level class */
+    static constexpr size_t kSmallBlockSize = size_t {1} << kFirstLevelShift;
+    /** largest supported block is 2^kFirstLevelMax */
+    static constexpr unsigned kFirstLevelMax   = 24;
+    static constexpr unsigned kFirstLevelCount =
+        kFirstLevelMax - kFirstLevelShift + 1;
+
+    static_assert(kHeaderSize == kAlignment,
+                  "payloads are only aligned if the header is");
+    static_assert(kFirstLevelCount <= 32, "first level bitmap is 32 bit");
+
+    static void mapInsert(size_t size, unsigned& fl, unsigned& sl);
+    static void mapSearch(size_t size, unsigned& fl, unsigned& sl);
+    static size_t adjustSize(size_t bytes);
+
+    Block* findFree(unsigned& fl, unsigned& sl) const;
+    void   insertFree(Block* block);
+    void   removeFree(Block* block);
+    void   split(Block* block, size_t size);
+    Block* mergePrev(Block* block);
+    void   mergeNext(Block* block);
+    void   countAllocation(Block* block, size_t bytes, const void* callSite);
+
+    uint8_t* const begin; /**< first block header */
+    uint8_t* const end; /**< behind the sentinel header */
+
+    uint32_t firstLevelMap; /**< bit per first level with free blocks */
+    uint32_t secondLevelMaps
+        [kFirstLevelCount]; /**< bit per second level with free blocks */
+    Block* freeLists[kFirstLevelCount]
+                    [kSecondLevelCount]; /**< heads of the size classes */
+
+    size_t   totalBytes; /**< payload bytes of the initial block */
+    size_t   freeBytes; /**< payload bytes of blocks in the free lists */
+    size_t   liveBytes; /**< payload bytes of used blocks */
+    size_t   peakBytes; /**< maximum of liveBytes */
+    uint32_t liveAllocations; /**< used blocks */
+    uint32_t failedAllocations; /**< allocations without result */
+
+    bool     trackingCallSites; /**< whether callSites is updated */
+    CallSite callSites[kMaxCallSites]; /**< counts per allocating call */
+};
+}  // namespace Memory
+#endif  //__TLSF_H__
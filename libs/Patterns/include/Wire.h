@@ -0,0 +1,126 @@
+/**
+ * @file Wire.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief serializer for packed frames with fixed byte order
+ * @version 1.0
+ * @date 2020-11-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __WIRE_H__
+#define __WIRE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+#include <Endians.h>
+#include <cstddef>
+
+namespace Wire
+{
+template<class T, Endians::ByteOrder order>
+struct Value;
+
+template<class T, size_t count, Endians::ByteOrder order>
+struct Array;
+
+template<class... Fields>
+struct Struct;
+}  // namespace Wire
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace Wire
+{
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief Single arithmetic or enum value on the wire.
+ *
+ * @tparam T type of the value.
+ * @tparam order byte order on the wire.
+ */
+template<class T, Endians::ByteOrder order>
+struct Value {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "only arithmetic and enum values can be put on the wire");
+
+    using Type = T;
+
+    /** bytes on the wire */
+    static constexpr size_t kSize = sizeof(T);
+
+    static void encode(uint8_t* buffer, const T& value);
+    static void decode(const uint8_t* buffer, T& value);
+};
+
+/**
+ * @brief Fixed number of values on the wire, each in the given byte order.
+ *
+ * @tparam T type of the elements.
+ * @tparam count number of elements.
+ * @tparam order byte order of each element on the wire.
+ */
+template<class T, size_t count, Endians::ByteOrder order>
+struct Array {
+    static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value,
+                  "only arithmetic and enum values can be put on the wire");
+
+    using Type = std::array<T, count>;
+
+    /** bytes on the wire */
+    static constexpr size_t kSize = sizeof(T) * count;
+
+    static void encode(uint8_t* buffer, const Type& values);
+    static void decode(const uint8_t* buffer, Type& values);
+};
+
+template<class T>
+using Little = Value<T, Endians::little>;
+
+template<class T>
+using Big = Value<T, Endians::big>;
+
+/** raw bytes, copied as they are */
+template<size_t count>
+using Bytes = Array<uint8_t, count, Endians::little>;
+
+/**
+ * @brief Packed frame of Fields, without any padding between them.
+ *
+ * @details Each field is written straight into the caller's buffer, in
+ * its own byte order. Offsets are known at compile time, so a frame of
+ * words compiles to a few unaligned stores with REV where needed. Nothing
+ * is allocated.
+ *
+ * @code
+ * using Frame = Wire::Struct<Wire::Little<uint8_t>,
+ *                            Wire::Little<CompanySigId>,
+ *                            Wire::Bytes<16>,
+ *                            Wire::Big<uint16_t>>;
+ * uint8_t buffer[Frame::kSize];
+ * Frame::encode(buffer, length, companyId, uuid, major);
+ * @endcode
+ *
+ * @warning buffers are not checked, they have to hold kSize bytes.
+ *
+ * @tparam Fields Wire::Value, Wire::Array or anything alike.
+ */
+template<class... Fields>
+struct Struct {
+    /** bytes of the whole frame */
+    static constexpr size_t kSize = (size_t(0) + ... + Fields::kSize);
+
+    static void encode(uint8_t* buffer, const typename Fields::Type&... values);
+    static void decode(const uint8_t* buffer, typename Fields::Type&... values);
+};
+}  // namespace Wire
+
+// template cpp needs to be included from here, not from Makefile
+#include "../src/Wire.cpp"
+#endif  //__WIRE_H__
@@ -15,6 +15,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
 #include <type_traits>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
@@ -38,19 +40,72 @@ auto is_iterable_impl(int) -> decltype(
 template <typename T>
 std::false_type is_iterable_impl(...);
 
+template <typename T>
+auto is_contiguous_impl(int)
+    -> decltype(std::data(std::declval<T&>()),
+                std::size(std::declval<T&>()),
+                std::true_type{});
+
+template <typename T>
+std::false_type is_contiguous_impl(...);
+
+/** unsigned integer with the same size as T */
+template <class T>
+using Word = std::conditional_t<
+    sizeof(T) == 2,
+    uint16_t,
+    std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+
+/**
+ * @brief Swap with a single instruction (REV, REV16 on Cortex-M).
+ *
+ */
+constexpr uint16_t bswap(uint16_t val)
+{
+    return __builtin_bswap16(val);
+}
+
+constexpr uint32_t bswap(uint32_t val)
+{
+    return __builtin_bswap32(val);
+}
+
+constexpr uint64_t bswap(uint64_t val)
+{
+    return __builtin_bswap64(val);
+}
 }  // namespace detail
 
 template <typename T>
 using is_iterable = decltype(detail::is_iterable_impl<T>(0));
 
+template <typename T>
+using is_contiguous = decltype(detail::is_contiguous_impl<T>(0));
+
 template <class T>
 constexpr
     typename std::enable_if<!is_iterable<T>::value && !std::is_array<T>::value,
                             void>::type
     swap(T& val)
 {
-    auto ptr = reinterpret_cast<uint8_t*>(&val);
-    std::reverse(ptr, ptr + sizeof(T));
+    constexpr bool isWord = (sizeof(T) == 2) || (sizeof(T) == 4) ||
+                            (sizeof(T) == 8);
+
+    if constexpr (sizeof(T) == 1) {
+        // nothing to swap
+    } else if constexpr (isWord && std::is_integral<T>::value) {
+        using Word = detail::Word<T>;
+        val        = static_cast<T>(detail::bswap(static_cast<Word>(val)));
+    } else if constexpr (isWord && std::is_trivially_copyable<T>::value) {
+        // floats, enums and small structs, memcpy compiles to a move
+        detail::Word<T> word;
+        std::memcpy(&word, &val, sizeof(T));
+        word = detail::bswap(word);
+        std::memcpy(&val, &word, sizeof(T));
+    } else {
+        auto ptr = reinterpret_cast<uint8_t*>(&val);
+        std::reverse(ptr, ptr + sizeof(T));
+    }
 }
 
 template <class T>
@@ -59,10 +114,14 @@ constexpr
                             void>::type
     swap(T& val)
 {
-    // only wap endians for each element
-    std::for_each(std::begin(val), std::end(val), [](auto& element) {
-        Endians::swap(element);
-    });
+    if constexpr (is_contiguous<T>::value) {
+        Endians::swapArray(std::data(val), std::size(val));
+    } else {
+        // only wap endians for each element
+        std::for_each(std::begin(val), std::end(val), [](auto& element) {
+            Endians::swap(element);
+        });
+    }
 }
 }  // namespace Endians
 
@@ -141,6 +200,40 @@ constexpr void Endians::littleToMachine(T& val)
 #endif
 }
 
+/**
+ * @brief Swap the endianess of every element of an array.
+ *
+ * @details Elements of 2 byte are swapped two at a time in a 32 bit word,
+ * this is a single REV16 on Cortex-M. Larger elements take a single REV
+ * each.
+ *
+ * @tparam T element type
+ * @param data first element
+ * @param count number of elements
+ */
+template <class T>
+void Endians::swapArray(T* data, size_t count)
+{
+    if constexpr (sizeof(T) == 2 &&
+                  (std::is_arithmetic<T>::value || std::is_enum<T>::value)) {
+        auto   bytes = reinterpret_cast<uint8_t*>(data);
+        size_t i     = 0;
+        for (; i + 2 <= count; i += 2) {
+            uint32_t word;
+            std::memcpy(&word, bytes + (2 * i), sizeof(word));
+            word = ((word & 0x00FF00FFu) << 8) | ((word >> 8) & 0x00FF00FFu);
+            std::memcpy(bytes + (2 * i), &word, sizeof(word));
+        }
+        if (i < count) {
+            Endians::swap(data[i]);
+        }
+    } else if constexpr (sizeof(T) != 1 || !std::is_arithmetic<T>::value) {
+        for (size_t i = 0; i < count; i++) {
+            Endians::swap(data[i]);
+        }
+    }
+}
+
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
@@ -71,13 +71,16 @@ const char* const Error::getDescription(Code code)
      * @warning do not directly use. Use CHECK_ERROR() instead.
      * 
      * @param code 
+     * @param site where the check failed, see makeSite()
      */
-void Error::internalCheck(Code code, uint32_t lineNumber, const char* fileName)
+void Error::internalCheck(Code code, uint32_t site)
 {
     if (code != Error::None) {
+        Port::traceError(code, site);
         Port::disableInterrupts();
+        Port::saveCrash(code, site);
 
-        Port::logError(fileName, lineNumber, getDescription(code));
+        Port::logError(site, getDescription(code));
 
         // kill the MCU and force restart
         Port::restart();
@@ -91,13 +94,16 @@ void Error::internalCheck(Code code, uint32_t lineNumber, const char* fileName)
      * @warning do not directly use. Use CHECK_ERROR() instead.
      * 
      * @param code 
+     * @param site where the check failed, see makeSite()
      */
-void Error::internalCheck(Code code, uint32_t lineNumber, const char* fileName)
+void Error::internalCheck(Code code, uint32_t site)
 {
     if (code != Error::None) {
+        Port::traceError(code, site);
         Port::disableInterrupts();
+        Port::saveCrash(code, site);
         // report
-        Port::logError(fileName, lineNumber, getDescription(code));
+        Port::logError(site, getDescription(code));
 
         // stop program execution to look around
         Port::faultBreakpoint();
@@ -0,0 +1,154 @@
+/**
+ * @file Fsm.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief table driven hierarchical state machine
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Fsm.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct a stopped state machine, call start() to enter the
+ * initial state.
+ *
+ * @param context Passed to all actions.
+ */
+template<class Definition>
+Patterns::Fsm<Definition>::Fsm(Context& context)
+        : context(context), current(kNone)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Enter Definition::kInitial, calling all its entry actions.
+ *
+ * @return Error::Code AlreadyInit if started before.
+ */
+template<class Definition>
+Error::Code Patterns::Fsm<Definition>::start()
+{
+    if (current != kNone) {
+        return Error::AlreadyInit;
+    }
+    enter(kNone, Definition::kInitial);
+    return Error::None;
+}
+
+/**
+ * @brief Take the transition for event of the current state or the closest
+ * enclosing state.
+ *
+ * @param event Event that happened.
+ * @return Error::Code NotFound if no state handles the event, it is dropped
+ * then. NotInitialized before start().
+ */
+template<class Definition>
+Error::Code Patterns::Fsm<Definition>::dispatch(Event event)
+{
+    if (current == kNone) {
+        return Error::NotInitialized;
+    }
+    auto index = kDispatch[static_cast<size_t>(current)]
+                          [static_cast<size_t>(event)];
+    if (index == kUnhandled) {
+        return Error::NotFound;
+    }
+
+    const auto& transition = Definition::transitions[index];
+    if (transition.to == kNone) {
+        // internal transition
+        call(transition.action);
+        return Error::None;
+    }
+
+    State common = kCommonParent[index];
+    for (State state = current; state != common;
+         state       = kParent[static_cast<size_t>(state)]) {
+        call(Definition::states[static_cast<size_t>(state)].exit);
+    }
+    call(transition.action);
+    enter(common, transition.to);
+    return Error::None;
+}
+
+/**
+ * @brief Innermost active state, State::Count before start().
+ *
+ */
+template<class Definition>
+typename Patterns::Fsm<Definition>::State
+    Patterns::Fsm<Definition>::getState() const
+{
+    return current;
+}
+
+/**
+ * @brief Checks if state or one of its sub states is active.
+ *
+ */
+template<class Definition>
+bool Patterns::Fsm<Definition>::isIn(State state) const
+{
+    for (State active = current; active != kNone;
+         active       = kParent[static_cast<size_t>(active)]) {
+        if (active == state) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+template<class Definition>
+void Patterns::Fsm<Definition>::call(FsmAction<Context> action)
+{
+    if (action != nullptr) {
+        (context.*action)();
+    }
+}
+
+/**
+ * @brief Enter all states between from and to, outermost first, then
+ * follow the initial sub states of to.
+ *
+ * @param from Active state enclosing to, kNone for the top.
+ * @param to State to enter.
+ */
+template<class Definition>
+void Patterns::Fsm<Definition>::enter(State from, State to)
+{
+    State  path[kStates];
+    size_t depth = 0;
+    for (State state = to; state != from;
+         state       = kParent[static_cast<size_t>(state)]) {
+        path[depth++] = state;
+    }
+    while (depth > 0) {
+        current = path[--depth];
+        call(Definition::states[static_cast<size_t>(current)].entry);
+    }
+
+    current = to;
+    while (Definition::states[static_cast<size_t>(current)].initial != kNone) {
+        current = Definition::states[static_cast<size_t>(current)].initial;
+        call(Definition::states[static_cast<size_t>(current)].entry);
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
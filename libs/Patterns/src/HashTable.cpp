@@ -0,0 +1,353 @@
+/**
+ * @file HashTable.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed capacity hash table with in place values and LRU eviction
+ * @version 1.0
+ * @date 2020-11-09
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "HashTable.h"
+#include <new>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an empty table.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+Collections::HashTable<Key, T, capacity, HashT>::HashTable()
+        : slots(), newest(kNone), oldest(kNone), freeSlots(0), count(0),
+          evictions(0)
+{
+    for (auto& bucket : buckets) {
+        bucket = kNone;
+    }
+    for (size_t i = 0; i < capacity; i++) {
+        slots[i].older = (i + 1 < capacity) ? static_cast<Index>(i + 1) : kNone;
+    }
+}
+
+/**
+ * @brief Destructs all values left in the table.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+Collections::HashTable<Key, T, capacity, HashT>::~HashTable()
+{
+    clear();
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+Collections::HashTable<Key, T, capacity, HashT>::Iterator::Iterator(
+    HashTable& table,
+    Index      slot)
+        : table(&table), slot(slot)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Construct a new value for key.
+ *
+ * @details Evicts the least recently used value if the table is full. The
+ * new value counts as most recently used.
+ *
+ * @param key Key of the new value.
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New value, nullptr if key is already in the table.
+ */
+template<class Key, class T, size_t capacity, class HashT>
+template<class... ArgsT>
+T* Collections::HashTable<Key, T, capacity, HashT>::emplace(const Key& key,
+                                                            ArgsT&&... args)
+{
+    size_t bucket;
+    if (lookup(key, bucket)) {
+        return nullptr;
+    }
+    if (count == capacity) {
+        size_t oldestBucket;
+        lookup(slots[oldest].key, oldestBucket);
+        destroy(oldestBucket);
+        evictions++;
+        // the erase might have shifted an entry into our empty bucket
+        lookup(key, bucket);
+    }
+
+    Index slot      = freeSlots;
+    freeSlots       = slots[slot].older;
+    buckets[bucket] = slot;
+    slots[slot].key = key;
+    linkNewest(slot);
+    count++;
+    return new (slots[slot].storage) T(std::forward<ArgsT>(args)...);
+}
+
+/**
+ * @brief Search the value of key and mark it as most recently used.
+ *
+ * @param key Key to search.
+ * @return T* Value, nullptr if key is not in the table.
+ */
+template<class Key, class T, size_t capacity, class HashT>
+T* Collections::HashTable<Key, T, capacity, HashT>::find(const Key& key)
+{
+    size_t bucket;
+    if (!lookup(key, bucket)) {
+        return nullptr;
+    }
+    Index slot = buckets[bucket];
+    if (slot != newest) {
+        unlink(slot);
+        linkNewest(slot);
+    }
+    return slots[slot].get();
+}
+
+/**
+ * @brief Search the value of key without changing the usage order.
+ *
+ * @param key Key to search.
+ * @return T* Value, nullptr if key is not in the table.
+ */
+template<class Key, class T, size_t capacity, class HashT>
+T* Collections::HashTable<Key, T, capacity, HashT>::peek(const Key& key)
+{
+    size_t bucket;
+    return lookup(key, bucket) ? slots[buckets[bucket]].get() : nullptr;
+}
+
+/**
+ * @brief Destruct the value of key and free its slot.
+ *
+ * @param key Key of the value, may be part of the value itself.
+ * @return Error::Code NotFound if key is not in the table.
+ */
+template<class Key, class T, size_t capacity, class HashT>
+Error::Code Collections::HashTable<Key, T, capacity, HashT>::erase(
+    const Key& key)
+{
+    size_t bucket;
+    if (!lookup(key, bucket)) {
+        return Error::NotFound;
+    }
+    destroy(bucket);
+    return Error::None;
+}
+
+/**
+ * @brief Destruct all values.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+void Collections::HashTable<Key, T, capacity, HashT>::clear()
+{
+    while (oldest != kNone) {
+        size_t bucket;
+        lookup(slots[oldest].key, bucket);
+        destroy(bucket);
+    }
+}
+
+/**
+ * @brief Number of values in the table.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+size_t Collections::HashTable<Key, T, capacity, HashT>::size() const
+{
+    return count;
+}
+
+/**
+ * @brief Number of values evicted because the table was full.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+uint32_t Collections::HashTable<Key, T, capacity, HashT>::getEvictions() const
+{
+    return evictions;
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+typename Collections::HashTable<Key, T, capacity, HashT>::Iterator
+    Collections::HashTable<Key, T, capacity, HashT>::begin()
+{
+    return Iterator {*this, newest};
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+typename Collections::HashTable<Key, T, capacity, HashT>::Iterator
+    Collections::HashTable<Key, T, capacity, HashT>::end()
+{
+    return Iterator {*this, kNone};
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+bool Collections::HashTable<Key, T, capacity, HashT>::Iterator::operator==(
+    const Iterator& other) const
+{
+    return slot == other.slot;
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+bool Collections::HashTable<Key, T, capacity, HashT>::Iterator::operator!=(
+    const Iterator& other) const
+{
+    return slot != other.slot;
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+T& Collections::HashTable<Key, T, capacity, HashT>::Iterator::operator*() const
+{
+    return *table->slots[slot].get();
+}
+
+template<class Key, class T, size_t capacity, class HashT>
+typename Collections::HashTable<Key, T, capacity, HashT>::Iterator&
+    Collections::HashTable<Key, T, capacity, HashT>::Iterator::operator++()
+{
+    slot = table->slots[slot].older;
+    return *this;
+}
+
+/**
+ * @brief Key of the value at the current position.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+const Key&
+    Collections::HashTable<Key, T, capacity, HashT>::Iterator::getKey() const
+{
+    return table->slots[slot].key;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+template<class Key, class T, size_t capacity, class HashT>
+T* Collections::HashTable<Key, T, capacity, HashT>::Slot::get()
+{
+    return std::launder(reinterpret_cast<T*>(storage));
+}
+
+/**
+ * @brief Bucket a key is placed in if there are no collisions.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+size_t Collections::HashTable<Key, T, capacity, HashT>::home(const Key& key)
+{
+    return HashT {}(key) & (kBuckets - 1);
+}
+
+/**
+ * @brief Probe the index for key.
+ *
+ * @param key Key to search.
+ * @param bucket Bucket holding key, otherwise the empty bucket it belongs in.
+ * @return true key was found
+ */
+template<class Key, class T, size_t capacity, class HashT>
+bool Collections::HashTable<Key, T, capacity, HashT>::lookup(
+    const Key& key,
+    size_t&    bucket) const
+{
+    // index is never full, probing always ends at an empty bucket
+    for (bucket = home(key); buckets[bucket] != kNone;
+         bucket = (bucket + 1) & (kBuckets - 1)) {
+        if (slots[buckets[bucket]].key == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Empty an index entry and shift following entries of the same probe
+ * sequence back, so lookups never stop early.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+void Collections::HashTable<Key, T, capacity, HashT>::removeBucket(
+    size_t bucket)
+{
+    size_t hole = bucket;
+    for (size_t next = (hole + 1) & (kBuckets - 1); buckets[next] != kNone;
+         next        = (next + 1) & (kBuckets - 1)) {
+        size_t wanted = home(slots[buckets[next]].key);
+        // entry may move if the hole lies between its home and its bucket
+        if (((next - wanted) & (kBuckets - 1)) >=
+            ((next - hole) & (kBuckets - 1))) {
+            buckets[hole] = buckets[next];
+            hole          = next;
+        }
+    }
+    buckets[hole] = kNone;
+}
+
+/**
+ * @brief Destruct the value indexed by bucket and free its slot.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+void Collections::HashTable<Key, T, capacity, HashT>::destroy(size_t bucket)
+{
+    Index slot = buckets[bucket];
+    removeBucket(bucket);
+    unlink(slot);
+    count--;
+    // table is consistent before the destructor runs, it may use the table
+    slots[slot].get()->~T();
+    slots[slot].older = freeSlots;
+    freeSlots         = slot;
+}
+
+/**
+ * @brief Take a slot out of the usage order.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+void Collections::HashTable<Key, T, capacity, HashT>::unlink(Index slot)
+{
+    Slot& entry = slots[slot];
+    if (entry.newer != kNone) {
+        slots[entry.newer].older = entry.older;
+    } else {
+        newest = entry.older;
+    }
+    if (entry.older != kNone) {
+        slots[entry.older].newer = entry.newer;
+    } else {
+        oldest = entry.newer;
+    }
+}
+
+/**
+ * @brief Put a slot in front of the usage order.
+ *
+ */
+template<class Key, class T, size_t capacity, class HashT>
+void Collections::HashTable<Key, T, capacity, HashT>::linkNewest(Index slot)
+{
+    slots[slot].newer = kNone;
+    slots[slot].older = newest;
+    if (newest != kNone) {
+        slots[newest].newer = slot;
+    } else {
+        oldest = slot;
+    }
+    newest = slot;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
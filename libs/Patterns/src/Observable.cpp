@@ -25,26 +25,52 @@ template <class... ObservableParamTypes>
 void Patterns::Observable<ObservableParamTypes...>::registerObserver(
     Observer<ObservableParamTypes...>& observer) noexcept
 {
-    observers.push_front(&observer);
+    if (observer.prevNext != nullptr) {
+        return;
+    }
+    observer.next     = first;
+    observer.prevNext = &first;
+    if (first != nullptr) {
+        first->prevNext = &observer.next;
+    }
+    first = &observer;
 }
 
 template <class... ObservableParamTypes>
 void Patterns::Observable<ObservableParamTypes...>::unregisterObserver(
     Observer<ObservableParamTypes...>& observer) noexcept
 {
-    observers.remove(&observer);
+    if (observer.prevNext == nullptr) {
+        return;
+    }
+    *observer.prevNext = observer.next;
+    if (observer.next != nullptr) {
+        observer.next->prevNext = observer.prevNext;
+    }
+    observer.next     = nullptr;
+    observer.prevNext = nullptr;
 }
 
 template <class... ObservableParamTypes>
 void Patterns::Observable<ObservableParamTypes...>::trigger(
     ObservableParamTypes... args)
 {
-    // call every single observer
-    for (auto observer : observers) {
+    // call every single observer, next is read first in case the observer
+    // unregisters itself
+    for (auto observer = first; observer != nullptr;) {
+        auto next = observer->next;
         observer->handle(*this, std::forward<ObservableParamTypes>(args)...);
+        observer = next;
     }
 }
 
+template <class... Observers>
+template <class... ParamTypes>
+void Patterns::StaticObservable<Observers...>::trigger(ParamTypes&&... params)
+{
+    (Observers::handle(params...), ...);
+}
+
 //----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
@@ -24,7 +24,7 @@
 template <class... ObservableParamTypes>
 Patterns::Observer<ObservableParamTypes...>::Observer(
     Observable<ObservableParamTypes...>& observable)
-    : observable(observable)
+    : observable(observable), next(nullptr), prevNext(nullptr)
 {
     observable.registerObserver(*this);
 }
@@ -0,0 +1,283 @@
+/**
+ * @file Pool.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief fixed block memory pools with a lock-free free list
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Pool.h"
+#include <new>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct pool with all blocks free
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+Patterns::BlockPool<blockSize, blockCount, alignment>::BlockPool()
+        : head(pack(0, 0)), used(0), peakUsed(0), failures(0)
+{
+    for (size_t i = 0; i < blockCount; i++) {
+        next[i].store((i + 1 < blockCount) ? i + 1 : kEnd,
+                      std::memory_order_relaxed);
+    }
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Take a block out of the pool.
+ *
+ * @details Lock-free, usable from ISR.
+ *
+ * @return void* Block of kBlockSize bytes, nullptr if the pool is exhausted.
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+void* Patterns::BlockPool<blockSize, blockCount, alignment>::allocate()
+{
+    auto     oldHead = head.load(std::memory_order_acquire);
+    uint16_t index;
+    do {
+        index = static_cast<uint16_t>(oldHead);
+        if (index == kEnd) {
+            failures.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        // next of a block taken concurrently might be stale, the tag then
+        // makes the exchange fail
+    } while (!head.compare_exchange_weak(
+        oldHead,
+        pack((oldHead >> 16) + 1, next[index].load(std::memory_order_relaxed)),
+        std::memory_order_acq_rel,
+        std::memory_order_acquire));
+
+    countAllocation();
+    return &storage[index * kStride];
+}
+
+/**
+ * @brief Take a block out of the pool wrapped into an owning handle.
+ *
+ * @param size Number of bytes needed, at most kBlockSize.
+ * @return Buffer Empty if size is too large or the pool is exhausted.
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+typename Patterns::BlockPool<blockSize, blockCount, alignment>::Buffer
+    Patterns::BlockPool<blockSize, blockCount, alignment>::allocateBuffer(
+        size_t size)
+{
+    if (size > blockSize) {
+        return Buffer {nullptr, Deleter {this}};
+    }
+    return Buffer {static_cast<uint8_t*>(allocate()), Deleter {this}};
+}
+
+/**
+ * @brief Return a block to the pool.
+ *
+ * @details Lock-free, usable from ISR.
+ *
+ * @param block Block obtained from allocate() of this pool.
+ * @return Error::Code InvalidParameter if block is not a block of this pool.
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+Error::Code
+    Patterns::BlockPool<blockSize, blockCount, alignment>::free(const void* block)
+{
+    if (!owns(block)) {
+        return Error::InvalidParameter;
+    }
+
+    auto index = static_cast<uint16_t>(
+        (static_cast<const uint8_t*>(block) - storage) / kStride);
+    auto oldHead = head.load(std::memory_order_relaxed);
+    do {
+        next[index].store(static_cast<uint16_t>(oldHead),
+                          std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(oldHead,
+                                         pack((oldHead >> 16) + 1, index),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+
+    used.fetch_sub(1, std::memory_order_relaxed);
+    return Error::None;
+}
+
+/**
+ * @brief Check whether a pointer is the start of a block of this pool.
+ *
+ * @param block Pointer to check.
+ * @return true block belongs to this pool
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+bool Patterns::BlockPool<blockSize, blockCount, alignment>::owns(
+    const void* block) const
+{
+    auto address = static_cast<const uint8_t*>(block);
+    if ((address < storage) || (address >= storage + sizeof(storage))) {
+        return false;
+    }
+    return (address - storage) % kStride == 0;
+}
+
+/**
+ * @brief Number of blocks currently handed out.
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+size_t Patterns::BlockPool<blockSize, blockCount, alignment>::getUsed() const
+{
+    return used.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Highest number of blocks that were handed out at the same time.
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+size_t Patterns::BlockPool<blockSize, blockCount, alignment>::getPeakUsed() const
+{
+    return peakUsed.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Number of allocations that failed because the pool was exhausted.
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+size_t Patterns::BlockPool<blockSize, blockCount, alignment>::getFailures() const
+{
+    return failures.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Construct a new object in the pool.
+ *
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New object, nullptr if the pool is exhausted.
+ */
+template<class T, size_t count>
+template<class... ArgsT>
+T* Patterns::Pool<T, count>::create(ArgsT&&... args)
+{
+    void* block = blocks.allocate();
+    if (block == nullptr) {
+        return nullptr;
+    }
+    return new (block) T(std::forward<ArgsT>(args)...);
+}
+
+/**
+ * @brief Destruct an object and return its memory to the pool.
+ *
+ * @param object Object obtained from create() of this pool.
+ * @return Error::Code InvalidParameter if object is not from this pool.
+ */
+template<class T, size_t count>
+Error::Code Patterns::Pool<T, count>::destroy(T* object)
+{
+    if (!blocks.owns(object)) {
+        return Error::InvalidParameter;
+    }
+    object->~T();
+    return blocks.free(object);
+}
+
+/**
+ * @brief Check whether an object lives in this pool.
+ *
+ */
+template<class T, size_t count>
+bool Patterns::Pool<T, count>::owns(const T* object) const
+{
+    return blocks.owns(object);
+}
+
+/**
+ * @brief Number of objects currently alive.
+ *
+ */
+template<class T, size_t count>
+size_t Patterns::Pool<T, count>::getUsed() const
+{
+    return blocks.getUsed();
+}
+
+/**
+ * @brief Highest number of objects that were alive at the same time.
+ *
+ */
+template<class T, size_t count>
+size_t Patterns::Pool<T, count>::getPeakUsed() const
+{
+    return blocks.getPeakUsed();
+}
+
+/**
+ * @brief Number of create() calls that failed because the pool was exhausted.
+ *
+ */
+template<class T, size_t count>
+size_t Patterns::Pool<T, count>::getFailures() const
+{
+    return blocks.getFailures();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+/**
+ * @brief Returns the block to the pool it was taken from.
+ *
+ * @param block Block held by a Buffer, never nullptr.
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+void Patterns::BlockPool<blockSize, blockCount, alignment>::Deleter::operator()(
+    const void* block) const
+{
+    CHECK_ERROR(pool->free(block));
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Combine tag and index into a head value.
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+constexpr uint32_t
+    Patterns::BlockPool<blockSize, blockCount, alignment>::pack(uint32_t tag,
+                                                                uint16_t index)
+{
+    return (tag << 16) | index;
+}
+
+/**
+ * @brief Update usage counter and high water mark after an allocation.
+ *
+ */
+template<size_t blockSize, size_t blockCount, size_t alignment>
+void Patterns::BlockPool<blockSize, blockCount, alignment>::countAllocation()
+{
+    auto nowUsed = used.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto peak    = peakUsed.load(std::memory_order_relaxed);
+    while ((nowUsed > peak) &&
+           !peakUsed.compare_exchange_weak(peak,
+                                           nowUsed,
+                                           std::memory_order_relaxed)) {
+        // peak got reloaded, try again
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,323 @@
+/**
+ * @file RingBuffer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief first in first out buffer with a fixed capacity
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "RingBuffer.h"
+
+#include <new>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an empty ring.
+ *
+ */
+template<class T, size_t capacity>
+Collections::RingBuffer<T, capacity>::RingBuffer() : oldest(0), count(0)
+{}
+
+template<class T, size_t capacity>
+Collections::RingBuffer<T, capacity>::RingBuffer(const RingBuffer& other)
+        : oldest(0), count(0)
+{
+    for (auto& value : other) {
+        emplace_back(value);
+    }
+}
+
+template<class T, size_t capacity>
+Collections::RingBuffer<T, capacity>&
+    Collections::RingBuffer<T, capacity>::operator=(const RingBuffer& other)
+{
+    if (this != &other) {
+        clear();
+        for (auto& value : other) {
+            emplace_back(value);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructs all elements.
+ *
+ */
+template<class T, size_t capacity>
+Collections::RingBuffer<T, capacity>::~RingBuffer()
+{
+    clear();
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::BasicIterator(
+    Owner& ring,
+    size_t age)
+        : ring(&ring), age(age)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Append a copy of value.
+ *
+ * @return Error::Code OutOfResources if the ring is full.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::RingBuffer<T, capacity>::push_back(const T& value)
+{
+    return (emplace_back(value) != nullptr) ? Error::None
+                                            : Error::OutOfResources;
+}
+
+/**
+ * @brief Construct a new element at the back.
+ *
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New element, nullptr if the ring is full.
+ */
+template<class T, size_t capacity>
+template<class... ArgsT>
+T* Collections::RingBuffer<T, capacity>::emplace_back(ArgsT&&... args)
+{
+    if (count == capacity) {
+        return nullptr;
+    }
+    T* element = new (slot(count)) T(std::forward<ArgsT>(args)...);
+    count++;
+    return element;
+}
+
+/**
+ * @brief Construct a new element at the back, the oldest element is
+ * dropped if the ring is full.
+ *
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New element, never nullptr.
+ */
+template<class T, size_t capacity>
+template<class... ArgsT>
+T* Collections::RingBuffer<T, capacity>::emplaceOverwrite(ArgsT&&... args)
+{
+    if (count == capacity) {
+        pop_front();
+    }
+    return emplace_back(std::forward<ArgsT>(args)...);
+}
+
+/**
+ * @brief Destruct the oldest element.
+ *
+ * @return Error::Code NotFound if the ring is empty.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::RingBuffer<T, capacity>::pop_front()
+{
+    if (count == 0) {
+        return Error::NotFound;
+    }
+    slot(0)->~T();
+    oldest = (oldest + 1 < capacity) ? oldest + 1 : 0;
+    count--;
+    return Error::None;
+}
+
+/**
+ * @brief Move the oldest element out of the ring.
+ *
+ * @return Error::Code NotFound if the ring is empty.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::RingBuffer<T, capacity>::popInto(T& value)
+{
+    if (count == 0) {
+        return Error::NotFound;
+    }
+    value = std::move(*slot(0));
+    return pop_front();
+}
+
+/**
+ * @brief Destruct all elements.
+ *
+ */
+template<class T, size_t capacity>
+void Collections::RingBuffer<T, capacity>::clear()
+{
+    while (count > 0) {
+        pop_front();
+    }
+    oldest = 0;
+}
+
+/**
+ * @brief Element by age, 0 is the oldest one.
+ *
+ */
+template<class T, size_t capacity>
+T& Collections::RingBuffer<T, capacity>::operator[](size_t age)
+{
+    return *slot(age);
+}
+
+template<class T, size_t capacity>
+const T& Collections::RingBuffer<T, capacity>::operator[](size_t age) const
+{
+    return *slot(age);
+}
+
+template<class T, size_t capacity>
+T& Collections::RingBuffer<T, capacity>::front()
+{
+    return *slot(0);
+}
+
+template<class T, size_t capacity>
+const T& Collections::RingBuffer<T, capacity>::front() const
+{
+    return *slot(0);
+}
+
+template<class T, size_t capacity>
+T& Collections::RingBuffer<T, capacity>::back()
+{
+    return *slot(count - 1);
+}
+
+template<class T, size_t capacity>
+const T& Collections::RingBuffer<T, capacity>::back() const
+{
+    return *slot(count - 1);
+}
+
+template<class T, size_t capacity>
+size_t Collections::RingBuffer<T, capacity>::size() const
+{
+    return count;
+}
+
+template<class T, size_t capacity>
+bool Collections::RingBuffer<T, capacity>::empty() const
+{
+    return count == 0;
+}
+
+template<class T, size_t capacity>
+bool Collections::RingBuffer<T, capacity>::isFull() const
+{
+    return count == capacity;
+}
+
+template<class T, size_t capacity>
+typename Collections::RingBuffer<T, capacity>::iterator
+    Collections::RingBuffer<T, capacity>::begin()
+{
+    return iterator {*this, 0};
+}
+
+template<class T, size_t capacity>
+typename Collections::RingBuffer<T, capacity>::iterator
+    Collections::RingBuffer<T, capacity>::end()
+{
+    return iterator {*this, count};
+}
+
+template<class T, size_t capacity>
+typename Collections::RingBuffer<T, capacity>::const_iterator
+    Collections::RingBuffer<T, capacity>::begin() const
+{
+    return const_iterator {*this, 0};
+}
+
+template<class T, size_t capacity>
+typename Collections::RingBuffer<T, capacity>::const_iterator
+    Collections::RingBuffer<T, capacity>::end() const
+{
+    return const_iterator {*this, count};
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+bool Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::operator==(
+    const BasicIterator& other) const
+{
+    return age == other.age;
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+bool Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::operator!=(
+    const BasicIterator& other) const
+{
+    return age != other.age;
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+ValueT& Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::operator*()
+    const
+{
+    return *ring->slot(age);
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+ValueT*
+    Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::operator->()
+        const
+{
+    return ring->slot(age);
+}
+
+template<class T, size_t capacity>
+template<class ValueT>
+typename Collections::RingBuffer<T, capacity>::template BasicIterator<ValueT>&
+    Collections::RingBuffer<T, capacity>::BasicIterator<ValueT>::operator++()
+{
+    age++;
+    return *this;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Storage of the element with the given age, 0 is the oldest.
+ *
+ */
+template<class T, size_t capacity>
+T* Collections::RingBuffer<T, capacity>::slot(size_t age)
+{
+    size_t index = oldest + age;
+    if (index >= capacity) {
+        index -= capacity;
+    }
+    return std::launder(reinterpret_cast<T*>(storage)) + index;
+}
+
+template<class T, size_t capacity>
+const T* Collections::RingBuffer<T, capacity>::slot(size_t age) const
+{
+    size_t index = oldest + age;
+    if (index >= capacity) {
+        index -= capacity;
+    }
+    return std::launder(reinterpret_cast<const T*>(storage)) + index;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,204 @@
+/**
+ * @file StaticMap.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief sorted map with a fixed capacity and in place storage
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "StaticMap.h"
+
+#include <algorithm>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+template<class Key, class T, size_t capacity, class CompareT>
+template<class... ArgsT>
+Collections::StaticMap<Key, T, capacity, CompareT>::Entry::Entry(
+    const Key& key,
+    ArgsT&&... args)
+        : key(key), value(std::forward<ArgsT>(args)...)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Construct a new value for key.
+ *
+ * @param key Key of the new value.
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New value, nullptr if key is already in the map or the map is
+ * full.
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+template<class... ArgsT>
+T* Collections::StaticMap<Key, T, capacity, CompareT>::emplace(const Key& key,
+                                                               ArgsT&&... args)
+{
+    auto position = lowerBound(key);
+    if (matches(position, key)) {
+        return nullptr;
+    }
+    Entry* entry =
+        entries.emplace(position, key, std::forward<ArgsT>(args)...);
+    return (entry != nullptr) ? &entry->value : nullptr;
+}
+
+/**
+ * @brief Set the value of key, adding it if needed.
+ *
+ * @return Error::Code OutOfResources if key is new and the map is full.
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+Error::Code Collections::StaticMap<Key, T, capacity, CompareT>::insertOrAssign(
+    const Key& key,
+    const T&   value)
+{
+    T* existing = find(key);
+    if (existing != nullptr) {
+        *existing = value;
+        return Error::None;
+    }
+    return (emplace(key, value) != nullptr) ? Error::None
+                                            : Error::OutOfResources;
+}
+
+/**
+ * @brief Value of key.
+ *
+ * @return T* nullptr if key is not in the map.
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+T* Collections::StaticMap<Key, T, capacity, CompareT>::find(const Key& key)
+{
+    return const_cast<T*>(static_cast<const StaticMap*>(this)->find(key));
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+const T* Collections::StaticMap<Key, T, capacity, CompareT>::find(
+    const Key& key) const
+{
+    auto position = lowerBound(key);
+    return matches(position, key) ? &position->value : nullptr;
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+bool Collections::StaticMap<Key, T, capacity, CompareT>::contains(
+    const Key& key) const
+{
+    return find(key) != nullptr;
+}
+
+/**
+ * @brief Remove the value of key.
+ *
+ * @return Error::Code NotFound if key is not in the map.
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+Error::Code
+    Collections::StaticMap<Key, T, capacity, CompareT>::erase(const Key& key)
+{
+    auto position = lowerBound(key);
+    if (!matches(position, key)) {
+        return Error::NotFound;
+    }
+    entries.erase(position);
+    return Error::None;
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+void Collections::StaticMap<Key, T, capacity, CompareT>::clear()
+{
+    entries.clear();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+size_t Collections::StaticMap<Key, T, capacity, CompareT>::size() const
+{
+    return entries.size();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+bool Collections::StaticMap<Key, T, capacity, CompareT>::empty() const
+{
+    return entries.empty();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+bool Collections::StaticMap<Key, T, capacity, CompareT>::isFull() const
+{
+    return entries.isFull();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+typename Collections::StaticMap<Key, T, capacity, CompareT>::iterator
+    Collections::StaticMap<Key, T, capacity, CompareT>::begin()
+{
+    return entries.begin();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+typename Collections::StaticMap<Key, T, capacity, CompareT>::iterator
+    Collections::StaticMap<Key, T, capacity, CompareT>::end()
+{
+    return entries.end();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+typename Collections::StaticMap<Key, T, capacity, CompareT>::const_iterator
+    Collections::StaticMap<Key, T, capacity, CompareT>::begin() const
+{
+    return entries.begin();
+}
+
+template<class Key, class T, size_t capacity, class CompareT>
+typename Collections::StaticMap<Key, T, capacity, CompareT>::const_iterator
+    Collections::StaticMap<Key, T, capacity, CompareT>::end() const
+{
+    return entries.end();
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief First entry with a key not less than key.
+ *
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+typename Collections::StaticMap<Key, T, capacity, CompareT>::const_iterator
+    Collections::StaticMap<Key, T, capacity, CompareT>::lowerBound(
+        const Key& key) const
+{
+    return std::lower_bound(entries.begin(),
+                            entries.end(),
+                            key,
+                            [](const Entry& entry, const Key& key) {
+                                return CompareT {}(entry.key, key);
+                            });
+}
+
+/**
+ * @brief Whether entry, found by lowerBound(), holds key.
+ *
+ */
+template<class Key, class T, size_t capacity, class CompareT>
+bool Collections::StaticMap<Key, T, capacity, CompareT>::matches(
+    const_iterator entry,
+    const Key&     key) const
+{
+    return entry != entries.end() && !CompareT {}(key, entry->key);
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
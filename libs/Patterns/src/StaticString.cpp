@@ -0,0 +1,227 @@
+/**
+ * @file StaticString.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief null terminated string with a fixed capacity
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "StaticString.h"
+
+#include <algorithm>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an empty string.
+ *
+ */
+template<size_t capacity>
+Collections::StaticString<capacity>::StaticString() : characters {0}, count(0)
+{}
+
+/**
+ * @brief Construct from a null terminated text, cut off at the capacity.
+ *
+ */
+template<size_t capacity>
+Collections::StaticString<capacity>::StaticString(const char* text)
+        : StaticString()
+{
+    assign(text);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Replace the content with a null terminated text.
+ *
+ * @return Error::Code TooLarge if text got cut off.
+ */
+template<size_t capacity>
+Error::Code Collections::StaticString<capacity>::assign(const char* text)
+{
+    clear();
+    return append(text);
+}
+
+/**
+ * @brief Replace the content with textLength characters.
+ *
+ * @return Error::Code TooLarge if text got cut off.
+ */
+template<size_t capacity>
+Error::Code Collections::StaticString<capacity>::assign(const char* text,
+                                                        size_t textLength)
+{
+    clear();
+    return append(text, textLength);
+}
+
+/**
+ * @brief Append a null terminated text.
+ *
+ * @return Error::Code TooLarge if text got cut off.
+ */
+template<size_t capacity>
+Error::Code Collections::StaticString<capacity>::append(const char* text)
+{
+    // stop counting once the text would not fit anyways
+    size_t textLength = 0;
+    while (textLength <= capacity - count && text[textLength] != '\0') {
+        textLength++;
+    }
+    return append(text, textLength);
+}
+
+/**
+ * @brief Append textLength characters.
+ *
+ * @return Error::Code TooLarge if text got cut off.
+ */
+template<size_t capacity>
+Error::Code Collections::StaticString<capacity>::append(const char* text,
+                                                        size_t textLength)
+{
+    size_t copied = std::min(textLength, capacity - count);
+    std::copy_n(text, copied, &characters[count]);
+    count += copied;
+    characters[count] = '\0';
+    return (copied == textLength) ? Error::None : Error::TooLarge;
+}
+
+/**
+ * @brief Append a single character.
+ *
+ * @return Error::Code TooLarge if the string is full.
+ */
+template<size_t capacity>
+Error::Code Collections::StaticString<capacity>::push_back(char character)
+{
+    return append(&character, 1);
+}
+
+template<size_t capacity>
+void Collections::StaticString<capacity>::clear()
+{
+    count         = 0;
+    characters[0] = '\0';
+}
+
+template<size_t capacity>
+char& Collections::StaticString<capacity>::operator[](size_t index)
+{
+    return characters[index];
+}
+
+template<size_t capacity>
+const char& Collections::StaticString<capacity>::operator[](size_t index) const
+{
+    return characters[index];
+}
+
+template<size_t capacity>
+const char* Collections::StaticString<capacity>::c_str() const
+{
+    return characters;
+}
+
+template<size_t capacity>
+char* Collections::StaticString<capacity>::data()
+{
+    return characters;
+}
+
+template<size_t capacity>
+const char* Collections::StaticString<capacity>::data() const
+{
+    return characters;
+}
+
+template<size_t capacity>
+size_t Collections::StaticString<capacity>::size() const
+{
+    return count;
+}
+
+template<size_t capacity>
+size_t Collections::StaticString<capacity>::length() const
+{
+    return count;
+}
+
+template<size_t capacity>
+bool Collections::StaticString<capacity>::empty() const
+{
+    return count == 0;
+}
+
+template<size_t capacity>
+typename Collections::StaticString<capacity>::iterator
+    Collections::StaticString<capacity>::begin()
+{
+    return characters;
+}
+
+template<size_t capacity>
+typename Collections::StaticString<capacity>::iterator
+    Collections::StaticString<capacity>::end()
+{
+    return characters + count;
+}
+
+template<size_t capacity>
+typename Collections::StaticString<capacity>::const_iterator
+    Collections::StaticString<capacity>::begin() const
+{
+    return characters;
+}
+
+template<size_t capacity>
+typename Collections::StaticString<capacity>::const_iterator
+    Collections::StaticString<capacity>::end() const
+{
+    return characters + count;
+}
+
+template<size_t capacityA, size_t capacityB>
+bool Collections::operator==(const StaticString<capacityA>& a,
+                             const StaticString<capacityB>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+template<size_t capacity>
+bool Collections::operator==(const StaticString<capacity>& a, const char* b)
+{
+    return std::strncmp(a.c_str(), b, capacity + 1) == 0;
+}
+
+template<size_t capacityA, size_t capacityB>
+bool Collections::operator!=(const StaticString<capacityA>& a,
+                             const StaticString<capacityB>& b)
+{
+    return !(a == b);
+}
+
+template<size_t capacity>
+bool Collections::operator!=(const StaticString<capacity>& a, const char* b)
+{
+    return !(a == b);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
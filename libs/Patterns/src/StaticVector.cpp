@@ -0,0 +1,366 @@
+/**
+ * @file StaticVector.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief vector with a fixed capacity and in place storage
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "StaticVector.h"
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct an empty vector.
+ *
+ */
+template<class T, size_t capacity>
+Collections::StaticVector<T, capacity>::StaticVector() : count(0)
+{}
+
+/**
+ * @brief Construct from a list of values.
+ *
+ * @details Values beyond the capacity are dropped.
+ *
+ */
+template<class T, size_t capacity>
+Collections::StaticVector<T, capacity>::StaticVector(
+    std::initializer_list<T> values)
+        : count(0)
+{
+    for (auto& value : values) {
+        if (push_back(value) != Error::None) {
+            break;
+        }
+    }
+}
+
+template<class T, size_t capacity>
+Collections::StaticVector<T, capacity>::StaticVector(const StaticVector& other)
+        : count(0)
+{
+    for (auto& value : other) {
+        emplace_back(value);
+    }
+}
+
+template<class T, size_t capacity>
+Collections::StaticVector<T, capacity>&
+    Collections::StaticVector<T, capacity>::operator=(const StaticVector& other)
+{
+    if (this != &other) {
+        clear();
+        for (auto& value : other) {
+            emplace_back(value);
+        }
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructs all elements.
+ *
+ */
+template<class T, size_t capacity>
+Collections::StaticVector<T, capacity>::~StaticVector()
+{
+    clear();
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Append a copy of value.
+ *
+ * @return Error::Code OutOfResources if the vector is full.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::StaticVector<T, capacity>::push_back(const T& value)
+{
+    return (emplace_back(value) != nullptr) ? Error::None
+                                            : Error::OutOfResources;
+}
+
+/**
+ * @brief Construct a new element at the end.
+ *
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New element, nullptr if the vector is full.
+ */
+template<class T, size_t capacity>
+template<class... ArgsT>
+T* Collections::StaticVector<T, capacity>::emplace_back(ArgsT&&... args)
+{
+    if (count == capacity) {
+        return nullptr;
+    }
+    T* element = new (&data()[count]) T(std::forward<ArgsT>(args)...);
+    count++;
+    return element;
+}
+
+/**
+ * @brief Construct a new element in front of position.
+ *
+ * @details Following elements are moved back by one, O(n).
+ *
+ * @param position Iterator into this vector, end() appends.
+ * @param args Arguments forwarded to the constructor of T.
+ * @return T* New element, nullptr if the vector is full.
+ */
+template<class T, size_t capacity>
+template<class... ArgsT>
+T* Collections::StaticVector<T, capacity>::emplace(const_iterator position,
+                                                   ArgsT&&... args)
+{
+    size_t index = position - cbegin();
+    if (index == count) {
+        return emplace_back(std::forward<ArgsT>(args)...);
+    }
+    if (count == capacity) {
+        return nullptr;
+    }
+
+    // arguments might reference an element that is about to move
+    T value(std::forward<ArgsT>(args)...);
+    new (&data()[count]) T(std::move(back()));
+    count++;
+    std::move_backward(begin() + index, end() - 2, end() - 1);
+    data()[index] = std::move(value);
+    return &data()[index];
+}
+
+/**
+ * @brief Destruct the last element.
+ *
+ * @return Error::Code NotFound if the vector is empty.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::StaticVector<T, capacity>::pop_back()
+{
+    if (count == 0) {
+        return Error::NotFound;
+    }
+    count--;
+    data()[count].~T();
+    return Error::None;
+}
+
+/**
+ * @brief Remove the element at position, following elements move up.
+ *
+ * @return iterator Element following the removed one.
+ */
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::iterator
+    Collections::StaticVector<T, capacity>::erase(const_iterator position)
+{
+    iterator element = begin() + (position - cbegin());
+    std::move(element + 1, end(), element);
+    pop_back();
+    return element;
+}
+
+/**
+ * @brief Default construct or destruct elements at the end.
+ *
+ * @return Error::Code TooLarge above the capacity, nothing is changed then.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::StaticVector<T, capacity>::resize(size_t newSize)
+{
+    if (newSize > capacity) {
+        return Error::TooLarge;
+    }
+    while (count > newSize) {
+        pop_back();
+    }
+    while (count < newSize) {
+        emplace_back();
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Replace the content with copies of valueCount values.
+ *
+ * @return Error::Code TooLarge above the capacity, nothing is changed then.
+ */
+template<class T, size_t capacity>
+Error::Code Collections::StaticVector<T, capacity>::assign(const T* values,
+                                                           size_t valueCount)
+{
+    if (valueCount > capacity) {
+        return Error::TooLarge;
+    }
+    clear();
+    if constexpr (std::is_trivially_copyable<T>::value) {
+        // single memcpy for the byte buffers in the BLE data path
+        std::copy_n(values, valueCount, data());
+        count = valueCount;
+    } else {
+        for (size_t i = 0; i < valueCount; i++) {
+            emplace_back(values[i]);
+        }
+    }
+    return Error::None;
+}
+
+/**
+ * @brief Destruct all elements.
+ *
+ */
+template<class T, size_t capacity>
+void Collections::StaticVector<T, capacity>::clear()
+{
+    if constexpr (std::is_trivially_destructible<T>::value) {
+        count = 0;
+    } else {
+        while (count > 0) {
+            pop_back();
+        }
+    }
+}
+
+template<class T, size_t capacity>
+T& Collections::StaticVector<T, capacity>::operator[](size_t index)
+{
+    return data()[index];
+}
+
+template<class T, size_t capacity>
+const T& Collections::StaticVector<T, capacity>::operator[](size_t index) const
+{
+    return data()[index];
+}
+
+template<class T, size_t capacity>
+T& Collections::StaticVector<T, capacity>::front()
+{
+    return data()[0];
+}
+
+template<class T, size_t capacity>
+const T& Collections::StaticVector<T, capacity>::front() const
+{
+    return data()[0];
+}
+
+template<class T, size_t capacity>
+T& Collections::StaticVector<T, capacity>::back()
+{
+    return data()[count - 1];
+}
+
+template<class T, size_t capacity>
+const T& Collections::StaticVector<T, capacity>::back() const
+{
+    return data()[count - 1];
+}
+
+template<class T, size_t capacity>
+T* Collections::StaticVector<T, capacity>::data()
+{
+    return std::launder(reinterpret_cast<T*>(storage));
+}
+
+template<class T, size_t capacity>
+const T* Collections::StaticVector<T, capacity>::data() const
+{
+    return std::launder(reinterpret_cast<const T*>(storage));
+}
+
+template<class T, size_t capacity>
+size_t Collections::StaticVector<T, capacity>::size() const
+{
+    return count;
+}
+
+template<class T, size_t capacity>
+bool Collections::StaticVector<T, capacity>::empty() const
+{
+    return count == 0;
+}
+
+template<class T, size_t capacity>
+bool Collections::StaticVector<T, capacity>::isFull() const
+{
+    return count == capacity;
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::iterator
+    Collections::StaticVector<T, capacity>::begin()
+{
+    return data();
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::iterator
+    Collections::StaticVector<T, capacity>::end()
+{
+    return data() + count;
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::const_iterator
+    Collections::StaticVector<T, capacity>::begin() const
+{
+    return data();
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::const_iterator
+    Collections::StaticVector<T, capacity>::end() const
+{
+    return data() + count;
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::const_iterator
+    Collections::StaticVector<T, capacity>::cbegin() const
+{
+    return data();
+}
+
+template<class T, size_t capacity>
+typename Collections::StaticVector<T, capacity>::const_iterator
+    Collections::StaticVector<T, capacity>::cend() const
+{
+    return data() + count;
+}
+
+template<class T, size_t capacityA, size_t capacityB>
+bool Collections::operator==(const StaticVector<T, capacityA>& a,
+                             const StaticVector<T, capacityB>& b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+template<class T, size_t capacityA, size_t capacityB>
+bool Collections::operator!=(const StaticVector<T, capacityA>& a,
+                             const StaticVector<T, capacityB>& b)
+{
+    return !(a == b);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,567 @@
+/**
+ * @file Tlsf.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief two level segregated fit allocator with constant time malloc/free
+ * @version 1.0
+ * @date 2020-11-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Tlsf.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Set up the allocator on an arena.
+ *
+ * @details The arena is trimmed to kAlignment at both ends. It becomes one
+ * large free block followed by a used sentinel of size 0, which stops
+ * merging at the end of the arena.
+ *
+ * @param arena Memory to manage, stays owned by the allocator.
+ * @param arenaBytes Size of the arena.
+ */
+Memory::Tlsf::Tlsf(void* arena, size_t arenaBytes)
+        : begin(reinterpret_cast<uint8_t*>(
+              (reinterpret_cast<uintptr_t>(arena) + kAlignment - 1) &
+              ~(kAlignment - 1))),
+          end(reinterpret_cast<uint8_t*>(
+              (reinterpret_cast<uintptr_t>(arena) + arenaBytes) &
+              ~(kAlignment - 1))),
+          firstLevelMap(0), secondLevelMaps {}, freeLists {}, totalBytes(0),
+          freeBytes(0), liveBytes(0), peakBytes(0), liveAllocations(0),
+          failedAllocations(0), trackingCallSites(false), callSites {}
+{
+    if (end < begin + 2 * kHeaderSize + kMinBlockSize) {
+        CHECK_ERROR(Error::InvalidParameter);
+        return;
+    }
+
+    auto size = static_cast<size_t>(end - begin) - 2 * kHeaderSize;
+    if (size >= (size_t {1} << kFirstLevelMax)) {
+        size = (size_t {1} << kFirstLevelMax) - kAlignment;
+    }
+
+    auto first      = reinterpret_cast<Block*>(begin);
+    first->prevPhys = nullptr;
+    first->setSize(size);
+    first->setFree(true);
+
+    auto sentinel      = first->nextPhys();
+    sentinel->prevPhys = first;
+    sentinel->setSize(0);
+    sentinel->setFree(false);
+
+    totalBytes = size;
+    insertFree(first);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Allocate memory in constant time.
+ *
+ * @param bytes Bytes needed, 0 is treated as the minimum block.
+ * @param callSite Counted when call site tracking is on, nullptr to skip.
+ * @return void* Aligned memory or nullptr if no free block is large enough.
+ */
+void* Memory::Tlsf::allocate(size_t bytes, const void* callSite)
+{
+    auto size = adjustSize(bytes);
+    if (size == 0) {
+        failedAllocations++;
+        return nullptr;
+    }
+
+    unsigned fl;
+    unsigned sl;
+    mapSearch(size, fl, sl);
+    auto block = findFree(fl, sl);
+    if (block == nullptr) {
+        failedAllocations++;
+        return nullptr;
+    }
+
+    removeFree(block);
+    split(block, size);
+    block->setFree(false);
+    countAllocation(block, bytes, callSite);
+    return block->payload();
+}
+
+/**
+ * @brief Resize an allocation, keeping its content.
+ *
+ * @details Grows in place into a free successor if possible, otherwise
+ * allocates, copies and frees.
+ *
+ * @param pointer Allocation to resize, nullptr allocates.
+ * @param bytes New size, 0 frees the allocation.
+ * @param callSite Counted when a new block has to be allocated.
+ * @return void* New location, nullptr on failure (pointer stays valid then).
+ */
+void* Memory::Tlsf::reallocate(void*       pointer,
+                               size_t      bytes,
+                               const void* callSite)
+{
+    if (pointer == nullptr) {
+        return allocate(bytes, callSite);
+    }
+    if (bytes == 0) {
+        CHECK_ERROR(free(pointer));
+        return nullptr;
+    }
+
+    if (!owns(pointer) || Block::fromPayload(pointer)->isFree()) {
+        CHECK_ERROR(Error::InvalidParameter);
+        return nullptr;
+    }
+
+    auto block = Block::fromPayload(pointer);
+    auto size  = adjustSize(bytes);
+    if (size == 0) {
+        failedAllocations++;
+        return nullptr;
+    }
+
+    auto next = block->nextPhys();
+    if ((size > block->getSize()) && next->isFree() &&
+        (block->getSize() + kHeaderSize + next->getSize() >= size)) {
+        liveBytes -= block->getSize();
+        mergeNext(block);
+        split(block, size);
+        liveBytes += block->getSize();
+        if (liveBytes > peakBytes) {
+            peakBytes = liveBytes;
+        }
+    }
+
+    if (size <= block->getSize()) {
+        liveBytes -= block->getSize();
+        split(block, size);
+        liveBytes += block->getSize();
+        return pointer;
+    }
+
+    auto newPointer = allocate(bytes, callSite);
+    if (newPointer != nullptr) {
+        memcpy(newPointer, pointer, block->getSize());
+        CHECK_ERROR(free(pointer));
+    }
+    return newPointer;
+}
+
+/**
+ * @brief Return memory to the arena in constant time.
+ *
+ * @param pointer Allocation to free, nullptr is ignored.
+ * @return Error::Code InvalidParameter if pointer is not a live allocation of
+ * this arena (double free included).
+ */
+Error::Code Memory::Tlsf::free(void* pointer)
+{
+    if (pointer == nullptr) {
+        return Error::None;
+    }
+    if (!owns(pointer)) {
+        return Error::InvalidParameter;
+    }
+
+    auto block = Block::fromPayload(pointer);
+    if (block->isFree()) {
+        return Error::InvalidParameter;
+    }
+
+    liveBytes -= block->getSize();
+    liveAllocations--;
+
+    block->setFree(true);
+    block = mergePrev(block);
+    mergeNext(block);
+    insertFree(block);
+    return Error::None;
+}
+
+/**
+ * @brief Bytes that can be used behind an allocation.
+ *
+ * @param pointer Live allocation of this arena.
+ * @return size_t At least the requested size.
+ */
+size_t Memory::Tlsf::usableSize(const void* pointer) const
+{
+    return owns(pointer) ? Block::fromPayload(pointer)->getSize() : 0;
+}
+
+/**
+ * @brief Check whether a pointer lies in the arena and is aligned like a
+ * payload.
+ *
+ * @param pointer Pointer to check.
+ * @return true pointer might be an allocation of this arena
+ */
+bool Memory::Tlsf::owns(const void* pointer) const
+{
+    auto address = static_cast<const uint8_t*>(pointer);
+    return (address >= begin + kHeaderSize) && (address < end) &&
+           ((reinterpret_cast<uintptr_t>(address) & (kAlignment - 1)) == 0);
+}
+
+/**
+ * @brief Snapshot of usage and fragmentation.
+ *
+ * @details Finding the largest free block walks a single size class, all
+ * other values are kept up to date on every call.
+ *
+ * @return Stats Current state.
+ */
+Memory::Stats Memory::Tlsf::getStats() const
+{
+    Stats stats {};
+    stats.totalBytes        = totalBytes;
+    stats.liveBytes         = liveBytes;
+    stats.peakBytes         = peakBytes;
+    stats.freeBytes         = freeBytes;
+    stats.liveAllocations   = liveAllocations;
+    stats.failedAllocations = failedAllocations;
+
+    if (firstLevelMap != 0) {
+        unsigned fl = 31 - __builtin_clz(firstLevelMap);
+        unsigned sl = 31 - __builtin_clz(secondLevelMaps[fl]);
+        for (auto block = freeLists[fl][sl]; block != nullptr;
+             block      = block->nextFree) {
+            if (block->getSize() > stats.largestFreeBlock) {
+                stats.largestFreeBlock = block->getSize();
+            }
+        }
+    }
+
+    if (stats.freeBytes > 0) {
+        stats.fragmentationPercent = static_cast<uint8_t>(
+            100 - (stats.largestFreeBlock * 100) / stats.freeBytes);
+    }
+    return stats;
+}
+
+/**
+ * @brief Switch counting allocations per call site on or off.
+ *
+ * @details Costs a search through kMaxCallSites entries per allocation while
+ * on. Call sites beyond kMaxCallSites are not counted.
+ *
+ * @param active true to count call sites
+ */
+void Memory::Tlsf::trackCallSites(bool active)
+{
+    trackingCallSites = active;
+}
+
+/**
+ * @brief Copy out the counted call sites.
+ *
+ * @param sites Array to copy into.
+ * @param maxSites Size of sites.
+ * @return size_t Number of entries copied.
+ */
+size_t Memory::Tlsf::getCallSites(CallSite* sites, size_t maxSites) const
+{
+    size_t count = 0;
+    for (auto& site : callSites) {
+        if ((site.address == nullptr) || (count >= maxSites)) {
+            break;
+        }
+        sites[count++] = site;
+    }
+    return count;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Smallest free block class that is guaranteed to fit.
+ *
+ * @param fl Class to start at, set to the class found.
+ * @param sl Class to start at, set to the class found.
+ * @return Block* Head of that class, nullptr if none fits.
+ */
+Memory::Tlsf::Block* Memory::Tlsf::findFree(unsigned& fl, unsigned& sl) const
+{
+    if (fl >= kFirstLevelCount) {
+        return nullptr;
+    }
+
+    uint32_t slMap = secondLevelMaps[fl] & (~uint32_t {0} << sl);
+    if (slMap == 0) {
+        // nothing in this first level, take the next larger one
+        uint32_t flMap = firstLevelMap & (~uint32_t {0} << (fl + 1));
+        if (flMap == 0) {
+            return nullptr;
+        }
+        fl    = __builtin_ctz(flMap);
+        slMap = secondLevelMaps[fl];
+    }
+    sl = __builtin_ctz(slMap);
+    return freeLists[fl][sl];
+}
+
+/**
+ * @brief Put a free block at the head of its size class.
+ *
+ */
+void Memory::Tlsf::insertFree(Block* block)
+{
+    unsigned fl;
+    unsigned sl;
+    mapInsert(block->getSize(), fl, sl);
+
+    block->prevFree = nullptr;
+    block->nextFree = freeLists[fl][sl];
+    if (block->nextFree != nullptr) {
+        block->nextFree->prevFree = block;
+    }
+    freeLists[fl][sl] = block;
+    freeBytes += block->getSize();
+    firstLevelMap |= uint32_t {1} << fl;
+    secondLevelMaps[fl] |= uint32_t {1} << sl;
+}
+
+/**
+ * @brief Take a free block out of its size class.
+ *
+ */
+void Memory::Tlsf::removeFree(Block* block)
+{
+    unsigned fl;
+    unsigned sl;
+    mapInsert(block->getSize(), fl, sl);
+    freeBytes -= block->getSize();
+
+    if (block->nextFree != nullptr) {
+        block->nextFree->prevFree = block->prevFree;
+    }
+    if (block->prevFree != nullptr) {
+        block->prevFree->nextFree = block->nextFree;
+    } else {
+        freeLists[fl][sl] = block->nextFree;
+        if (freeLists[fl][sl] == nullptr) {
+            secondLevelMaps[fl] &= ~(uint32_t {1} << sl);
+            if (secondLevelMaps[fl] == 0) {
+                firstLevelMap &= ~(uint32_t {1} << fl);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Shrink a block that is not in a free list to size, the rest
+ * becomes a new free block if it is large enough to hold one.
+ *
+ */
+void Memory::Tlsf::split(Block* block, size_t size)
+{
+    if (block->getSize() < size + kHeaderSize + kMinBlockSize) {
+        return;
+    }
+
+    auto restSize = block->getSize() - size - kHeaderSize;
+    block->setSize(size);
+
+    auto rest      = block->nextPhys();
+    rest->prevPhys = block;
+    rest->setSize(restSize);
+    rest->setFree(true);
+    rest->nextPhys()->prevPhys = rest;
+
+    // the block behind might be free as well
+    mergeNext(rest);
+    insertFree(rest);
+}
+
+/**
+ * @brief Merge a block with its physical predecessor if that one is free.
+ *
+ * @return Block* The merged block.
+ */
+Memory::Tlsf::Block* Memory::Tlsf::mergePrev(Block* block)
+{
+    auto prev = block->prevPhys;
+    if ((prev == nullptr) || !prev->isFree()) {
+        return block;
+    }
+
+    removeFree(prev);
+    prev->setSize(prev->getSize() + kHeaderSize + block->getSize());
+    prev->nextPhys()->prevPhys = prev;
+    return prev;
+}
+
+/**
+ * @brief Merge a block with its physical successor if that one is free.
+ *
+ */
+void Memory::Tlsf::mergeNext(Block* block)
+{
+    auto next = block->nextPhys();
+    if (!next->isFree()) {
+        return;
+    }
+
+    removeFree(next);
+    block->setSize(block->getSize() + kHeaderSize + next->getSize());
+    block->nextPhys()->prevPhys = block;
+}
+
+/**
+ * @brief Update statistics after a successful allocation.
+ *
+ */
+void Memory::Tlsf::countAllocation(Block*      block,
+                                   size_t      bytes,
+                                   const void* callSite)
+{
+    liveBytes += block->getSize();
+    liveAllocations++;
+    if (liveBytes > peakBytes) {
+        peakBytes = liveBytes;
+    }
+
+    if (!trackingCallSites || (callSite == nullptr)) {
+        return;
+    }
+    for (auto& site : callSites) {
+        if (site.address == nullptr) {
+            site.address = callSite;
+        }
+        if (site.address == callSite) {
+            site.allocations++;
+            site.bytes += bytes;
+            return;
+        }
+    }
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Size class a block of size belongs to.
+ *
+ */
+void Memory::Tlsf::mapInsert(size_t size, unsigned& fl, unsigned& sl)
+{
+    if (size < kSmallBlockSize) {
+        fl = 0;
+        sl = size / (kSmallBlockSize / kSecondLevelCount);
+    } else {
+        unsigned log2 = 31 - __builtin_clz(static_cast<uint32_t>(size));
+        sl = (size >> (log2 - kSecondLevelLog2)) ^ (1u << kSecondLevelLog2);
+        fl = log2 - (kFirstLevelShift - 1);
+    }
+}
+
+/**
+ * @brief Size class from which on every block fits size.
+ *
+ * @details Rounds size up to the next class boundary, so the head of any
+ * non empty class found is large enough without walking the list.
+ */
+void Memory::Tlsf::mapSearch(size_t size, unsigned& fl, unsigned& sl)
+{
+    if (size >= kSmallBlockSize) {
+        unsigned log2 = 31 - __builtin_clz(static_cast<uint32_t>(size));
+        size += (size_t {1} << (log2 - kSecondLevelLog2)) - 1;
+    }
+    mapInsert(size, fl, sl);
+}
+
+/**
+ * @brief Payload size a request of bytes occupies.
+ *
+ * @return size_t Aligned size, 0 if bytes is too large for any block.
+ */
+size_t Memory::Tlsf::adjustSize(size_t bytes)
+{
+    if (bytes >= (size_t {1} << kFirstLevelMax) - kAlignment) {
+        return 0;
+    }
+    auto size = (bytes + kAlignment - 1) & ~(kAlignment - 1);
+    return (size < kMinBlockSize) ? kMinBlockSize : size;
+}
+
+/**
+ * @brief Payload size of the block.
+ *
+ */
+size_t Memory::Tlsf::Block::getSize() const
+{
+    return sizeAndFlags & ~kFreeFlag;
+}
+
+/**
+ * @brief Change payload size, keeps the flags.
+ *
+ */
+void Memory::Tlsf::Block::setSize(size_t size)
+{
+    sizeAndFlags = size | (sizeAndFlags & kFreeFlag);
+}
+
+/**
+ * @brief Whether the block is in a free list or about to be put there.
+ *
+ */
+bool Memory::Tlsf::Block::isFree() const
+{
+    return (sizeAndFlags & kFreeFlag) != 0;
+}
+
+/**
+ * @brief Mark the block free or used.
+ *
+ */
+void Memory::Tlsf::Block::setFree(bool free)
+{
+    sizeAndFlags =
+        free ? (sizeAndFlags | kFreeFlag) : (sizeAndFlags & ~kFreeFlag);
+}
+
+/**
+ * @brief Memory handed out for this block.
+ *
+ */
+void* Memory::Tlsf::Block::payload()
+{
+    return reinterpret_cast<uint8_t*>(this) + kHeaderSize;
+}
+
+/**
+ * @brief Block physically behind this one.
+ *
+ */
+Memory::Tlsf::Block* Memory::Tlsf::Block::nextPhys()
+{
+    return reinterpret_cast<Block*>(static_cast<uint8_t*>(payload()) +
+                                    getSize());
+}
+
+/**
+ * @brief Block header of a payload.
+ *
+ */
+Memory::Tlsf::Block* Memory::Tlsf::Block::fromPayload(const void* payload)
+{
+    return reinterpret_cast<Block*>(
+        const_cast<uint8_t*>(static_cast<const uint8_t*>(payload)) -
+        kHeaderSize);
+}
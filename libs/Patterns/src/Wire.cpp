@@ -0,0 +1,119 @@
+/**
+ * @file Wire.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief serializer for packed frames with fixed byte order
+ * @version 1.0
+ * @date 2020-11-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "Wire.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief Write value to the first kSize bytes of buffer.
+ *
+ */
+template<class T, Endians::ByteOrder order>
+void Wire::Value<T, order>::encode(uint8_t* buffer, const T& value)
+{
+    T copy = value;
+    if (order == Endians::big) {
+        Endians::machineToBig(copy);
+    } else {
+        Endians::machineToLittle(copy);
+    }
+    std::memcpy(buffer, &copy, kSize);
+}
+
+/**
+ * @brief Read value from the first kSize bytes of buffer.
+ *
+ */
+template<class T, Endians::ByteOrder order>
+void Wire::Value<T, order>::decode(const uint8_t* buffer, T& value)
+{
+    std::memcpy(&value, buffer, kSize);
+    if (order == Endians::big) {
+        Endians::bigToMachine(value);
+    } else {
+        Endians::littleToMachine(value);
+    }
+}
+
+/**
+ * @brief Write values to the first kSize bytes of buffer.
+ *
+ */
+template<class T, size_t count, Endians::ByteOrder order>
+void Wire::Array<T, count, order>::encode(uint8_t* buffer, const Type& values)
+{
+    if (order == Endians::native) {
+        std::memcpy(buffer, values.data(), kSize);
+    } else {
+        // buffer might not be aligned for T
+        Type copy = values;
+        Endians::swapArray(copy.data(), count);
+        std::memcpy(buffer, copy.data(), kSize);
+    }
+}
+
+/**
+ * @brief Read values from the first kSize bytes of buffer.
+ *
+ */
+template<class T, size_t count, Endians::ByteOrder order>
+void Wire::Array<T, count, order>::decode(const uint8_t* buffer, Type& values)
+{
+    std::memcpy(values.data(), buffer, kSize);
+    if (order != Endians::native) {
+        Endians::swapArray(values.data(), count);
+    }
+}
+
+/**
+ * @brief Write all fields to the first kSize bytes of buffer.
+ *
+ * @param buffer Frame to write, has to hold kSize bytes.
+ * @param values One value per field, in order of Fields.
+ */
+template<class... Fields>
+void Wire::Struct<Fields...>::encode(uint8_t* buffer,
+                                     const typename Fields::Type&... values)
+{
+    size_t offset = 0;
+    ((Fields::encode(buffer + offset, values), offset += Fields::kSize), ...);
+}
+
+/**
+ * @brief Read all fields from the first kSize bytes of buffer.
+ *
+ * @param buffer Frame to read, has to hold kSize bytes.
+ * @param values One value per field, in order of Fields.
+ */
+template<class... Fields>
+void Wire::Struct<Fields...>::decode(const uint8_t* buffer,
+                                     typename Fields::Type&... values)
+{
+    size_t offset = 0;
+    ((Fields::decode(buffer + offset, values), offset += Fields::kSize), ...);
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,157 @@
+/**
+ * @file BenchCase.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief base class for micro benchmarks written in aconno libraries
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHCASE_H__
+#define __BENCHCASE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Bench
+{
+class Case;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <PatternsPort.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+
+namespace Bench
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief base class for micro benchmarks, registered like Test::Base.
+ *
+ * @details A case runs its operation in batches of batch calls. After
+ * warmup batches that are not measured, every one of repetitions batches
+ * is timed with Port::getCycleCount(), which counts CPU cycles on target.
+ * min, median and p99 per call are printed as one JSON line per case:
+ * @code
+ * {"bench":"Patterns::Bitfield.get","hz":64000000,"batch":64,"reps":101,
+ *  "min":5,"median":5,"p99":6}
+ * @endcode
+ * Cases that move data add "bytes", the payload bytes copied per call.
+ *
+ * The output of one run is the baseline of the next. With a baseline every
+ * case reports the change of its median and fails if it got slower than
+ * the tolerance.
+ *
+ * Implement cases as eager loading singletons, like tests.
+ */
+class Case
+{
+public:
+    /** measured batches if not given otherwise */
+    static constexpr uint16_t kDefaultRepetitions = 101;
+    /** unmeasured batches before the measurement */
+    static constexpr uint16_t kDefaultWarmup = 5;
+    /** most batches a case can measure */
+    static constexpr uint16_t kMaxRepetitions = 256;
+
+    /**
+     * @brief cycles per call over all repetitions
+     */
+    struct Stats
+    {
+        uint32_t min;
+        uint32_t median;
+        uint32_t p99;
+    };
+
+    /**
+     * @brief median of a case from an earlier run
+     */
+    struct Reference
+    {
+        const char *name; /**< module::case as in the JSON output */
+        uint32_t median; /**< median cycles per call */
+    };
+
+    // delete default constructors
+    Case() = delete;
+    Case(const Case &other) = delete;
+    Case &operator=(const Case &other) = delete;
+
+    Case(const char *const moduleName,
+         const char *const caseName,
+         uint16_t batch = 1,
+         uint16_t repetitions = kDefaultRepetitions,
+         uint16_t warmup = kDefaultWarmup);
+
+    const char *const getModule();
+    const char *const getName();
+    Stats measure();
+
+    static bool runAll(const Reference *baseline = nullptr,
+                       size_t baselineSize = 0,
+                       uint32_t tolerancePercent = 10);
+
+protected:
+    /**
+     * @brief implement the measured operation, called batch times per
+     * measurement. Results have to be used, e.g. in a volatile sink, or the
+     * compiler removes them.
+     *
+     * @param batch number of calls
+     */
+    virtual void runBatch(uint16_t batch) = 0;
+
+    /**
+     * @brief prepare data before the warmup, not measured
+     */
+    virtual void setUp() {}
+
+    /**
+     * @brief free what setUp() took, not measured
+     */
+    virtual void tearDown() {}
+
+    /**
+     * @brief payload bytes one call copies, printed next to the cycles
+     *
+     * @return 0 if the case does not report it
+     */
+    virtual uint32_t getBytesCopied() { return 0; }
+
+private:
+    const Reference *findReference(const Reference *baseline,
+                                   size_t baselineSize);
+
+    static uint32_t measureOverhead();
+
+    /** module of the case */
+    const char *const moduleName;
+    /** what is measured */
+    const char *const caseName;
+    /** calls per measurement */
+    const uint16_t batch;
+    /** measured batches */
+    const uint16_t repetitions;
+    /** unmeasured batches */
+    const uint16_t warmup;
+
+    /** list of all cases */
+    static std::list<Case *> cases;
+    /** cycles of each repetition, shared by all cases */
+    static uint32_t samples[kMaxRepetitions];
+    /** cycles of reading the counter twice */
+    static uint32_t overhead;
+    /** internal buffer for the JSON output */
+    static char strBuffer[192];
+};
+}  // namespace Bench
+#endif  //__BENCHCASE_H__
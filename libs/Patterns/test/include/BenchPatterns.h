@@ -0,0 +1,161 @@
+/**
+ * @file BenchPatterns.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmarks of the Patterns library
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __BENCHPATTERNS_H__
+#define __BENCHPATTERNS_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Bench
+{
+class BitfieldGet;
+class BitfieldSet;
+class EndiansSwapArray;
+class HashTableFind;
+class LifetimeListFind;
+}  // namespace Bench
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchCase.h"
+
+#include <Bitfield.h>
+#include <HashTable.h>
+#include <LifetimeList.h>
+#include <array>
+#include <memory>
+
+namespace Bench
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief signed 12 bit field crossing a byte border, as in sensor registers
+ */
+using SensorField = Endians::Bitfield<int16_t, 5, 12>;
+
+/**
+ * @brief reading a field out of a register block
+ */
+class BitfieldGet : public Case
+{
+public:
+    static BitfieldGet &getInstance();
+
+private:
+    BitfieldGet();
+    virtual void runBatch(uint16_t batch) final;
+
+    std::array<uint8_t, 4> registers;
+
+    static BitfieldGet instance;
+};
+
+/**
+ * @brief writing a field into a register block
+ */
+class BitfieldSet : public Case
+{
+public:
+    static BitfieldSet &getInstance();
+
+private:
+    BitfieldSet();
+    virtual void runBatch(uint16_t batch) final;
+
+    std::array<uint8_t, 4> registers;
+
+    static BitfieldSet instance;
+};
+
+/**
+ * @brief byte swap of a buffer of 16 bit samples
+ */
+class EndiansSwapArray : public Case
+{
+    static constexpr size_t kSamples = 64;
+
+public:
+    static EndiansSwapArray &getInstance();
+
+private:
+    EndiansSwapArray();
+    virtual void runBatch(uint16_t batch) final;
+
+    std::array<uint16_t, kSamples> samples;
+
+    static EndiansSwapArray instance;
+};
+
+/**
+ * @brief lookup of 32 BLE addresses in a hash table, compare with
+ * LifetimeListFind
+ */
+class HashTableFind : public Case
+{
+    static constexpr uint32_t kEntries = 32;
+
+    /** 48 bit address, like a BLE MAC */
+    using Address = std::array<uint8_t, 6>;
+
+    /**
+     * @brief folds an address into a well mixed hash.
+     *
+     */
+    struct AddressHash {
+        uint32_t operator()(const Address &address) const;
+    };
+
+    using Table =
+        Collections::HashTable<Address, uint32_t, kEntries, AddressHash>;
+
+public:
+    static HashTableFind &getInstance();
+
+private:
+    HashTableFind();
+    virtual void runBatch(uint16_t batch) final;
+    virtual void setUp() final;
+    virtual void tearDown() final;
+
+    static Address makeAddress(uint32_t number);
+
+    Table table;
+
+    static HashTableFind instance;
+};
+
+/**
+ * @brief linear search in a list of 32 entries, as for BLE devices
+ */
+class LifetimeListFind : public Case
+{
+    static constexpr uint32_t kEntries = 32;
+    using List = Collections::LifetimeList<uint32_t>;
+
+public:
+    static LifetimeListFind &getInstance();
+
+private:
+    LifetimeListFind();
+    virtual void runBatch(uint16_t batch) final;
+    virtual void setUp() final;
+    virtual void tearDown() final;
+
+    List list;
+    std::array<std::unique_ptr<List::Node>, kEntries> nodes;
+
+    static LifetimeListFind instance;
+};
+}  // namespace Bench
+#endif  //__BENCHPATTERNS_H__
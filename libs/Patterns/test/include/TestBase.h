@@ -69,8 +69,10 @@ public:
     /**
      * @brief function runs all test instances in the project.
      *
+     * @return true all tests succeeded
+     * @return false at least one test failed or could not be run
      */
-    static void runAllTests();
+    static bool runAllTests();
 
     // interface implementation
 public:
@@ -48,6 +48,10 @@ private:
     Bitfield();
     static Bitfield instance;
 
+    void testRegisterMap();
+    template<class Field>
+    void compare(const char* name);
+
     using LSB = Endians::Bitfield<bool, 0, 1>;
     using MSB = Endians::Bitfield<bool, 7, 1>;
     using LSBInversePeripheral =
@@ -93,6 +97,40 @@ private:
                                                  Endians::ByteOrder::little>;
     using SignedInt          = Endians::Bitfield<signed int, 0, 3>;
 
+    using SignedBigMsb   = Endians::Bitfield<int32_t,
+                                             5,
+                                             20,
+                                             Endians::BitOrder::MSBAtZero,
+                                             Endians::BitOrder::MSBAtZero,
+                                             Endians::ByteOrder::big>;
+    using Unaligned64Lsb = Endians::Bitfield<uint64_t,
+                                             3,
+                                             64,
+                                             Endians::BitOrder::LSBAtZero,
+                                             Endians::BitOrder::MSBAtZero>;
+    using Unaligned64Msb = Endians::Bitfield<uint64_t,
+                                             3,
+                                             64,
+                                             Endians::BitOrder::MSBAtZero,
+                                             Endians::BitOrder::LSBAtZero,
+                                             Endians::ByteOrder::big>;
+    using FloatBig       = Endians::Bitfield<float,
+                                             4,
+                                             32,
+                                             Endians::BitOrder::LSBAtZero,
+                                             Endians::BitOrder::LSBAtZero,
+                                             Endians::ByteOrder::big>;
+
+    /** status byte followed by a 12 bit temperature, as sent by a sensor */
+    using Ready       = Endians::Bitfield<bool, 7, 1>;
+    using Mode        = Endians::Bitfield<uint8_t, 0, 3>;
+    using Temperature = Endians::Bitfield<int16_t,
+                                          8,
+                                          12,
+                                          Endians::BitOrder::MSBAtZero,
+                                          Endians::BitOrder::MSBAtZero>;
+    using Registers   = Endians::RegisterMap<Ready, Mode, Temperature>;
+
     static constexpr uint8_t                kData1 = 0b01000101;
     static constexpr std::array<uint8_t, 3> kData2 = {0b01000101,
                                                       0b00000011,
@@ -45,6 +45,8 @@ private:
     Endians();
     static Endians instance;
 
+    void testSwapArray();
+
     static constexpr uint16_t TEST_VAL_U16 = (2 << 8) + 1;
     static constexpr uint32_t TEST_VAL_U32 =
         (4 << 24) + (3 << 16) + (2 << 8) + 1;
@@ -0,0 +1,135 @@
+/**
+ * @file TestFsm.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the table driven state machine
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTFSM_H__
+#define __TESTFSM_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Fsm;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Fsm.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the table driven state machine
+ */
+class Fsm : public Base {
+    // delete default constructors
+    Fsm(const Fsm& other) = delete;
+    Fsm& operator=(const Fsm& other) = delete;
+
+public:
+    virtual void runInternal() final;
+    static Fsm&  getInstance();
+
+private:
+    Fsm();
+    static Fsm instance;
+
+    /**
+     * @brief logs all actions, upper case letters for entry, lower case for
+     * exit and digits for transitions.
+     *
+     */
+    struct Sensor {
+        char   log[32];
+        char   checked[32]; /**< log at the last check() */
+        size_t length;
+
+        void append(char action);
+        bool check(const char* expected);
+
+        void enterIdle() { append('I'); }
+        void exitIdle() { append('i'); }
+        void enterActive() { append('A'); }
+        void exitActive() { append('a'); }
+        void enterMeasuring() { append('M'); }
+        void exitMeasuring() { append('m'); }
+        void enterReading() { append('R'); }
+        void exitReading() { append('r'); }
+        void powerUp() { append('1'); }
+        void powerDown() { append('2'); }
+        void fetch() { append('3'); }
+        void tick() { append('4'); }
+    };
+
+    /**
+     * @brief Measuring and Reading are sub states of Active.
+     *
+     */
+    struct Machine {
+        using Context = Sensor;
+        enum class State : uint8_t { Idle, Active, Measuring, Reading, Count };
+        enum class Event : uint8_t {
+            Start,
+            Stop,
+            DataReady,
+            Done,
+            Tick,
+            Reset,
+            Count
+        };
+
+        static constexpr State kInitial = State::Idle;
+
+        static constexpr Patterns::FsmState<Sensor, State> states[] = {
+            {State::Idle,
+             State::Count,
+             State::Count,
+             &Sensor::enterIdle,
+             &Sensor::exitIdle},
+            {State::Active,
+             State::Count,
+             State::Measuring,
+             &Sensor::enterActive,
+             &Sensor::exitActive},
+            {State::Measuring,
+             State::Active,
+             State::Count,
+             &Sensor::enterMeasuring,
+             &Sensor::exitMeasuring},
+            {State::Reading,
+             State::Active,
+             State::Count,
+             &Sensor::enterReading,
+             &Sensor::exitReading}};
+
+        static constexpr Patterns::FsmTransition<Sensor, State, Event>
+            transitions[] = {
+                {State::Idle, Event::Start, State::Active, &Sensor::powerUp},
+                {State::Active, Event::Stop, State::Idle, &Sensor::powerDown},
+                {State::Measuring,
+                 Event::DataReady,
+                 State::Reading,
+                 &Sensor::fetch},
+                {State::Reading, Event::Done, State::Measuring, nullptr},
+                {State::Active, Event::Tick, State::Count, &Sensor::tick},
+                {State::Reading, Event::Tick, State::Reading, nullptr},
+                {State::Active, Event::Reset, State::Measuring, nullptr}};
+    };
+
+    using State = Machine::State;
+    using Event = Machine::Event;
+};
+}  // namespace Test
+#endif  //__TESTFSM_H__
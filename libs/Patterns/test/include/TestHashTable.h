@@ -0,0 +1,82 @@
+/**
+ * @file TestHashTable.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity hash table
+ * @version 1.0
+ * @date 2020-11-09
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTHASHTABLE_H__
+#define __TESTHASHTABLE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class HashTable;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <HashTable.h>
+#include <TestBase.h>
+#include <array>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed capacity hash table
+ */
+class HashTable : public Base {
+    // delete default constructors
+    HashTable(const HashTable& other) = delete;
+    HashTable& operator=(const HashTable& other) = delete;
+
+public:
+    virtual void      runInternal() final;
+    static HashTable& getInstance();
+
+private:
+    HashTable();
+    static HashTable instance;
+
+    /** 48 bit address, like a BLE MAC */
+    using Address = std::array<uint8_t, 6>;
+
+    /**
+     * @brief folds an address into a well mixed hash.
+     *
+     */
+    struct AddressHash {
+        uint32_t operator()(const Address& address) const;
+    };
+
+    /**
+     * @brief counts its living instances
+     *
+     */
+    struct Counted {
+        static int alive;
+        uint32_t   value;
+
+        Counted(uint32_t value) : value(value) { alive++; }
+        ~Counted() { alive--; }
+    };
+
+    using SmallTable = Collections::HashTable<Address, Counted, 4, AddressHash>;
+
+    void testInsertFind();
+    void testEviction();
+    void testCollisions();
+
+    static Address makeAddress(uint32_t number);
+};
+}  // namespace Test
+#endif  //__TESTHASHTABLE_H__
@@ -0,0 +1,98 @@
+/**
+ * @file TestObservable.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the intrusive and the static observer pattern
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTOBSERVABLE_H__
+#define __TESTOBSERVABLE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Observable;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Observable.h>
+#include <Observer.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the intrusive and the static observer pattern
+ */
+class Observable : public Base {
+    // delete default constructors
+    Observable(const Observable& other) = delete;
+    Observable& operator=(const Observable& other) = delete;
+
+public:
+    virtual void       runInternal() final;
+    static Observable& getInstance();
+
+private:
+    Observable();
+    static Observable instance;
+
+    /**
+     * @brief makes trigger() accessible
+     *
+     */
+    struct Subject : public Patterns::Observable<uint32_t> {
+        using Patterns::Observable<uint32_t>::trigger;
+    };
+
+    /**
+     * @brief remembers the last value and the order of the calls.
+     *
+     */
+    struct Watcher : public Patterns::Observer<uint32_t> {
+        Watcher(Subject& subject, bool unregisterOnCall = false);
+
+        virtual void handle(Patterns::Observable<uint32_t>& observable,
+                            uint32_t                        value) final;
+
+        static uint32_t calls;
+        uint32_t        lastValue;
+        uint32_t        callNumber;
+        bool            unregisterOnCall;
+    };
+
+    /**
+     * @brief static observers, add their value to sum.
+     *
+     */
+    template<uint32_t factor>
+    struct Adder {
+        static void handle(uint32_t value);
+    };
+
+    /**
+     * @brief makes trigger() accessible
+     *
+     */
+    struct StaticSubject : public Patterns::StaticObservable<Adder<1>, Adder<10>> {
+        using Patterns::StaticObservable<Adder<1>, Adder<10>>::trigger;
+    };
+
+    static uint32_t sum;
+
+    void testRegistration();
+    void testUnregisterInHandle();
+    void testStatic();
+};
+}  // namespace Test
+#endif  //__TESTOBSERVABLE_H__
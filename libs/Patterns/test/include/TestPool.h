@@ -0,0 +1,66 @@
+/**
+ * @file TestPool.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed block memory pools
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTPOOL_H__
+#define __TESTPOOL_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Pool;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Pool.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed block memory pools
+ */
+class Pool : public Base {
+    // delete default constructors
+    Pool(const Pool& other) = delete;
+    Pool& operator=(const Pool& other) = delete;
+
+public:
+    virtual void runInternal() final;
+    static Pool& getInstance();
+
+private:
+    Pool();
+    static Pool instance;
+
+    void testBlockPool();
+    void testBuffer();
+    void testObjectPool();
+
+    /**
+     * @brief counts its living instances
+     *
+     */
+    struct Counted {
+        static int alive;
+        uint32_t   value;
+
+        Counted(uint32_t value) : value(value) { alive++; }
+        ~Counted() { alive--; }
+    };
+};
+}  // namespace Test
+#endif  //__TESTPOOL_H__
@@ -0,0 +1,67 @@
+/**
+ * @file TestRingBuffer.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity ring buffer
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTRINGBUFFER_H__
+#define __TESTRINGBUFFER_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class RingBuffer;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <RingBuffer.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed capacity ring buffer
+ */
+class RingBuffer : public Base {
+    // delete default constructors
+    RingBuffer(const RingBuffer& other) = delete;
+    RingBuffer& operator=(const RingBuffer& other) = delete;
+
+public:
+    virtual void       runInternal() final;
+    static RingBuffer& getInstance();
+
+private:
+    RingBuffer();
+    static RingBuffer instance;
+
+    /**
+     * @brief counts its living instances
+     *
+     */
+    struct Counted {
+        static int alive;
+        uint32_t   value;
+
+        Counted(uint32_t value) : value(value) { alive++; }
+        Counted(const Counted& other) : value(other.value) { alive++; }
+        Counted& operator=(const Counted& other) = default;
+        ~Counted() { alive--; }
+    };
+
+    void testFifo();
+    void testOverwrite();
+};
+}  // namespace Test
+#endif  //__TESTRINGBUFFER_H__
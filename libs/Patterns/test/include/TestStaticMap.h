@@ -0,0 +1,54 @@
+/**
+ * @file TestStaticMap.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity sorted map
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTSTATICMAP_H__
+#define __TESTSTATICMAP_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class StaticMap;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <StaticMap.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed capacity sorted map
+ */
+class StaticMap : public Base {
+    // delete default constructors
+    StaticMap(const StaticMap& other) = delete;
+    StaticMap& operator=(const StaticMap& other) = delete;
+
+public:
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+    static StaticMap&              getInstance();
+
+private:
+    StaticMap();
+    static StaticMap instance;
+
+    void testInsertFind();
+    void testOrder();
+};
+}  // namespace Test
+#endif  //__TESTSTATICMAP_H__
@@ -0,0 +1,53 @@
+/**
+ * @file TestStaticString.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity string
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTSTATICSTRING_H__
+#define __TESTSTATICSTRING_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class StaticString;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <StaticString.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed capacity string
+ */
+class StaticString : public Base {
+    // delete default constructors
+    StaticString(const StaticString& other) = delete;
+    StaticString& operator=(const StaticString& other) = delete;
+
+public:
+    virtual void         runInternal() final;
+    static StaticString& getInstance();
+
+private:
+    StaticString();
+    static StaticString instance;
+
+    void testAssign();
+    void testCompare();
+};
+}  // namespace Test
+#endif  //__TESTSTATICSTRING_H__
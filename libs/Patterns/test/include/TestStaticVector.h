@@ -0,0 +1,68 @@
+/**
+ * @file TestStaticVector.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity vector
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTSTATICVECTOR_H__
+#define __TESTSTATICVECTOR_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class StaticVector;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <StaticVector.h>
+#include <TestBase.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the fixed capacity vector
+ */
+class StaticVector : public Base {
+    // delete default constructors
+    StaticVector(const StaticVector& other) = delete;
+    StaticVector& operator=(const StaticVector& other) = delete;
+
+public:
+    virtual void         runInternal() final;
+    static StaticVector& getInstance();
+
+private:
+    StaticVector();
+    static StaticVector instance;
+
+    /**
+     * @brief counts its living instances
+     *
+     */
+    struct Counted {
+        static int alive;
+        uint32_t   value;
+
+        Counted(uint32_t value) : value(value) { alive++; }
+        Counted(const Counted& other) : value(other.value) { alive++; }
+        Counted& operator=(const Counted& other) = default;
+        ~Counted() { alive--; }
+    };
+
+    void testPushPop();
+    void testInsertErase();
+    void testLimits();
+};
+}  // namespace Test
+#endif  //__TESTSTATICVECTOR_H__
@@ -0,0 +1,60 @@
+/**
+ * @file TestTlsf.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the TLSF allocator
+ * @version 1.0
+ * @date 2020-11-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTTLSF_H__
+#define __TESTTLSF_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Tlsf;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <TestBase.h>
+#include <Tlsf.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the TLSF allocator
+ */
+class Tlsf : public Base {
+    // delete default constructors
+    Tlsf(const Tlsf& other) = delete;
+    Tlsf& operator=(const Tlsf& other) = delete;
+
+public:
+    virtual void runInternal() final;
+    static Tlsf& getInstance();
+
+private:
+    Tlsf();
+    static Tlsf instance;
+
+    void testAllocateFree();
+    void testReallocate();
+    void testFragmentation();
+    void testCallSites();
+    void testRandom();
+
+    /** arena the tests run on */
+    static constexpr size_t kArenaSize = 4096;
+    alignas(Memory::Tlsf::kAlignment) uint8_t arena[kArenaSize];
+};
+}  // namespace Test
+#endif  //__TESTTLSF_H__
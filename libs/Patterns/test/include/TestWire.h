@@ -0,0 +1,66 @@
+/**
+ * @file TestWire.h
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the packed frame serializer
+ * @version 1.0
+ * @date 2020-11-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+#ifndef __TESTWIRE_H__
+#define __TESTWIRE_H__
+
+//-------------------------------- PROTOTYPES ---------------------------------
+
+namespace Test
+{
+class Wire;
+}
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <TestBase.h>
+#include <Wire.h>
+
+namespace Test
+{
+//-------------------------------- CONSTANTS ----------------------------------
+
+//---------------------------- CLASS DEFINITION -------------------------------
+
+/**
+ * @brief test for the packed frame serializer
+ */
+class Wire : public Base {
+    // delete default constructors
+    Wire(const Wire& other) = delete;
+    Wire& operator=(const Wire& other) = delete;
+
+public:
+    virtual void                   runInternal() final;
+    virtual const std::list<Base*> getPrerequisits() final;
+    static Wire&                   getInstance();
+
+private:
+    Wire();
+    static Wire instance;
+
+    enum class Kind : uint16_t { Beacon = 0x0102, Sensor = 0x0A0B };
+
+    /** one field of every kind, 24 bytes */
+    using Frame = ::Wire::Struct<::Wire::Little<uint8_t>,
+                                 ::Wire::Little<uint16_t>,
+                                 ::Wire::Big<uint32_t>,
+                                 ::Wire::Big<int16_t>,
+                                 ::Wire::Big<Kind>,
+                                 ::Wire::Bytes<3>,
+                                 ::Wire::Array<uint16_t, 3, Endians::big>,
+                                 ::Wire::Little<float>>;
+
+    void testEncode();
+    void testDecode();
+};
+}  // namespace Test
+#endif  //__TESTWIRE_H__
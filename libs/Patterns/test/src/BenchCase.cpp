@@ -0,0 +1,205 @@
+/**
+ * @file BenchCase.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief base class for micro benchmarks written in aconno libraries
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchCase.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+std::list<Bench::Case *> Bench::Case::cases {};
+uint32_t Bench::Case::samples[kMaxRepetitions] = {0};
+uint32_t Bench::Case::overhead = 0;
+char Bench::Case::strBuffer[192] = {(char)0};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+/**
+ * @brief Construct and register a case.
+ *
+ * @param moduleName Library or module, like Test::Base.
+ * @param caseName What is measured.
+ * @param batch Calls per measurement, large enough for the call to take
+ * longer than reading the counter.
+ * @param repetitions Measured batches, at most kMaxRepetitions.
+ * @param warmup Unmeasured batches before, fill caches and pools.
+ */
+Bench::Case::Case(const char *const moduleName,
+                  const char *const caseName,
+                  uint16_t batch,
+                  uint16_t repetitions,
+                  uint16_t warmup)
+        : moduleName(moduleName), caseName(caseName),
+          batch(std::max<uint16_t>(batch, 1)),
+          repetitions(std::min<uint16_t>(std::max<uint16_t>(repetitions, 1),
+                                         kMaxRepetitions)),
+          warmup(warmup)
+{
+    cases.push_back(this);
+}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+const char *const Bench::Case::getModule()
+{
+    return moduleName;
+}
+
+const char *const Bench::Case::getName()
+{
+    return caseName;
+}
+
+/**
+ * @brief Warm up, measure and evaluate.
+ *
+ * @return Stats cycles per call, without the cost of reading the counter.
+ */
+Bench::Case::Stats Bench::Case::measure()
+{
+    setUp();
+    for (uint16_t i = 0; i < warmup; i++) {
+        runBatch(batch);
+    }
+    for (uint16_t i = 0; i < repetitions; i++) {
+        uint32_t start = Port::getCycleCount();
+        runBatch(batch);
+        uint32_t cycles = Port::getCycleCount() - start;
+        samples[i] = cycles > overhead ? cycles - overhead : 0;
+    }
+    tearDown();
+
+    std::sort(samples, samples + repetitions);
+    auto perCall = [this](uint32_t cycles) {
+        return (cycles + batch / 2) / batch;
+    };
+    // nearest rank
+    size_t p99Rank = (size_t(repetitions) * 99 + 99) / 100;
+    return Stats {perCall(samples[0]),
+                  perCall(samples[repetitions / 2]),
+                  perCall(samples[p99Rank - 1])};
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief Reference named module::case of this case.
+ *
+ */
+const Bench::Case::Reference *
+    Bench::Case::findReference(const Reference *baseline, size_t baselineSize)
+{
+    size_t moduleLength = strlen(moduleName);
+    for (size_t i = 0; i < baselineSize; i++) {
+        const char *name = baseline[i].name;
+        if (strncmp(name, moduleName, moduleLength) == 0 &&
+            strncmp(&name[moduleLength], "::", 2) == 0 &&
+            strcmp(&name[moduleLength + 2], caseName) == 0) {
+            return &baseline[i];
+        }
+    }
+    return nullptr;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Runs all cases and prints a JSON line each.
+ *
+ * @param baseline Medians of an earlier run, nullptr for none.
+ * @param baselineSize Entries in baseline.
+ * @param tolerancePercent How much slower a case might get.
+ * @return true no case got slower than the tolerance.
+ * @return false at least one regression.
+ */
+bool Bench::Case::runAll(const Reference *baseline,
+                         size_t baselineSize,
+                         uint32_t tolerancePercent)
+{
+    Port::logInfo("--------------- Starting all benchmarks ---------------\n");
+    overhead = measureOverhead();
+
+    uint32_t regressions = 0;
+    for (auto *bench : cases) {
+        auto stats = bench->measure();
+        int i = snprintf(strBuffer,
+                         sizeof(strBuffer),
+                         "{\"bench\":\"%s::%s\",\"hz\":%lu,\"batch\":%u,"
+                         "\"reps\":%u,\"min\":%lu,\"median\":%lu,\"p99\":%lu",
+                         bench->moduleName,
+                         bench->caseName,
+                         static_cast<unsigned long>(Port::getCycleCountHz()),
+                         bench->batch,
+                         bench->repetitions,
+                         static_cast<unsigned long>(stats.min),
+                         static_cast<unsigned long>(stats.median),
+                         static_cast<unsigned long>(stats.p99));
+
+        auto bytes = bench->getBytesCopied();
+        if (bytes != 0 && i > 0 && i < static_cast<int>(sizeof(strBuffer))) {
+            i += snprintf(&strBuffer[i],
+                          sizeof(strBuffer) - i,
+                          ",\"bytes\":%lu",
+                          static_cast<unsigned long>(bytes));
+        }
+
+        auto reference = bench->findReference(baseline, baselineSize);
+        if (reference != nullptr && i > 0 &&
+            i < static_cast<int>(sizeof(strBuffer))) {
+            // the median has to get slower by at least a cycle
+            bool slower = uint64_t(stats.median) * 100 >
+                              uint64_t(reference->median) *
+                                  (100 + tolerancePercent) &&
+                          stats.median > reference->median + 1;
+            regressions += slower;
+            i += snprintf(&strBuffer[i],
+                          sizeof(strBuffer) - i,
+                          ",\"baseline\":%lu,\"regression\":%s",
+                          static_cast<unsigned long>(reference->median),
+                          slower ? "true" : "false");
+        }
+        if (i > 0 && i < static_cast<int>(sizeof(strBuffer)) - 2) {
+            snprintf(&strBuffer[i], sizeof(strBuffer) - i, "}\n");
+        }
+        Port::logInfo(strBuffer);
+    }
+
+    snprintf(strBuffer,
+             sizeof(strBuffer),
+             "--------------- Finished %u benchmarks, %lu regressions "
+             "---------------\n",
+             static_cast<unsigned int>(cases.size()),
+             static_cast<unsigned long>(regressions));
+    Port::logInfo(strBuffer);
+    return regressions == 0;
+}
+
+//------------------------ PRIVATE STATIC FUNCTIONS ---------------------------
+
+/**
+ * @brief Fewest cycles between two reads of the counter.
+ *
+ */
+uint32_t Bench::Case::measureOverhead()
+{
+    uint32_t fewest = UINT32_MAX;
+    for (uint32_t i = 0; i < 100; i++) {
+        uint32_t start = Port::getCycleCount();
+        fewest = std::min(fewest, Port::getCycleCount() - start);
+    }
+    return fewest;
+}
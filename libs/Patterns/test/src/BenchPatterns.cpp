@@ -0,0 +1,189 @@
+/**
+ * @file BenchPatterns.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief micro benchmarks of the Patterns library
+ * @version 1.0
+ * @date 2020-11-17
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "BenchPatterns.h"
+
+#include <Endians.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Bench::BitfieldGet      Bench::BitfieldGet::instance {};
+Bench::BitfieldSet      Bench::BitfieldSet::instance {};
+Bench::EndiansSwapArray Bench::EndiansSwapArray::instance {};
+Bench::HashTableFind    Bench::HashTableFind::instance {};
+Bench::LifetimeListFind Bench::LifetimeListFind::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** keeps the compiler from dropping results */
+static volatile uint32_t sink = 0;
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Bench::BitfieldGet::BitfieldGet()
+        : Case("Patterns", "Bitfield.get", 64),
+          registers {0x5A, 0xC3, 0x7E, 0x01}
+{}
+
+Bench::BitfieldSet::BitfieldSet()
+        : Case("Patterns", "Bitfield.set", 64), registers {}
+{}
+
+Bench::EndiansSwapArray::EndiansSwapArray()
+        : Case("Patterns", "Endians.swapArray64", 8), samples {}
+{}
+
+Bench::HashTableFind::HashTableFind()
+        : Case("Patterns", "HashTable.find32", 16), table()
+{}
+
+Bench::LifetimeListFind::LifetimeListFind()
+        : Case("Patterns", "LifetimeList.find32", 16), list(), nodes()
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+Bench::BitfieldGet &Bench::BitfieldGet::getInstance()
+{
+    return instance;
+}
+
+Bench::BitfieldSet &Bench::BitfieldSet::getInstance()
+{
+    return instance;
+}
+
+Bench::EndiansSwapArray &Bench::EndiansSwapArray::getInstance()
+{
+    return instance;
+}
+
+Bench::HashTableFind &Bench::HashTableFind::getInstance()
+{
+    return instance;
+}
+
+Bench::LifetimeListFind &Bench::LifetimeListFind::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Bench::BitfieldGet::runBatch(uint16_t batch)
+{
+    int32_t sum = 0;
+    for (uint16_t i = 0; i < batch; i++) {
+        sum += SensorField::get(registers);
+        __asm__ volatile("" : : : "memory");
+    }
+    sink = sum;
+}
+
+void Bench::BitfieldSet::runBatch(uint16_t batch)
+{
+    for (uint16_t i = 0; i < batch; i++) {
+        SensorField::set(registers, static_cast<int16_t>((i & 0x7FF) - 1024));
+        __asm__ volatile("" : : : "memory");
+    }
+    sink = registers[1];
+}
+
+void Bench::EndiansSwapArray::runBatch(uint16_t batch)
+{
+    for (uint16_t i = 0; i < batch; i++) {
+        Endians::swapArray(samples.data(), samples.size());
+        __asm__ volatile("" : : : "memory");
+    }
+    sink = samples[0];
+}
+
+uint32_t Bench::HashTableFind::AddressHash::operator()(
+    const Address &address) const
+{
+    uint64_t value = 0;
+    for (auto byte : address) {
+        value = (value << 8) | byte;
+    }
+    return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+void Bench::HashTableFind::setUp()
+{
+    for (uint32_t i = 0; i < kEntries; i++) {
+        table.emplace(makeAddress(i), i);
+    }
+}
+
+void Bench::HashTableFind::runBatch(uint16_t batch)
+{
+    uint32_t found = 0;
+    for (uint16_t i = 0; i < batch; i++) {
+        // same order of keys as LifetimeListFind
+        found += (table.find(makeAddress((i * 7u) % kEntries)) != nullptr);
+    }
+    sink = found;
+}
+
+void Bench::HashTableFind::tearDown()
+{
+    table.clear();
+}
+
+void Bench::LifetimeListFind::setUp()
+{
+    for (uint32_t i = 0; i < kEntries; i++) {
+        nodes[i] = list.appendDynamic(uint32_t(i));
+    }
+}
+
+void Bench::LifetimeListFind::runBatch(uint16_t batch)
+{
+    uint32_t found = 0;
+    for (uint16_t i = 0; i < batch; i++) {
+        // every entry once per 32 searches, half the list on average
+        uint32_t wanted = (i * 7u) % kEntries;
+        for (auto &entry : list) {
+            if (entry == wanted) {
+                found++;
+                break;
+            }
+        }
+    }
+    sink = found;
+}
+
+void Bench::LifetimeListFind::tearDown()
+{
+    for (auto &node : nodes) {
+        node.reset();
+    }
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Address with a fixed vendor part and number in the lower bytes.
+ *
+ */
+Bench::HashTableFind::Address Bench::HashTableFind::makeAddress(uint32_t number)
+{
+    return Address {0xC0,
+                    0x3B,
+                    static_cast<uint8_t>(number >> 24),
+                    static_cast<uint8_t>(number >> 16),
+                    static_cast<uint8_t>(number >> 8),
+                    static_cast<uint8_t>(number)};
+}
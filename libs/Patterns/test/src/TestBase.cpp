@@ -73,11 +73,11 @@ const std::list<Test::Base*> Test::Base::getPrerequisits()
 
 //---------------------------- STATIC FUNCTIONS -------------------------------
 
-void Test::Base::runAllTests()
+bool Test::Base::runAllTests()
 {
     if (tests.size() < 1) {
         print("--------------- No Tests found, leaving ---------------");
-        return;
+        return true;
     }
 
     print("--------------- Starting all tests ---------------");
@@ -161,4 +161,6 @@ void Test::Base::runAllTests()
     }
     print("\tModules tested successully:\t%u", succesfulTests);
     print("\tModules failing tests:\t\t%u", failedTests);
+
+    return failedTests == 0;
 }
\ No newline at end of file
@@ -15,12 +15,114 @@
 
 #include "TestEndians.h"
 
+#include <cstring>
+
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
 Test::Bitfield Test::Bitfield::instance {};
 
+namespace
+{
+/**
+ * @brief bit by bit implementation Bitfield used before, reference for
+ * compare().
+ *
+ */
+template<class Field>
+struct Bitwise;
+
+template<class T,
+         size_t             position,
+         size_t             size,
+         Endians::BitOrder  fieldOrder,
+         Endians::BitOrder  peripheralOrder,
+         Endians::ByteOrder endianess,
+         int                check>
+struct Bitwise<Endians::Bitfield<T,
+                                 position,
+                                 size,
+                                 fieldOrder,
+                                 peripheralOrder,
+                                 endianess,
+                                 check>> {
+    static void copyBit(uint8_t& dest,
+                        size_t   destPosition,
+                        uint8_t  src,
+                        size_t   srcPosition)
+    {
+        if ((src & (1u << srcPosition)) != 0) {
+            dest |= (1u << destPosition);
+        } else {
+            dest &= ~(1u << destPosition);
+        }
+    }
+
+    static T get(const uint8_t* data)
+    {
+        T    result {};
+        auto ref = reinterpret_cast<uint8_t*>(&result);
+        for (size_t desBit = 0; desBit < size; ++desBit) {
+            size_t srcBit;
+            if (fieldOrder == Endians::BitOrder::LSBAtZero) {
+                srcBit = desBit + position;
+            } else {
+                srcBit = position + size - desBit - 1;
+            }
+            auto srcByte = srcBit / 8;
+            srcBit %= 8;
+            if (peripheralOrder == Endians::BitOrder::MSBAtZero) {
+                srcBit = 7 - srcBit;
+            }
+            copyBit(ref[desBit / 8], desBit % 8, data[srcByte], srcBit);
+        }
+
+        if (std::is_signed<T>::value &&
+            (ref[(size - 1) / 8] & (1u << ((size - 1) % 8)))) {
+            for (size_t desBit = size; desBit < (8 * sizeof(T)); ++desBit) {
+                ref[desBit / 8] |= (1u << (desBit % 8));
+            }
+        }
+
+        if (endianess == Endians::ByteOrder::big) {
+            Endians::bigToMachine(result);
+        } else {
+            Endians::littleToMachine(result);
+        }
+        return result;
+    }
+
+    static void set(uint8_t* data, T value)
+    {
+        if (endianess == Endians::ByteOrder::big) {
+            Endians::machineToBig(value);
+        } else {
+            Endians::machineToLittle(value);
+        }
+        auto ref = reinterpret_cast<const uint8_t*>(&value);
+
+        for (size_t srcBit = 0; srcBit < size; ++srcBit) {
+            size_t desBit;
+            if (fieldOrder == Endians::BitOrder::LSBAtZero) {
+                desBit = srcBit + position;
+            } else {
+                desBit = position + size - srcBit - 1;
+            }
+            auto desByte = desBit / 8;
+            desBit %= 8;
+            if (peripheralOrder == Endians::BitOrder::MSBAtZero) {
+                desBit = 7 - desBit;
+            }
+            copyBit(data[desByte], desBit, ref[srcBit / 8], srcBit % 8);
+        }
+    }
+};
+}  // namespace
+
 //-------------------------------- CONSTANTS ----------------------------------
 
+/** random blocks compared with the bitwise implementation per Bitfield */
+static constexpr uint32_t kCompareRounds = 200;
+
 //------------------------------ CONSTRUCTOR ----------------------------------
 
 Test::Bitfield::Bitfield() : Test::Base("Endians", "Bitfield") {}
@@ -29,6 +131,9 @@ Test::Bitfield::Bitfield() : Test::Base("Endians", "Bitfield") {}
 
 void Test::Bitfield::runInternal()
 {
+    static_assert(InterByteMsbMsb::get(kData2) == 4u,
+                  "Bitfield::get() is not constexpr");
+
     assert(LSB::get(kData1) == true, "LSB standard reading failed");
     assert(MSB::get(kData1) == false, "MSB standard reading failed");
     assert(LSBInversePeripheral::get(kData1) == false,
@@ -137,6 +242,18 @@ void Test::Bitfield::runInternal()
     uint8_t data3 = 0;
     errCode       = SignedInt::set(data3, -2);
     assert(data3 == 0b00000110, "SignedInt set failed");
+
+    testRegisterMap();
+
+    compare<InterByteLsbLsb>("InterByteLsbLsb");
+    compare<InterByteLsbMsb>("InterByteLsbMsb");
+    compare<InterByteMsbLsb>("InterByteMsbLsb");
+    compare<InterByteMsbMsb>("InterByteMsbMsb");
+    compare<BigEndianUint16>("BigEndianUint16");
+    compare<SignedBigMsb>("SignedBigMsb");
+    compare<Unaligned64Lsb>("Unaligned64Lsb");
+    compare<Unaligned64Msb>("Unaligned64Msb");
+    compare<FloatBig>("FloatBig");
 }
 
 const std::list<Test::Base*> Test::Bitfield::getPrerequisits()
@@ -153,4 +270,81 @@ Test::Bitfield& Test::Bitfield::getInstance()
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief whole register block is decoded and encoded at once
+ *
+ */
+void Test::Bitfield::testRegisterMap()
+{
+    static_assert(Registers::kSize == 3, "register block size wrong");
+
+    // ready, mode 5, temperature -2 in 12 bit MSB first
+    constexpr Registers::Block block = {0b10000101, 0b11111111, 0b11100000};
+    static_assert(std::get<2>(Registers::decode(block)) == -2,
+                  "RegisterMap::decode() is not constexpr");
+
+    auto [ready, mode, temperature] = Registers::decode(block);
+    assert(ready == Ready::get(block) && mode == Mode::get(block) &&
+               temperature == Temperature::get(block),
+           "decode differs from single fields");
+    assert(ready && mode == 5u && temperature == -2,
+           "decoded %u, %u, %d",
+           static_cast<unsigned int>(ready),
+           static_cast<unsigned int>(mode),
+           temperature);
+
+    assert(Registers::encode({true, 5, -2}) == block, "encode failed");
+
+    // bits not covered by a field are kept
+    Registers::Block written = {0b01111000, 0, 0b00001111};
+    Registers::encode(written, {true, 5, -2});
+    assert(written[0] == 0b11111101 && written[1] == 0b11111111 &&
+               written[2] == 0b11101111,
+           "encode changed uncovered bits");
+}
+
+/**
+ * @brief get and set match the bitwise implementation on random data
+ *
+ */
+template<class Field>
+void Test::Bitfield::compare(const char* name)
+{
+    using T         = typename Field::Type;
+    using Reference = Bitwise<Field>;
+
+    uint32_t random = 0x2545F491;
+    auto     next   = [&random]() {
+        // xorshift32
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        return static_cast<uint8_t>(random);
+    };
+
+    for (uint32_t round = 0; round < kCompareRounds; round++) {
+        std::array<uint8_t, Field::kBytes> data;
+        for (auto& byte : data) {
+            byte = next();
+        }
+        T expected = Reference::get(data.data());
+        T actual   = Field::get(data);
+        assert(std::memcmp(&expected, &actual, sizeof(T)) == 0,
+               "%s get differs in round %u",
+               name,
+               round);
+
+        uint8_t raw[sizeof(T)];
+        for (auto& byte : raw) {
+            byte = next();
+        }
+        T value;
+        std::memcpy(&value, raw, sizeof(T));
+        auto reference = data;
+        Reference::set(reference.data(), value);
+        Field::set(data, value);
+        assert(data == reference, "%s set differs in round %u", name, round);
+    }
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include <Endians.h>
 #include <array>
 #include <cstdint>
+#include <cstring>
 
 //--------------------------- STRUCTS AND ENUMS -------------------------------
 
@@ -66,6 +67,15 @@ void Test::Endians::runInternal()
         assert(reinterpret_cast<const uint8_t*>(&element)[0] == 1,
                "failed to convert uint32_t array to little endian");
     }
+
+    float    f = 1.0f;
+    uint32_t raw;
+    ::Endians::machineToBig(f);
+    std::memcpy(&raw, &f, sizeof(raw));
+    ::Endians::bigToMachine(raw);
+    assert(raw == 0x3F800000, "failed to convert float to big endian");
+
+    testSwapArray();
 }
 
 Test::Endians& Test::Endians::getInstance()
@@ -77,4 +87,27 @@ Test::Endians& Test::Endians::getInstance()
 
 //--------------------------- PRIVATE FUNCTIONS -------------------------------
 
+/**
+ * @brief bulk swap handles odd counts and all element sizes
+ *
+ */
+void Test::Endians::testSwapArray()
+{
+    uint16_t a16[] = {0x0102, 0x0304, 0x0506};
+    ::Endians::swapArray(a16, 3);
+    assert(a16[0] == 0x0201 && a16[1] == 0x0403 && a16[2] == 0x0605,
+           "swapArray failed on odd uint16_t count");
+
+    int64_t a64[] = {0x0102030405060708, -2};
+    ::Endians::swapArray(a64, 2);
+    assert(a64[0] == 0x0807060504030201 &&
+               a64[1] == static_cast<int64_t>(0xFEFFFFFFFFFFFFFF),
+           "swapArray failed on int64_t");
+
+    uint8_t a8[] = {1, 2, 3};
+    ::Endians::swapArray(a8, 3);
+    assert(a8[0] == 1 && a8[1] == 2 && a8[2] == 3,
+           "swapArray changed bytes");
+}
+
 //---------------------------- STATIC FUNCTIONS -------------------------------
\ No newline at end of file
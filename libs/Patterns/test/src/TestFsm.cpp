@@ -0,0 +1,113 @@
+/**
+ * @file TestFsm.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the table driven state machine
+ * @version 1.0
+ * @date 2020-11-13
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestFsm.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Fsm Test::Fsm::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Fsm::Fsm() : Test::Base("Patterns", "Fsm") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::Fsm::runInternal()
+{
+    Sensor                 sensor {};
+    Patterns::Fsm<Machine> fsm {sensor};
+
+    assert(fsm.dispatch(Event::Start) == Error::NotInitialized,
+           "dispatched before start");
+    assert(fsm.start() == Error::None && sensor.check("I"), "start failed");
+    assert(fsm.start() == Error::AlreadyInit, "started twice");
+    assert(fsm.dispatch(Event::Tick) == Error::NotFound && sensor.check(""),
+           "unhandled event changed state");
+
+    // initial sub state is entered after the composite state
+    fsm.dispatch(Event::Start);
+    assert(sensor.check("i1AM") && fsm.getState() == State::Measuring,
+           "entering composite state failed: %s",
+           sensor.checked);
+    assert(fsm.isIn(State::Active) && fsm.isIn(State::Measuring) &&
+               !fsm.isIn(State::Idle),
+           "isIn wrong");
+
+    // sibling transition stays in Active
+    fsm.dispatch(Event::DataReady);
+    assert(sensor.check("m3R"),
+           "sibling transition failed: %s",
+           sensor.checked);
+
+    // innermost state wins, self transition leaves and enters again
+    fsm.dispatch(Event::Tick);
+    assert(sensor.check("rR"), "self transition failed: %s", sensor.checked);
+    fsm.dispatch(Event::Done);
+    assert(sensor.check("rM"), "transition failed: %s", sensor.checked);
+
+    // handled by Active, internal transition
+    fsm.dispatch(Event::Tick);
+    assert(sensor.check("4") && fsm.getState() == State::Measuring,
+           "internal transition failed: %s",
+           sensor.checked);
+
+    // external transition into own sub state leaves the composite state
+    fsm.dispatch(Event::Reset);
+    assert(sensor.check("maAM"),
+           "external transition failed: %s",
+           sensor.checked);
+
+    // handled by Active from within Reading, leaves both
+    fsm.dispatch(Event::DataReady);
+    sensor.check("m3R");
+    fsm.dispatch(Event::Stop);
+    assert(sensor.check("ra2I") && fsm.getState() == State::Idle,
+           "leaving composite state failed: %s",
+           sensor.checked);
+}
+
+Test::Fsm& Test::Fsm::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+void Test::Fsm::Sensor::append(char action)
+{
+    if (length + 1 < sizeof(log)) {
+        log[length++] = action;
+        log[length]   = '\0';
+    }
+}
+
+/**
+ * @brief compares the log with expected and moves it to checked
+ *
+ */
+bool Test::Fsm::Sensor::check(const char* expected)
+{
+    std::memcpy(checked, log, sizeof(log));
+    length = 0;
+    log[0] = '\0';
+    return std::strncmp(checked, expected, sizeof(checked)) == 0;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
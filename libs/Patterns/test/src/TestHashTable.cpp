@@ -0,0 +1,178 @@
+/**
+ * @file TestHashTable.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity hash table
+ * @version 1.0
+ * @date 2020-11-09
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestHashTable.h"
+
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::HashTable Test::HashTable::instance {};
+int             Test::HashTable::Counted::alive = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::HashTable::HashTable() : Test::Base("Collections", "HashTable") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::HashTable::runInternal()
+{
+    testInsertFind();
+    testEviction();
+    testCollisions();
+}
+
+Test::HashTable& Test::HashTable::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+uint32_t Test::HashTable::AddressHash::operator()(const Address& address) const
+{
+    uint64_t value = 0;
+    for (auto byte : address) {
+        value = (value << 8) | byte;
+    }
+    return static_cast<uint32_t>((value * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief values are found, erased and destructed
+ *
+ */
+void Test::HashTable::testInsertFind()
+{
+    {
+        SmallTable table {};
+        assert(table.size() == 0u && table.begin() == table.end(),
+               "new table not empty");
+
+        auto first = table.emplace(makeAddress(1), 1u);
+        assert(first != nullptr && first->value == 1u, "emplace failed");
+        assert(table.emplace(makeAddress(1), 2u) == nullptr,
+               "same key emplaced twice");
+        assert(table.emplace(makeAddress(2), 2u) != nullptr, "emplace failed");
+        assert(Counted::alive == 2,
+               "%d values alive instead of 2",
+               Counted::alive);
+
+        assert(table.find(makeAddress(1)) == first, "value not found");
+        assert(table.peek(makeAddress(3)) == nullptr, "unknown key found");
+        assert(table.size() == 2u, "size is not 2");
+
+        assert(table.erase(makeAddress(1)) == Error::None, "erase failed");
+        assert(table.erase(makeAddress(1)) == Error::NotFound,
+               "erased key erased again");
+        assert(table.find(makeAddress(1)) == nullptr, "erased key found");
+        assert(Counted::alive == 1, "erased value not destructed");
+
+        size_t iterated = 0;
+        for (auto& value : table) {
+            assert(value.value == 2u, "iterated wrong value");
+            iterated++;
+        }
+        assert(table.begin().getKey() == makeAddress(2),
+               "iterator returned wrong key");
+        assert(iterated == 1u,
+               "iterated %u values",
+               static_cast<unsigned int>(iterated));
+    }
+    assert(Counted::alive == 0, "destructor left values alive");
+}
+
+/**
+ * @brief full table evicts the least recently used value
+ *
+ */
+void Test::HashTable::testEviction()
+{
+    SmallTable table {};
+    for (uint32_t i = 0; i < SmallTable::getCapacity(); i++) {
+        table.emplace(makeAddress(i), i);
+    }
+    // 0 is used again, 1 becomes the oldest
+    table.find(makeAddress(0));
+    // peek does not count as use
+    table.peek(makeAddress(1));
+
+    assert(table.emplace(makeAddress(10), 10u) != nullptr,
+           "full table did not evict");
+    assert(table.peek(makeAddress(1)) == nullptr, "wrong value evicted");
+    assert(table.peek(makeAddress(0)) != nullptr, "used value evicted");
+    assert(table.getEvictions() == 1u, "eviction not counted");
+    assert(table.size() == SmallTable::getCapacity(), "size changed");
+    assert(Counted::alive == static_cast<int>(SmallTable::getCapacity()),
+           "evicted value not destructed");
+
+    uint32_t expected[] = {10, 0, 3, 2};
+    size_t   i          = 0;
+    for (auto& value : table) {
+        assert(value.value == expected[i],
+               "iterated %u instead of %u",
+               value.value,
+               expected[i]);
+        i++;
+    }
+}
+
+/**
+ * @brief erasing inside a probe sequence keeps the rest of it reachable
+ *
+ */
+void Test::HashTable::testCollisions()
+{
+    /** every key collides */
+    struct BadHash {
+        uint32_t operator()(const Address&) const { return 7; }
+    };
+    Collections::HashTable<Address, uint32_t, 8, BadHash> table {};
+
+    for (uint32_t i = 0; i < 8; i++) {
+        table.emplace(makeAddress(i), i);
+    }
+    assert(table.erase(makeAddress(3)) == Error::None, "erase failed");
+    assert(table.erase(makeAddress(0)) == Error::None, "erase failed");
+    for (uint32_t i = 0; i < 8; i++) {
+        auto value = table.peek(makeAddress(i));
+        if (i == 0 || i == 3) {
+            assert(value == nullptr, "erased key %u found", i);
+        } else {
+            assert(value != nullptr && *value == i, "key %u lost", i);
+        }
+    }
+    assert(table.emplace(makeAddress(3), 33u) != nullptr, "reinsert failed");
+    assert(*table.peek(makeAddress(3)) == 33u, "reinserted value wrong");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Address with a fixed vendor part and number in the lower bytes.
+ *
+ */
+Test::HashTable::Address Test::HashTable::makeAddress(uint32_t number)
+{
+    return Address {0xC0,
+                    0x3B,
+                    static_cast<uint8_t>(number >> 24),
+                    static_cast<uint8_t>(number >> 16),
+                    static_cast<uint8_t>(number >> 8),
+                    static_cast<uint8_t>(number)};
+}
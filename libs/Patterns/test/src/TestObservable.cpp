@@ -0,0 +1,144 @@
+/**
+ * @file TestObservable.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the intrusive and the static observer pattern
+ * @version 1.0
+ * @date 2020-11-10
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestObservable.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Observable Test::Observable::instance {};
+uint32_t         Test::Observable::Watcher::calls = 0;
+uint32_t         Test::Observable::sum            = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Observable::Observable() : Test::Base("Patterns", "Observable") {}
+
+Test::Observable::Watcher::Watcher(Subject& subject, bool unregisterOnCall)
+        : Patterns::Observer<uint32_t>(subject), lastValue(0), callNumber(0),
+          unregisterOnCall(unregisterOnCall)
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::Observable::runInternal()
+{
+    testRegistration();
+    testUnregisterInHandle();
+    testStatic();
+}
+
+Test::Observable& Test::Observable::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+void Test::Observable::Watcher::handle(
+    Patterns::Observable<uint32_t>& observable,
+    uint32_t                        value)
+{
+    lastValue  = value;
+    callNumber = ++calls;
+    if (unregisterOnCall) {
+        observable.unregisterObserver(*this);
+    }
+}
+
+template<uint32_t factor>
+void Test::Observable::Adder<factor>::handle(uint32_t value)
+{
+    sum += factor * value;
+}
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief observers get called until they are destructed
+ *
+ */
+void Test::Observable::testRegistration()
+{
+    Subject subject;
+    Watcher first {subject};
+    {
+        Watcher second {subject};
+        Watcher third {subject};
+
+        Watcher::calls = 0;
+        subject.trigger(7);
+        assert(first.lastValue == 7 && second.lastValue == 7 &&
+                   third.lastValue == 7,
+               "not all observers called");
+        assert(third.callNumber == 1 && first.callNumber == 3,
+               "observers not called latest first");
+
+        // registering twice must not call twice
+        subject.registerObserver(second);
+        Watcher::calls = 0;
+        subject.trigger(8);
+        assert(Watcher::calls == 3, "%u calls instead of 3", Watcher::calls);
+
+        // unregister from the middle
+        subject.unregisterObserver(second);
+        subject.unregisterObserver(second);
+        subject.trigger(9);
+        assert(second.lastValue == 8, "unregistered observer called");
+        assert(first.lastValue == 9 && third.lastValue == 9,
+               "remaining observers not called");
+    }
+
+    // second and third unregistered on destruction
+    Watcher::calls = 0;
+    subject.trigger(10);
+    assert(Watcher::calls == 1 && first.lastValue == 10,
+           "destructed observers still registered");
+}
+
+/**
+ * @brief an observer may leave during trigger() without breaking the walk
+ *
+ */
+void Test::Observable::testUnregisterInHandle()
+{
+    Subject subject;
+    Watcher last {subject};
+    Watcher leaving {subject, true};
+    Watcher firstCalled {subject};
+
+    Watcher::calls = 0;
+    subject.trigger(1);
+    assert(Watcher::calls == 3, "%u calls instead of 3", Watcher::calls);
+
+    Watcher::calls = 0;
+    subject.trigger(2);
+    assert(Watcher::calls == 2, "left observer called again");
+    assert(leaving.lastValue == 1 && last.lastValue == 2,
+           "wrong observers called");
+}
+
+/**
+ * @brief static observers are called in order without registration
+ *
+ */
+void Test::Observable::testStatic()
+{
+    sum = 0;
+    StaticSubject::trigger(3u);
+    assert(sum == 33, "sum %u instead of 33", sum);
+    static_assert(sizeof(StaticSubject) == 1, "static observable has state");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
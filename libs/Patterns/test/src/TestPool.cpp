@@ -0,0 +1,143 @@
+/**
+ * @file TestPool.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed block memory pools
+ * @version 1.0
+ * @date 2020-11-02
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestPool.h"
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Pool Test::Pool::instance {};
+int        Test::Pool::Counted::alive = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Pool::Pool() : Test::Base("Patterns", "Pool") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::Pool::runInternal()
+{
+    testBlockPool();
+    testBuffer();
+    testObjectPool();
+}
+
+Test::Pool& Test::Pool::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief exhaust the pool, check statistics and reuse of freed blocks
+ *
+ */
+void Test::Pool::testBlockPool()
+{
+    Patterns::BlockPool<6, 4, 4> pool {};
+    void*                        blocks[4];
+
+    for (auto& block : blocks) {
+        block = pool.allocate();
+        assert(block != nullptr, "allocation on free pool failed");
+        assert(reinterpret_cast<uintptr_t>(block) % 4 == 0,
+               "block is not aligned");
+    }
+    for (size_t i = 1; i < 4; i++) {
+        assert(blocks[i] != blocks[i - 1], "same block handed out twice");
+    }
+    assert(pool.getUsed() == 4u,
+           "pool counts %u used blocks instead of 4",
+           static_cast<unsigned int>(pool.getUsed()));
+
+    assert(pool.allocate() == nullptr, "exhausted pool handed out a block");
+    assert(pool.getFailures() == 1u, "failed allocation not counted");
+
+    int notFromPool = 0;
+    assert(pool.free(&notFromPool) == Error::InvalidParameter,
+           "foreign pointer accepted");
+    assert(pool.free(static_cast<uint8_t*>(blocks[0]) + 1) ==
+               Error::InvalidParameter,
+           "pointer into block accepted");
+
+    assert(pool.free(blocks[2]) == Error::None, "failed to free block");
+    assert(pool.allocate() == blocks[2], "freed block not reused");
+
+    for (auto block : blocks) {
+        assert(pool.free(block) == Error::None, "failed to free block");
+    }
+    assert(pool.getUsed() == 0u, "blocks still in use after freeing all");
+    assert(pool.getPeakUsed() == 4u,
+           "peak usage %u instead of 4",
+           static_cast<unsigned int>(pool.getPeakUsed()));
+}
+
+/**
+ * @brief owning buffer handles return their block
+ *
+ */
+void Test::Pool::testBuffer()
+{
+    using BufferPool = Patterns::BlockPool<16, 2>;
+    BufferPool pool {};
+
+    {
+        auto buffer = pool.allocateBuffer(16);
+        assert(buffer != nullptr, "failed to allocate buffer");
+        buffer[15] = 0xAB;
+
+        std::unique_ptr<const uint8_t[], BufferPool::Deleter> constBuffer {
+            std::move(buffer)};
+        assert(pool.getUsed() == 1u, "buffer not counted as used");
+        assert(constBuffer[15] == 0xAB, "buffer lost its content");
+    }
+    assert(pool.getUsed() == 0u, "buffer not returned on destruction");
+
+    assert(pool.allocateBuffer(17) == nullptr, "too large buffer allocated");
+    assert(pool.getFailures() == 0u, "too large buffer counted as failure");
+}
+
+/**
+ * @brief typed pool constructs and destructs its objects
+ *
+ */
+void Test::Pool::testObjectPool()
+{
+    Patterns::Pool<Counted, 2> pool {};
+
+    auto first  = pool.create(1u);
+    auto second = pool.create(2u);
+    assert((first != nullptr) && (second != nullptr),
+           "failed to create objects");
+    assert((first->value == 1u) && (second->value == 2u),
+           "constructor arguments not forwarded");
+    assert(Counted::alive == 2, "objects not constructed");
+    assert(pool.create(3u) == nullptr, "exhausted pool created an object");
+    assert(Counted::alive == 2, "object constructed on exhausted pool");
+
+    Counted outside {4u};
+    assert(pool.destroy(&outside) == Error::InvalidParameter,
+           "foreign object accepted");
+    assert(Counted::alive == 3, "foreign object destructed");
+
+    assert(pool.destroy(first) == Error::None, "failed to destroy object");
+    assert(pool.destroy(second) == Error::None, "failed to destroy object");
+    assert(Counted::alive == 1, "objects not destructed");
+    assert(pool.getUsed() == 0u, "objects still counted as used");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,112 @@
+/**
+ * @file TestRingBuffer.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity ring buffer
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestRingBuffer.h"
+
+#include <numeric>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::RingBuffer Test::RingBuffer::instance {};
+int              Test::RingBuffer::Counted::alive = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::RingBuffer::RingBuffer() : Test::Base("Collections", "RingBuffer") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::RingBuffer::runInternal()
+{
+    testFifo();
+    testOverwrite();
+}
+
+Test::RingBuffer& Test::RingBuffer::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief elements leave in the order they came, across the wrap around
+ *
+ */
+void Test::RingBuffer::testFifo()
+{
+    {
+        Collections::RingBuffer<Counted, 3> ring {};
+        assert(ring.empty() && ring.begin() == ring.end(), "new ring not empty");
+
+        Counted out {0};
+        uint32_t next = 0;
+        for (uint32_t i = 0; i < 10; i++) {
+            assert(ring.emplace_back(i) != nullptr, "emplace %u failed", i);
+            if (ring.isFull()) {
+                assert(ring.emplace_back(99u) == nullptr, "full ring grew");
+                assert(ring.popInto(out) == Error::None && out.value == next,
+                       "popped %u instead of %u",
+                       out.value,
+                       next);
+                next++;
+            }
+        }
+        assert(ring.size() == 2u && ring.front().value == 8u &&
+                   ring.back().value == 9u,
+               "wrong elements left");
+        assert(Counted::alive == 3,
+               "%d elements alive instead of 3",
+               Counted::alive);
+    }
+    assert(Counted::alive == 0, "destructor left elements alive");
+
+    Collections::RingBuffer<uint32_t, 3> ring {};
+    assert(ring.pop_front() == Error::NotFound, "pop_front on empty ring");
+}
+
+/**
+ * @brief a full ring drops the oldest element and keeps the latest ones
+ *
+ */
+void Test::RingBuffer::testOverwrite()
+{
+    Collections::RingBuffer<uint32_t, 4> samples {};
+    for (uint32_t i = 1; i <= 10; i++) {
+        assert(samples.emplaceOverwrite(i) != nullptr, "overwrite failed");
+    }
+
+    assert(samples.size() == 4u, "size is not 4");
+    for (uint32_t age = 0; age < samples.size(); age++) {
+        assert(samples[age] == 7 + age,
+               "sample %u is %u",
+               age,
+               samples[age]);
+    }
+
+    const auto& constSamples = samples;
+    assert(std::accumulate(constSamples.begin(), constSamples.end(), 0u) ==
+               7u + 8u + 9u + 10u,
+           "iteration does not cover the latest samples");
+
+    auto copy = samples;
+    samples.clear();
+    assert(samples.empty() && copy.size() == 4u && copy.front() == 7u,
+           "copy not independent");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,116 @@
+/**
+ * @file TestStaticMap.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity sorted map
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestStaticMap.h"
+
+#include "TestStaticString.h"
+#include "TestStaticVector.h"
+
+#include <StaticString.h>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::StaticMap Test::StaticMap::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::StaticMap::StaticMap() : Test::Base("Collections", "StaticMap") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::StaticMap::runInternal()
+{
+    testInsertFind();
+    testOrder();
+}
+
+const std::list<Test::Base*> Test::StaticMap::getPrerequisits()
+{
+    return std::list<Base*>(
+        {&StaticVector::getInstance(), &StaticString::getInstance()});
+}
+
+Test::StaticMap& Test::StaticMap::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief values are found by key until erased
+ *
+ */
+void Test::StaticMap::testInsertFind()
+{
+    Collections::StaticMap<uint16_t, Collections::StaticString<8>, 3> names {};
+
+    assert(names.emplace(0x0059, "aconno") != nullptr, "emplace failed");
+    assert(names.emplace(0x004C, "Apple") != nullptr, "emplace failed");
+    assert(names.emplace(0x0059, "other") == nullptr,
+           "same key emplaced twice");
+    assert(names.insertOrAssign(0x0006, "MS") == Error::None,
+           "insertOrAssign failed");
+    assert(names.isFull(), "map not full");
+    assert(names.insertOrAssign(0x0075, "Samsung") == Error::OutOfResources,
+           "full map grew");
+
+    auto name = names.find(0x0059);
+    assert(name != nullptr && *name == "aconno", "value not found");
+    assert(names.find(0x0075) == nullptr, "unknown key found");
+
+    assert(names.insertOrAssign(0x0006, "Redmond") == Error::None &&
+               *names.find(0x0006) == "Redmond",
+           "value not assigned");
+
+    assert(names.erase(0x004C) == Error::None, "erase failed");
+    assert(names.erase(0x004C) == Error::NotFound, "erased key erased again");
+    assert(!names.contains(0x004C) && names.size() == 2u,
+           "erased key still contained");
+}
+
+/**
+ * @brief iteration is in key order, regardless of insertion order
+ *
+ */
+void Test::StaticMap::testOrder()
+{
+    Collections::StaticMap<int32_t, uint32_t, 8> map {};
+    const int32_t keys[] = {5, -3, 12, 0, 7, -8};
+    for (auto key : keys) {
+        map.emplace(key, static_cast<uint32_t>(key * key));
+    }
+
+    int32_t previous = INT32_MIN;
+    for (auto& entry : map) {
+        assert(entry.key > previous, "key %d after %d", entry.key, previous);
+        assert(entry.value == static_cast<uint32_t>(entry.key * entry.key),
+               "value of key %d wrong",
+               entry.key);
+        previous = entry.key;
+    }
+
+    // descending map by comparator
+    Collections::StaticMap<int32_t, uint32_t, 8, std::greater<int32_t>>
+        descending {};
+    for (auto key : keys) {
+        descending.emplace(key, 0u);
+    }
+    assert(descending.begin()->key == 12, "comparator ignored");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
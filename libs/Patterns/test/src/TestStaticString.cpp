@@ -0,0 +1,101 @@
+/**
+ * @file TestStaticString.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity string
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestStaticString.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::StaticString Test::StaticString::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::StaticString::StaticString() : Test::Base("Collections", "StaticString")
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::StaticString::runInternal()
+{
+    testAssign();
+    testCompare();
+}
+
+Test::StaticString& Test::StaticString::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief text is cut off at the capacity and always terminated
+ *
+ */
+void Test::StaticString::testAssign()
+{
+    Collections::StaticString<8> text {};
+    assert(text.empty() && std::strlen(text.c_str()) == 0,
+           "new string not empty");
+
+    assert(text.assign("Sensor") == Error::None, "assign failed");
+    assert(text.size() == 6u, "size is %u", static_cast<unsigned int>(text.size()));
+    assert(text.append("123") == Error::TooLarge, "overflow not reported");
+    assert(std::strcmp(text.c_str(), "Sensor12") == 0,
+           "cut off text is \"%s\"",
+           text.c_str());
+    assert(text.push_back('!') == Error::TooLarge, "full string grew");
+
+    // names from advertisements are not terminated
+    const char raw[] = {'B', 'e', 'a', 'c', 'o', 'n', 'X'};
+    assert(text.assign(raw, 6) == Error::None, "assign with length failed");
+    assert(std::strcmp(text.c_str(), "Beacon") == 0, "not terminated");
+    assert(text.assign("ABCDEFGHIJ") == Error::TooLarge &&
+               text.size() == 8u,
+           "long text not cut off");
+
+    text.clear();
+    assert(text.size() == 0u && text.c_str()[0] == '\0', "clear failed");
+}
+
+/**
+ * @brief strings of different capacity and C strings compare by content
+ *
+ */
+void Test::StaticString::testCompare()
+{
+    Collections::StaticString<8>  shortText {"node"};
+    Collections::StaticString<16> longText {"node"};
+
+    assert(shortText == longText, "equal strings differ");
+    assert(shortText == "node", "string differs from C string");
+    assert(shortText != "nodes" && shortText != "nod",
+           "string equals different C string");
+
+    longText.push_back('s');
+    assert(shortText != longText, "different strings equal");
+
+    size_t characters = 0;
+    for (char character : longText) {
+        assert(character != '\0', "iterated terminator");
+        characters++;
+    }
+    assert(characters == 5u, "iterated %u characters", static_cast<unsigned int>(characters));
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
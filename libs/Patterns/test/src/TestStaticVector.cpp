@@ -0,0 +1,141 @@
+/**
+ * @file TestStaticVector.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the fixed capacity vector
+ * @version 1.0
+ * @date 2020-11-18
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestStaticVector.h"
+
+#include <algorithm>
+#include <numeric>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::StaticVector Test::StaticVector::instance {};
+int                Test::StaticVector::Counted::alive = 0;
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::StaticVector::StaticVector() : Test::Base("Collections", "StaticVector")
+{}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::StaticVector::runInternal()
+{
+    testPushPop();
+    testInsertErase();
+    testLimits();
+}
+
+Test::StaticVector& Test::StaticVector::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief elements are appended, removed and destructed
+ *
+ */
+void Test::StaticVector::testPushPop()
+{
+    {
+        Collections::StaticVector<Counted, 4> vector {};
+        assert(vector.empty() && vector.begin() == vector.end(),
+               "new vector not empty");
+
+        for (uint32_t i = 0; i < 4; i++) {
+            assert(vector.emplace_back(i) != nullptr, "emplace %u failed", i);
+        }
+        assert(vector.isFull(), "vector not full");
+        assert(vector.emplace_back(4u) == nullptr, "full vector grew");
+        assert(vector.push_back(Counted {4}) == Error::OutOfResources,
+               "full vector accepted push_back");
+        assert(Counted::alive == 4,
+               "%d elements alive instead of 4",
+               Counted::alive);
+
+        assert(vector.pop_back() == Error::None && vector.size() == 3u,
+               "pop_back failed");
+        assert(Counted::alive == 3, "popped element not destructed");
+        assert(vector.front().value == 0u && vector.back().value == 2u,
+               "front or back wrong");
+
+        auto copy = vector;
+        assert(copy.size() == 3u && copy[2].value == 2u, "copy differs");
+        assert(Counted::alive == 6, "copy did not construct elements");
+    }
+    assert(Counted::alive == 0, "destructor left elements alive");
+}
+
+/**
+ * @brief insert and erase in the middle keep the order
+ *
+ */
+void Test::StaticVector::testInsertErase()
+{
+    Collections::StaticVector<uint32_t, 8> vector {1, 2, 4, 5};
+
+    assert(vector.emplace(vector.begin() + 2, 3u) != nullptr, "insert failed");
+    assert(vector.emplace(vector.begin(), 0u) != nullptr, "insert failed");
+    assert(vector.emplace(vector.end(), 6u) != nullptr, "append failed");
+    for (uint32_t i = 0; i < vector.size(); i++) {
+        assert(vector[i] == i, "element %u is %u", i, vector[i]);
+    }
+
+    auto next = vector.erase(vector.begin() + 1);
+    assert(*next == 2u, "erase returned wrong position");
+    assert(vector.erase(vector.end() - 1) == vector.end(),
+           "erasing the last element did not return end");
+
+    const uint32_t expected[] = {0, 2, 3, 4, 5};
+    assert(std::equal(vector.begin(),
+                      vector.end(),
+                      std::begin(expected),
+                      std::end(expected)),
+           "order lost by erase");
+}
+
+/**
+ * @brief operations beyond the capacity leave the vector untouched
+ *
+ */
+void Test::StaticVector::testLimits()
+{
+    const uint8_t raw[] = {1, 2, 3, 4, 5, 6};
+
+    Collections::StaticVector<uint8_t, 4> vector {};
+    assert(vector.assign(raw, 4) == Error::None, "assign failed");
+    assert(std::accumulate(vector.begin(), vector.end(), 0) == 10,
+           "assigned wrong values");
+    assert(vector.assign(raw, 6) == Error::TooLarge,
+           "assign beyond capacity accepted");
+    assert(vector.size() == 4u, "failed assign changed the vector");
+
+    assert(vector.resize(5) == Error::TooLarge, "resize beyond capacity");
+    assert(vector.resize(2) == Error::None && vector.size() == 2u,
+           "resize failed");
+
+    Collections::StaticVector<uint8_t, 8> other {1, 2};
+    assert(vector == other, "equal vectors compare different");
+    other.push_back(3);
+    assert(vector != other, "different vectors compare equal");
+
+    vector.clear();
+    assert(vector.pop_back() == Error::NotFound, "pop_back on empty vector");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
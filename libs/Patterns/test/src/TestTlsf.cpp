@@ -0,0 +1,239 @@
+/**
+ * @file TestTlsf.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the TLSF allocator
+ * @version 1.0
+ * @date 2020-11-04
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestTlsf.h"
+
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Tlsf Test::Tlsf::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Tlsf::Tlsf() : Test::Base("Memory", "Tlsf") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::Tlsf::runInternal()
+{
+    testAllocateFree();
+    testReallocate();
+    testFragmentation();
+    testCallSites();
+    testRandom();
+}
+
+Test::Tlsf& Test::Tlsf::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief allocations are aligned, freed memory merges back to one block
+ *
+ */
+void Test::Tlsf::testAllocateFree()
+{
+    Memory::Tlsf heap {arena, kArenaSize};
+    auto         initial = heap.getStats();
+    assert(initial.largestFreeBlock == initial.totalBytes,
+           "fresh heap is not a single block");
+
+    void* small = heap.allocate(1);
+    void* large = heap.allocate(1000);
+    void* other = heap.allocate(24);
+    assert((small != nullptr) && (large != nullptr) && (other != nullptr),
+           "allocation on fresh heap failed");
+    for (auto pointer : {small, large, other}) {
+        assert(reinterpret_cast<uintptr_t>(pointer) %
+                       Memory::Tlsf::kAlignment ==
+                   0,
+               "allocation not aligned");
+    }
+    assert(heap.usableSize(large) >= 1000u, "block smaller than requested");
+    memset(large, 0xA5, 1000);
+
+    auto stats = heap.getStats();
+    assert(stats.liveAllocations == 3u,
+           "%u live allocations instead of 3",
+           static_cast<unsigned int>(stats.liveAllocations));
+    assert(stats.liveBytes >= 1025u, "live bytes not counted");
+
+    assert(heap.free(large) == Error::None, "failed to free");
+    assert(heap.free(large) == Error::InvalidParameter,
+           "double free not detected");
+    int notFromHeap = 0;
+    assert(heap.free(&notFromHeap) == Error::InvalidParameter,
+           "foreign pointer accepted");
+    assert(heap.free(small) == Error::None, "failed to free");
+    assert(heap.free(other) == Error::None, "failed to free");
+
+    stats = heap.getStats();
+    assert(stats.liveBytes == 0u, "live bytes left after freeing all");
+    assert(stats.largestFreeBlock == initial.totalBytes,
+           "blocks did not merge back, largest %u of %u",
+           static_cast<unsigned int>(stats.largestFreeBlock),
+           static_cast<unsigned int>(initial.totalBytes));
+    assert(stats.peakBytes >= 1025u, "peak not kept");
+
+    assert(heap.allocate(kArenaSize) == nullptr, "oversized allocation");
+    assert(heap.getStats().failedAllocations == 1u,
+           "failed allocation not counted");
+}
+
+/**
+ * @brief reallocation keeps content, grows in place when possible
+ *
+ */
+void Test::Tlsf::testReallocate()
+{
+    Memory::Tlsf heap {arena, kArenaSize};
+
+    auto first = static_cast<uint8_t*>(heap.allocate(32));
+    for (uint8_t i = 0; i < 32; i++) {
+        first[i] = i;
+    }
+
+    // nothing behind first, grows in place
+    auto grown = static_cast<uint8_t*>(heap.reallocate(first, 256));
+    assert(grown == first, "did not grow in place");
+
+    auto blocker = heap.allocate(16);
+    auto moved   = static_cast<uint8_t*>(heap.reallocate(grown, 512));
+    assert((moved != nullptr) && (moved != grown), "did not move");
+    bool same = true;
+    for (uint8_t i = 0; i < 32; i++) {
+        same &= moved[i] == i;
+    }
+    assert(same, "content lost on reallocation");
+
+    auto shrunk = heap.reallocate(moved, 8);
+    assert(shrunk == moved, "shrinking moved the allocation");
+
+    assert(heap.free(shrunk) == Error::None, "failed to free");
+    assert(heap.free(blocker) == Error::None, "failed to free");
+    assert(heap.getStats().largestFreeBlock == heap.getStats().totalBytes,
+           "blocks did not merge back after reallocation");
+}
+
+/**
+ * @brief fragmentation shows in the statistics
+ *
+ */
+void Test::Tlsf::testFragmentation()
+{
+    Memory::Tlsf heap {arena, kArenaSize};
+    void*        blocks[32];
+
+    for (auto& block : blocks) {
+        block = heap.allocate(64);
+    }
+    // free every second, memory is free but in small pieces
+    for (size_t i = 0; i < 32; i += 2) {
+        assert(heap.free(blocks[i]) == Error::None, "failed to free");
+    }
+
+    auto stats = heap.getStats();
+    print("fragmented: %u bytes free, largest block %u, %u%%\r\n",
+          static_cast<unsigned int>(stats.freeBytes),
+          static_cast<unsigned int>(stats.largestFreeBlock),
+          static_cast<unsigned int>(stats.fragmentationPercent));
+    assert(stats.fragmentationPercent > 30,
+           "fragmentation of %u%% not recognized",
+           static_cast<unsigned int>(stats.fragmentationPercent));
+
+    for (size_t i = 1; i < 32; i += 2) {
+        assert(heap.free(blocks[i]) == Error::None, "failed to free");
+    }
+    assert(heap.getStats().fragmentationPercent == 0,
+           "fragmentation left after freeing all");
+}
+
+/**
+ * @brief allocations are counted per call site when tracking is on
+ *
+ */
+void Test::Tlsf::testCallSites()
+{
+    Memory::Tlsf heap {arena, kArenaSize};
+    int          siteA = 0;
+    int          siteB = 0;
+
+    CHECK_ERROR(heap.free(heap.allocate(10, &siteA)));
+    Memory::CallSite sites[Memory::Tlsf::kMaxCallSites];
+    assert(heap.getCallSites(sites, Memory::Tlsf::kMaxCallSites) == 0,
+           "call site counted while tracking is off");
+
+    heap.trackCallSites(true);
+    for (int i = 0; i < 3; i++) {
+        CHECK_ERROR(heap.free(heap.allocate(10, &siteA)));
+    }
+    CHECK_ERROR(heap.free(heap.allocate(100, &siteB)));
+
+    auto count = heap.getCallSites(sites, Memory::Tlsf::kMaxCallSites);
+    assert(count == 2,
+           "%u call sites instead of 2",
+           static_cast<unsigned int>(count));
+    assert((sites[0].address == &siteA) && (sites[0].allocations == 3u) &&
+               (sites[0].bytes == 30u),
+           "first call site counted wrong");
+    assert((sites[1].address == &siteB) && (sites[1].allocations == 1u),
+           "second call site counted wrong");
+}
+
+/**
+ * @brief random allocations keep the heap consistent
+ *
+ */
+void Test::Tlsf::testRandom()
+{
+    Memory::Tlsf heap {arena, kArenaSize};
+    void*        blocks[24] {};
+    uint32_t     seed = 12345;
+
+    for (int round = 0; round < 2000; round++) {
+        seed       = seed * 1103515245 + 12345;
+        auto index = (seed >> 16) % 24;
+        if (blocks[index] == nullptr) {
+            blocks[index] = heap.allocate((seed >> 8) % 200);
+            if (blocks[index] != nullptr) {
+                memset(blocks[index], index, heap.usableSize(blocks[index]));
+            }
+        } else {
+            auto data = static_cast<uint8_t*>(blocks[index]);
+            if (data[0] != index) {
+                assert(false, "allocation overwritten in round %d", round);
+                return;
+            }
+            CHECK_ERROR(heap.free(blocks[index]));
+            blocks[index] = nullptr;
+        }
+    }
+
+    for (auto block : blocks) {
+        CHECK_ERROR(heap.free(block));
+    }
+    auto stats = heap.getStats();
+    assert((stats.liveBytes == 0u) &&
+               (stats.largestFreeBlock == stats.totalBytes),
+           "heap not consistent after random use");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
@@ -0,0 +1,132 @@
+/**
+ * @file TestWire.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief test for the packed frame serializer
+ * @version 1.0
+ * @date 2020-11-12
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include "TestWire.h"
+
+#include "TestEndians.h"
+
+#include <array>
+#include <cstring>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+Test::Wire Test::Wire::instance {};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** expected bytes of the frame encoded in testEncode() */
+static constexpr std::array<uint8_t, 22> kFrame = {
+    0x7F,                               // Little<uint8_t>
+    0x34, 0x12,                         // Little<uint16_t>
+    0x12, 0x34, 0x56, 0x78,             // Big<uint32_t>
+    0xFF, 0xFE,                         // Big<int16_t>
+    0x0A, 0x0B,                         // Big<Kind>
+    0xAA, 0xBB, 0xCC,                   // Bytes<3>
+    0x00, 0x01, 0x00, 0x02, 0x03, 0x00, // Array<uint16_t, 3, big>
+    0x00, 0x00};                        // first half of Little<float>
+
+//------------------------------ CONSTRUCTOR ----------------------------------
+
+Test::Wire::Wire() : Test::Base("Endians", "Wire") {}
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+void Test::Wire::runInternal()
+{
+    static_assert(Frame::kSize == 24, "frame is not packed");
+
+    testEncode();
+    testDecode();
+}
+
+const std::list<Test::Base*> Test::Wire::getPrerequisits()
+{
+    return std::list<Test::Base*>({&Test::Endians::getInstance()});
+}
+
+Test::Wire& Test::Wire::getInstance()
+{
+    return instance;
+}
+
+//----------------------- INTERFACE IMPLEMENTATIONS ---------------------------
+
+//--------------------------- PRIVATE FUNCTIONS -------------------------------
+
+/**
+ * @brief fields are written packed and in their byte order, also to an
+ * unaligned buffer
+ *
+ */
+void Test::Wire::testEncode()
+{
+    // guard bytes around the frame, frame starts unaligned
+    std::array<uint8_t, Frame::kSize + 2> buffer;
+    buffer.fill(0x55);
+
+    Frame::encode(buffer.data() + 1,
+                  0x7F,
+                  0x1234,
+                  0x12345678,
+                  -2,
+                  Kind::Sensor,
+                  {0xAA, 0xBB, 0xCC},
+                  {0x0001, 0x0002, 0x0300},
+                  1.0f);
+
+    assert(std::memcmp(buffer.data() + 1, kFrame.data(), kFrame.size()) == 0,
+           "frame encoded wrong");
+    // 1.0f is 0x3F800000
+    assert(buffer[23] == 0x80 && buffer[24] == 0x3F, "float encoded wrong");
+    assert(buffer.front() == 0x55 && buffer.back() == 0x55,
+           "encode wrote outside of the frame");
+}
+
+/**
+ * @brief decoding an encoded frame returns the same values
+ *
+ */
+void Test::Wire::testDecode()
+{
+    uint8_t frame[Frame::kSize];
+    Frame::encode(frame,
+                  0x7F,
+                  0x1234,
+                  0x12345678,
+                  -2,
+                  Kind::Beacon,
+                  {0xAA, 0xBB, 0xCC},
+                  {0x0001, 0x0002, 0x0300},
+                  -0.5f);
+
+    uint8_t                 u8;
+    uint16_t                u16;
+    uint32_t                u32;
+    int16_t                 i16;
+    Kind                    kind;
+    std::array<uint8_t, 3>  bytes;
+    std::array<uint16_t, 3> words;
+    float                   f;
+    Frame::decode(frame, u8, u16, u32, i16, kind, bytes, words, f);
+
+    assert(u8 == 0x7F && u16 == 0x1234 && u32 == 0x12345678 && i16 == -2,
+           "integers decoded wrong");
+    assert(kind == Kind::Beacon, "enum decoded wrong");
+    assert(bytes == std::array<uint8_t, 3> {0xAA, 0xBB, 0xCC},
+           "bytes decoded wrong");
+    assert(words == std::array<uint16_t, 3> {0x0001, 0x0002, 0x0300},
+           "array decoded wrong");
+    assert(f == -0.5f, "float decoded wrong");
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
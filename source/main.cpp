@@ -1,8 +1,47 @@
 #include "AL_Log.h"
 #include "AL_Port.h"
 #include "AL_RTOS.h"
+#include "AL_Task.h"
+#include "CrashReport.h"
 #include "aconnoConfig.h"
 
+/**
+ * @brief Moves the crash of the last run from RAM into flash, once.
+ *
+ * @details Writing flash blocks until done, so it can not run from main()
+ * before the scheduler is started.
+ */
+class CrashCommitter {
+    /** StackSize of the task in sizeof(StackType_t) bytes */
+    static constexpr size_t kStackSize = 256;
+
+    using TaskType = RTOS::Task<kStackSize, CrashCommitter>;
+    friend TaskType;
+
+public:
+    CrashCommitter() : task(*this, "crashCommitter", 1) {}
+
+private:
+    void onStart()
+    {
+        // do nothing
+    }
+
+    void onRun()
+    {
+        auto result = Log::CrashReport::commit();
+        if (result != Error::None && result != Error::NotFound) {
+            // NotFound if the last run did not crash
+            LOG_E("could not commit crash report: %u", result);
+        }
+        task.suspend();
+    }
+
+    TaskType task; /**< instantiate after all other RTOS objects */
+};
+
+static CrashCommitter crashCommitter {};
+
 /**
  * @brief Function for application main entry
  * 
@@ -0,0 +1,127 @@
+/**
+ * @file ErrorSites.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief maps error site IDs back to file:line
+ *
+ * @details Runs on the PC. Site IDs are built by Error::makeSite() from the
+ * hash of the file name and the line, see libs/Patterns/include/Error.h.
+ * The header is used as it is, so the hash can not get out of sync. All
+ * sources below the given directory are hashed, names that collide are
+ * all printed.
+ *
+ * @version 1.0
+ * @date 2020-11-16
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <Error.h>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/** source files per file name hash */
+using Sources = std::multimap<uint32_t, std::filesystem::path>;
+
+//------------------------------- PROTOTYPES ----------------------------------
+
+static Sources     findSources(const std::filesystem::path& root);
+static std::string readLine(const std::filesystem::path& path, uint32_t line);
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <source dir> <site ID>...\n";
+        return 1;
+    }
+
+    std::error_code error {};
+    if (!std::filesystem::is_directory(argv[1], error)) {
+        std::cerr << argv[1] << " is no directory\n";
+        return 1;
+    }
+    auto sources = findSources(argv[1]);
+
+    int unknown = 0;
+    for (int i = 2; i < argc; i++) {
+        char* end  = nullptr;
+        auto  site = static_cast<uint32_t>(std::strtoul(argv[i], &end, 0));
+        if (end == argv[i] || *end != '\0') {
+            std::cerr << argv[i] << " is no site ID\n";
+            return 1;
+        }
+
+        auto     hash  = site >> Error::kSiteLineBits;
+        uint32_t line  = Error::getSiteLine(site);
+        auto     range = sources.equal_range(hash);
+        if (range.first == range.second) {
+            std::cout << argv[i] << ": unknown file, line " << line << "\n";
+            unknown++;
+        }
+        for (auto it = range.first; it != range.second; ++it) {
+            std::cout << argv[i] << ": " << it->second.string() << ":" << line
+                      << ": " << readLine(it->second, line) << "\n";
+        }
+    }
+    return unknown > 0 ? 2 : 0;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Hash of every C and C++ file below root.
+ *
+ */
+static Sources findSources(const std::filesystem::path& root)
+{
+    static const std::vector<std::string> kExtensions = {
+        ".c", ".cpp", ".h", ".hpp"};
+
+    Sources sources {};
+    for (auto& entry :
+         std::filesystem::recursive_directory_iterator(root,
+             std::filesystem::directory_options::skip_permission_denied)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        auto extension = entry.path().extension().string();
+        for (auto& known : kExtensions) {
+            if (extension == known) {
+                auto name = entry.path().filename().string();
+                sources.emplace(Error::hashFileName(name.c_str()),
+                                entry.path());
+                break;
+            }
+        }
+    }
+    return sources;
+}
+
+/**
+ * @brief Source line, trimmed. Empty if the file is shorter.
+ *
+ */
+static std::string readLine(const std::filesystem::path& path, uint32_t line)
+{
+    std::ifstream input(path);
+    std::string   text {};
+    for (uint32_t i = 0; i < line && std::getline(input, text); i++) {
+        if (i + 1 == line) {
+            auto start = text.find_first_not_of(" \t");
+            return start == std::string::npos ? "" : text.substr(start);
+        }
+    }
+    return "";
+}
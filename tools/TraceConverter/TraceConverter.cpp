@@ -0,0 +1,382 @@
+/**
+ * @file TraceConverter.cpp
+ * @author Joshua Lauterbach (joshua@aconno.de)
+ * @brief converts a dump of RTOS::Trace into Chrome trace JSON
+ *
+ * @details Runs on the PC. The output opens in chrome://tracing and in
+ * Perfetto (ui.perfetto.dev). Every task and every ISR gets its own track,
+ * queue fill levels become counters, queue operations, failed error checks
+ * and user events become instant events on the track of the running task.
+ *
+ * The dump layout is defined by RTOS::Trace::DumpHeader in
+ * libs/FreeRTOSAL/include/AL_Trace.h and duplicated here, so the tool builds
+ * without the firmware sources.
+ *
+ * @version 1.0
+ * @date 2020-11-05
+ *
+ * @copyright aconno GmbH (c) 2020
+ *
+ */
+
+//--------------------------------- INCLUDES ----------------------------------
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+//--------------------------- STRUCTS AND ENUMS -------------------------------
+
+/** event ids, see RTOS::Trace::Id */
+enum Id : uint8_t {
+    TaskSwitchIn = 1,
+    IsrEnter,
+    IsrExit,
+    QueueSend,
+    QueueReceive,
+    ErrorCheck,
+    User = 0x40
+};
+
+/** kind of a name, see RTOS::Trace::NameKind */
+enum NameKind : uint8_t { TaskName = 0, QueueName = 1 };
+
+/** one decoded record */
+struct Event {
+    double   timeUs;
+    uint8_t  id;
+    uint32_t arg;
+};
+
+/** everything in a dump */
+struct Dump {
+    uint32_t                        lostRecords;
+    uint32_t                        timestampHz;
+    std::map<uint16_t, std::string> tasks;
+    std::map<uint16_t, std::string> queues;
+    std::vector<Event>              events;
+};
+
+//-------------------------------- CONSTANTS ----------------------------------
+
+/** "ATRC" */
+static constexpr uint32_t kDumpMagic = 0x43525441;
+/** dump layout this tool understands */
+static constexpr uint8_t kDumpVersion = 1;
+/** sizes of DumpHeader, DumpName and Record */
+static constexpr size_t kHeaderSize = 20;
+static constexpr size_t kNameSize   = 16;
+static constexpr size_t kRecordSize = 8;
+/** length of the name in DumpName */
+static constexpr size_t kNameLength = 12;
+/** tracks of ISRs start here, tasks use their task number */
+static constexpr uint32_t kIsrTrackOffset = 1000;
+/** exception number of IRQ 0 on Cortex-M */
+static constexpr uint32_t kFirstIrq = 16;
+
+//------------------------------- PROTOTYPES ----------------------------------
+
+static uint32_t    readU32(const uint8_t* data);
+static uint16_t    readU16(const uint8_t* data);
+static bool        parse(const std::vector<uint8_t>& bytes, Dump& dump);
+static void        writeJson(const Dump& dump, std::ostream& out);
+static std::string escape(const std::string& text);
+static std::string nameOf(const std::map<uint16_t, std::string>& names,
+                          uint16_t                               number,
+                          const char*                            fallback);
+
+//--------------------------- EXPOSED FUNCTIONS -------------------------------
+
+/**
+ * @brief TraceConverter <dump.bin> [trace.json]
+ * Writes to stdout if no output file is given.
+ *
+ */
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3) {
+        std::cerr << "usage: " << argv[0] << " <dump.bin> [trace.json]\n";
+        return 1;
+    }
+
+    std::ifstream input(argv[1], std::ios::binary);
+    if (!input) {
+        std::cerr << "can not open " << argv[1] << "\n";
+        return 1;
+    }
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(input)),
+                               std::istreambuf_iterator<char>());
+
+    Dump dump {};
+    if (!parse(bytes, dump)) {
+        return 1;
+    }
+
+    if (argc == 3) {
+        std::ofstream output(argv[2]);
+        if (!output) {
+            std::cerr << "can not open " << argv[2] << "\n";
+            return 1;
+        }
+        writeJson(dump, output);
+    } else {
+        writeJson(dump, std::cout);
+    }
+
+    std::cerr << dump.events.size() << " records, " << dump.lostRecords
+              << " lost, " << dump.tasks.size() << " tasks, "
+              << dump.queues.size() << " queues\n";
+    return 0;
+}
+
+//---------------------------- STATIC FUNCTIONS -------------------------------
+
+/**
+ * @brief Read little endian 32 bit.
+ *
+ */
+static uint32_t readU32(const uint8_t* data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * @brief Read little endian 16 bit.
+ *
+ */
+static uint16_t readU16(const uint8_t* data)
+{
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+/**
+ * @brief Finds the first dump in bytes and decodes it.
+ *
+ * @details Anything in front of the magic is skipped, so a capture that
+ * started early still works. Timestamps are unwrapped: a timestamp more
+ * than half the counter range below its predecessor counts as overflow,
+ * smaller steps back happen when an ISR preempts an event between taking
+ * the slot and reading the clock.
+ *
+ * @return bool false if there is no complete dump
+ */
+static bool parse(const std::vector<uint8_t>& bytes, Dump& dump)
+{
+    size_t offset = 0;
+    while (offset + kHeaderSize <= bytes.size() &&
+           readU32(&bytes[offset]) != kDumpMagic) {
+        ++offset;
+    }
+    if (offset + kHeaderSize > bytes.size()) {
+        std::cerr << "no trace dump found\n";
+        return false;
+    }
+
+    const uint8_t* header = &bytes[offset];
+    if (header[4] != kDumpVersion) {
+        std::cerr << "dump version " << unsigned(header[4])
+                  << " not supported\n";
+        return false;
+    }
+    uint16_t nameCount   = readU16(header + 6);
+    uint32_t recordCount = readU32(header + 8);
+    dump.lostRecords     = readU32(header + 12);
+    dump.timestampHz     = readU32(header + 16);
+    offset += kHeaderSize;
+
+    size_t needed = nameCount * kNameSize + size_t(recordCount) * kRecordSize;
+    if (dump.timestampHz == 0 || offset + needed > bytes.size()) {
+        std::cerr << "dump is truncated\n";
+        return false;
+    }
+
+    for (uint16_t i = 0; i < nameCount; ++i, offset += kNameSize) {
+        const uint8_t* entry = &bytes[offset];
+        std::string    name(reinterpret_cast<const char*>(entry + 4),
+                         strnlen(reinterpret_cast<const char*>(entry + 4),
+                                 kNameLength));
+        auto& names = (entry[0] == QueueName) ? dump.queues : dump.tasks;
+        names[readU16(entry + 2)] = name;
+    }
+
+    uint64_t time     = 0;
+    uint32_t previous = 0;
+    for (uint32_t i = 0; i < recordCount; ++i, offset += kRecordSize) {
+        uint32_t timestamp = readU32(&bytes[offset]);
+        uint32_t idAndArg  = readU32(&bytes[offset + 4]);
+
+        if (i == 0) {
+            time = timestamp;
+        } else if (timestamp - previous < 0x80000000u) {
+            time += timestamp - previous;
+        } else {
+            time -= previous - timestamp;
+        }
+        previous = timestamp;
+
+        dump.events.push_back({time * 1e6 / dump.timestampHz,
+                               static_cast<uint8_t>(idAndArg >> 24),
+                               idAndArg & 0xFFFFFF});
+    }
+    return true;
+}
+
+/**
+ * @brief Writes the Chrome trace JSON object format.
+ *
+ */
+static void writeJson(const Dump& dump, std::ostream& out)
+{
+    bool first = true;
+    auto begin = [&]() -> std::ostream& {
+        out << (first ? "\n" : ",\n");
+        first = false;
+        return out;
+    };
+
+    out << "{\"displayTimeUnit\":\"ns\",\"otherData\":{\"lostRecords\":"
+        << dump.lostRecords << ",\"timestampHz\":" << dump.timestampHz
+        << "},\"traceEvents\":[";
+    begin() << "{\"ph\":\"M\",\"pid\":1,\"name\":\"process_name\","
+               "\"args\":{\"name\":\"MCU\"}}";
+    for (const auto& task : dump.tasks) {
+        begin() << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << task.first
+                << ",\"name\":\"thread_name\",\"args\":{\"name\":\""
+                << escape(task.second) << "\"}}";
+    }
+
+    bool     taskRunning = false;
+    uint32_t task        = 0;
+    std::map<uint32_t, unsigned> openIsrs;
+    double   lastUs      = 0;
+
+    for (const auto& event : dump.events) {
+        lastUs = event.timeUs;
+        char time[32];
+        std::snprintf(time, sizeof(time), "%.3f", event.timeUs);
+
+        switch (event.id) {
+            case TaskSwitchIn:
+                if (taskRunning) {
+                    begin() << "{\"ph\":\"E\",\"pid\":1,\"tid\":" << task
+                            << ",\"ts\":" << time << "}";
+                }
+                task        = event.arg;
+                taskRunning = true;
+                begin() << "{\"ph\":\"B\",\"pid\":1,\"tid\":" << task
+                        << ",\"ts\":" << time << ",\"name\":\""
+                        << escape(nameOf(dump.tasks, task, "task")) << "\"}";
+                break;
+
+            case IsrEnter:
+            case IsrExit: {
+                uint32_t track = kIsrTrackOffset + event.arg;
+                if (openIsrs.find(track) == openIsrs.end()) {
+                    begin() << "{\"ph\":\"M\",\"pid\":1,\"tid\":" << track
+                            << ",\"name\":\"thread_name\",\"args\":{"
+                               "\"name\":\"IRQ "
+                            << int(event.arg) - int(kFirstIrq) << "\"}}";
+                    openIsrs[track] = 0;
+                }
+                if (event.id == IsrEnter) {
+                    ++openIsrs[track];
+                    begin() << "{\"ph\":\"B\",\"pid\":1,\"tid\":" << track
+                            << ",\"ts\":" << time << ",\"name\":\"ISR\"}";
+                } else if (openIsrs[track] > 0) {
+                    --openIsrs[track];
+                    begin() << "{\"ph\":\"E\",\"pid\":1,\"tid\":" << track
+                            << ",\"ts\":" << time << "}";
+                }
+                break;
+            }
+
+            case QueueSend:
+            case QueueReceive: {
+                auto queue = escape(nameOf(dump.queues, event.arg & 0xFF, "queue"));
+                begin() << "{\"ph\":\"C\",\"pid\":1,\"ts\":" << time
+                        << ",\"name\":\"" << queue
+                        << "\",\"args\":{\"messages\":" << (event.arg >> 8)
+                        << "}}";
+                begin() << "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":"
+                        << task << ",\"ts\":" << time << ",\"name\":\""
+                        << (event.id == QueueSend ? "send " : "receive ")
+                        << queue << "\"}";
+                break;
+            }
+
+            case ErrorCheck:
+                begin() << "{\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":"
+                        << task << ",\"ts\":" << time
+                        << ",\"name\":\"CHECK_ERROR failed\",\"args\":{"
+                           "\"code\":"
+                        << (event.arg >> 16)
+                        << ",\"line\":" << (event.arg & 0xFFFF) << "}}";
+                break;
+
+            default:
+                begin() << "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":"
+                        << task << ",\"ts\":" << time << ",\"name\":\""
+                        << (event.id >= User ? "user " : "event ")
+                        << int(event.id >= User ? event.id - User : event.id)
+                        << "\",\"args\":{\"arg\":" << event.arg << "}}";
+                break;
+        }
+    }
+
+    // close what is still running at the end of the dump
+    char time[32];
+    std::snprintf(time, sizeof(time), "%.3f", lastUs);
+    if (taskRunning) {
+        begin() << "{\"ph\":\"E\",\"pid\":1,\"tid\":" << task
+                << ",\"ts\":" << time << "}";
+    }
+    for (const auto& isr : openIsrs) {
+        for (unsigned i = 0; i < isr.second; ++i) {
+            begin() << "{\"ph\":\"E\",\"pid\":1,\"tid\":" << isr.first
+                    << ",\"ts\":" << time << "}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+/**
+ * @brief Escapes a string for a JSON string literal.
+ *
+ */
+static std::string escape(const std::string& text)
+{
+    std::string escaped;
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+            escaped += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            escaped += '?';
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/**
+ * @brief Name of a task or queue, "<fallback> <number>" if not in the dump.
+ *
+ */
+static std::string nameOf(const std::map<uint16_t, std::string>& names,
+                          uint16_t                               number,
+                          const char*                            fallback)
+{
+    auto found = names.find(number);
+    if (found != names.end()) {
+        return found->second;
+    }
+    return std::string(fallback) + " " + std::to_string(number);
+}